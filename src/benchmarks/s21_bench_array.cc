@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#include "../model/s21_array.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::size_t kRounds = 20000000;
+
+static double ms_since(clock_type::time_point start) {
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start)
+      .count();
+}
+
+// a key table of N entries, looked up, compared and refilled kRounds times
+template <typename T, std::size_t N>
+static void run(const char *type) {
+  std::array<T, N> std_table;
+  s21::array<T, N> table;
+  for (std::size_t i = 0; i < N; ++i) {
+    std_table[i] = table[i] = static_cast<T>(i * 3);
+  }
+  std::array<T, N> std_copy = std_table;
+  s21::array<T, N> copy = table;
+  volatile std::size_t sink = 0;
+
+  auto start = clock_type::now();
+  for (std::size_t i = 0; i < kRounds; ++i) {
+    T key = static_cast<T>(i % (3 * N));
+    sink = sink + (std::find(std_table.begin(), std_table.end(), key) - std_table.begin());
+  }
+  double std_find = ms_since(start);
+  start = clock_type::now();
+  for (std::size_t i = 0; i < kRounds; ++i) {
+    T key = static_cast<T>(i % (3 * N));
+    sink = sink + (table.find(key) - table.begin());
+  }
+  double s21_find = ms_since(start);
+
+  start = clock_type::now();
+  for (std::size_t i = 0; i < kRounds; ++i) {
+    std_copy[i % N] = static_cast<T>(i);
+    sink = sink + (std_copy == std_table);
+    std_copy[i % N] = std_table[i % N];
+  }
+  double std_equal = ms_since(start);
+  start = clock_type::now();
+  for (std::size_t i = 0; i < kRounds; ++i) {
+    copy[i % N] = static_cast<T>(i);
+    sink = sink + (copy == table);
+    copy[i % N] = table[i % N];
+  }
+  double s21_equal = ms_since(start);
+
+  start = clock_type::now();
+  for (std::size_t i = 0; i < kRounds; ++i) {
+    std_copy.fill(static_cast<T>(i));
+    sink = sink + std_copy[i % N];
+  }
+  double std_fill = ms_since(start);
+  start = clock_type::now();
+  for (std::size_t i = 0; i < kRounds; ++i) {
+    copy.fill(static_cast<T>(i));
+    sink = sink + copy[i % N];
+  }
+  double s21_fill = ms_since(start);
+
+  std::printf("%-8s x %3zu  find %7.1f / %7.1f   == %7.1f / %7.1f   fill %7.1f / %7.1f\n",
+              type, N, std_find, s21_find, std_equal, s21_equal, std_fill, s21_fill);
+}
+
+int main() {
+  std::printf("%zu rounds, ms for std::array / s21::array\n", kRounds);
+  run<std::uint8_t, 32>("uint8_t");
+  run<std::uint16_t, 32>("uint16_t");
+  run<std::int32_t, 64>("int32_t");
+  run<std::uint64_t, 64>("uint64_t");
+  run<float, 64>("float");
+  run<double, 32>("double");
+  return 0;
+}
@@ -0,0 +1,65 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_buffered_map.hh"
+#include "../model/s21_map.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::size_t kUpdatesPerThread = 1000000;
+constexpr std::uint32_t kKeyRange = 10000;
+
+// the baseline: every increment takes the lock of the shared map
+class locked_counters {
+ public:
+  void update(std::uint32_t key, std::uint64_t delta) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_[key] += delta;
+  }
+  void flush() {}
+
+ private:
+  std::mutex mutex_;
+  s21::map<std::uint32_t, std::uint64_t> map_;
+};
+
+template <typename Counters>
+static double run(Counters &counters, unsigned threads) {
+  auto start = clock_type::now();
+  std::vector<std::thread> workers;
+  for (unsigned t = 0; t < threads; ++t) {
+    workers.emplace_back([&counters, t] {
+      std::uint32_t state = 2463534242U + t;
+      for (std::size_t i = 0; i < kUpdatesPerThread; ++i) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        counters.update(state % kKeyRange, 1);
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  counters.flush();
+  double seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+  return threads * kUpdatesPerThread / seconds / 1e6;
+}
+
+int main() {
+  std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+  std::printf("%8s %22s %22s\n", "threads", "locked map Mupd/s",
+              "buffered_map Mupd/s");
+  for (unsigned threads = 1; threads <= 16; threads *= 2) {
+    locked_counters locked;
+    s21::buffered_map<std::uint32_t, std::uint64_t> buffered;
+    double locked_rate = run(locked, threads);
+    double buffered_rate = run(buffered, threads);
+    std::printf("%8u %22.2f %22.2f\n", threads, locked_rate, buffered_rate);
+  }
+  return 0;
+}
@@ -0,0 +1,48 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../model/s21_map.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+static double ms_since(clock_type::time_point start) {
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start)
+      .count();
+}
+
+int main() {
+  constexpr std::size_t kPairs = 4000000;
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> input;
+  input.reserve(kPairs);
+  std::uint64_t state = 88172645463325252ULL;
+  for (std::size_t i = 0; i < kPairs; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    input.emplace_back(state, i);
+  }
+
+  std::printf("hardware threads: %u, %zu unsorted pairs\n",
+              std::thread::hardware_concurrency(), kPairs);
+  auto start = clock_type::now();
+  {
+    s21::map<std::uint64_t, std::uint64_t> m;
+    for (const auto &value : input) {
+      m.insert(value);
+    }
+    std::printf("%-24s %10.1f ms (%zu keys)\n", "sequential insert",
+                ms_since(start), m.size());
+  }
+  for (unsigned threads = 1; threads <= 32; threads *= 2) {
+    start = clock_type::now();
+    auto m = s21::map<std::uint64_t, std::uint64_t>::build_parallel(
+        input.begin(), input.end(), threads);
+    std::printf("build_parallel %2u threads %10.1f ms (%zu keys)\n", threads,
+                ms_since(start), m.size());
+  }
+  return 0;
+}
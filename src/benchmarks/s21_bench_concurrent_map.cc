@@ -0,0 +1,95 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_concurrent_map.hh"
+#include "../model/s21_map.hh"
+
+// Mixed workload on a shared ordered index: 80% lookups, 10% inserts,
+// 10% erases over a fixed key range that starts half full.
+constexpr std::uint32_t kKeyRange = 1 << 20;
+constexpr std::size_t kOpsPerThread = 400000;
+
+using clock_type = std::chrono::steady_clock;
+
+// one global mutex around s21::map, what the shards replace
+class locked_map {
+ public:
+  bool contains(std::uint32_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+  void insert(std::uint32_t key, std::uint32_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert(key, value);
+  }
+  void erase(std::uint32_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.erase(map_.find(key));
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::map<std::uint32_t, std::uint32_t> map_;
+};
+
+template <typename Map>
+static double run(Map& map, unsigned threads) {
+  std::vector<std::thread> workers;
+  auto start = clock_type::now();
+  for (unsigned t = 0; t < threads; ++t) {
+    workers.emplace_back([&map, t] {
+      std::uint32_t state = 2654435761U * (t + 1);
+      std::size_t hits = 0;
+      for (std::size_t i = 0; i < kOpsPerThread; ++i) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        std::uint32_t key = state % kKeyRange;
+        std::uint32_t op = (state >> 24) % 10;
+        if (op == 0) {
+          map.insert(key, key);
+        } else if (op == 1) {
+          map.erase(key);
+        } else {
+          hits += map.contains(key);
+        }
+      }
+      if (hits == kOpsPerThread) {
+        std::printf("unlikely\n");
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  double seconds =
+      std::chrono::duration<double>(clock_type::now() - start).count();
+  return threads * kOpsPerThread / seconds / 1e6;
+}
+
+template <typename Map>
+static void prefill(Map& map) {
+  for (std::uint32_t key = 0; key < kKeyRange; key += 2) {
+    map.insert(key, key);
+  }
+}
+
+int main() {
+  std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+  std::printf("%8s %22s %22s\n", "threads", "mutex+s21::map Mops/s",
+              "concurrent_map Mops/s");
+  for (unsigned threads = 1; threads <= 64; threads *= 2) {
+    locked_map locked;
+    prefill(locked);
+    s21::concurrent_map<std::uint32_t, std::uint32_t> sharded;
+    prefill(sharded);
+    double locked_rate = run(locked, threads);
+    double sharded_rate = run(sharded, threads);
+    std::printf("%8u %22.2f %22.2f\n", threads, locked_rate, sharded_rate);
+  }
+  return 0;
+}
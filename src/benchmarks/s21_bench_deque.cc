@@ -0,0 +1,83 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <queue>
+
+#include "../model/s21_deque.hh"
+#include "../model/s21_queue.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::uint64_t kOps = 50000000;
+constexpr std::uint64_t kBacklog = 100000;
+constexpr std::uint64_t kBatch = 4096;
+
+static double ms_since(clock_type::time_point start) {
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+}
+
+/*
+  A work queue holding kBacklog items: kOps push/pop pairs, timed in
+  batches of kBatch so the worst batch shows allocation spikes.
+*/
+template <typename Queue>
+static void run_queue(const char *name) {
+  Queue queue;
+  for (std::uint64_t i = 0; i < kBacklog; ++i) {
+    queue.push(i);
+  }
+  double worst = 0;
+  std::uint64_t sum = 0;
+  auto start = clock_type::now();
+  for (std::uint64_t i = 0; i < kOps; i += kBatch) {
+    auto batch = clock_type::now();
+    for (std::uint64_t j = i; j < i + kBatch; ++j) {
+      sum += queue.front();
+      queue.pop();
+      queue.push(j);
+    }
+    double ms = ms_since(batch);
+    worst = ms > worst ? ms : worst;
+  }
+  std::printf("%-22s steady  %7.1f ms (worst batch %5.2f ms)  (sum %llu)\n", name,
+              ms_since(start), worst, static_cast<unsigned long long>(sum));
+}
+
+// push at both ends, sum by index, then pop from both ends
+template <typename Deque>
+static void run_deque(const char *name) {
+  Deque deque;
+  auto start = clock_type::now();
+  for (std::uint64_t i = 0; i < kOps / 2; ++i) {
+    deque.push_back(i);
+    deque.push_front(i);
+  }
+  double push = ms_since(start);
+  start = clock_type::now();
+  std::uint64_t sum = 0;
+  for (std::uint64_t i = 0; i < deque.size(); i += 7) {
+    sum += deque[i];
+  }
+  double index = ms_since(start);
+  start = clock_type::now();
+  while (!deque.empty()) {
+    sum += deque.front() + deque.back();
+    deque.pop_front();
+    if (!deque.empty()) {
+      deque.pop_back();
+    }
+  }
+  std::printf("%-22s push %7.1f ms  index %6.1f ms  pop %7.1f ms  (sum %llu)\n", name, push,
+              index, ms_since(start), static_cast<unsigned long long>(sum));
+}
+
+int main() {
+  std::printf("%llu operations, backlog of %llu\n", static_cast<unsigned long long>(kOps),
+              static_cast<unsigned long long>(kBacklog));
+  run_queue<std::queue<std::uint64_t>>("std::queue");
+  run_queue<s21::queue<std::uint64_t>>("s21::queue");
+  run_deque<std::deque<std::uint64_t>>("std::deque");
+  run_deque<s21::deque<std::uint64_t>>("s21::deque");
+  return 0;
+}
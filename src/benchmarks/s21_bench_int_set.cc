@@ -0,0 +1,99 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "../model/s21_int_set.hh"
+#include "../model/s21_set.hh"
+
+// Every heap allocation goes through here, so the difference of
+// g_allocated before and after filling a container is its live footprint.
+// Both containers release memory through sized delete, which keeps the
+// counter exact without a size header.
+static std::size_t g_allocated = 0;
+
+void* operator new(std::size_t size) {
+  g_allocated += size;
+  if (void* ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t size) noexcept {
+  g_allocated -= size;
+  std::free(ptr);
+}
+
+using clock_type = std::chrono::steady_clock;
+
+static double ms_since(clock_type::time_point start) {
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start)
+      .count();
+}
+
+template <typename Set>
+static void run(const char* name, const std::vector<std::uint32_t>& keys,
+                std::uint32_t universe) {
+  // A large allocation makes malloc consolidate the nodes freed by the
+  // previous run here rather than inside the timed insert loop.
+  void* volatile warmup = std::malloc(1 << 20);
+  std::free(warmup);
+  std::size_t before = g_allocated;
+  Set s;
+
+  auto start = clock_type::now();
+  for (std::uint32_t key : keys) {
+    s.insert(key);
+  }
+  double insert_ms = ms_since(start);
+  std::size_t bytes = g_allocated - before;
+  std::size_t size = s.size();
+
+  std::size_t hits = 0;
+  start = clock_type::now();
+  for (std::uint32_t key = 0; key < universe; key += 3) {
+    hits += s.contains(key);
+  }
+  double contains_ms = ms_since(start);
+
+  std::uint64_t sum = 0;
+  start = clock_type::now();
+  for (auto it = s.begin(); it != s.end(); ++it) {
+    sum += *it;
+  }
+  double iterate_ms = ms_since(start);
+
+  start = clock_type::now();
+  for (std::uint32_t key : keys) {
+    s.erase(s.find(key));
+  }
+  double erase_ms = ms_since(start);
+
+  std::printf(
+      "%-22s bytes/elem %8.2f  insert %8.1f ms  contains %8.1f ms  "
+      "iterate %8.1f ms  erase %8.1f ms  (%zu %llu)\n",
+      name, static_cast<double>(bytes) / size, insert_ms, contains_ms,
+      iterate_ms, erase_ms, hits, static_cast<unsigned long long>(sum));
+}
+
+int main() {
+  const std::uint32_t universe = 4000000;
+  for (std::uint32_t density : {1U, 4U, 16U}) {
+    std::vector<std::uint32_t> keys;
+    std::uint32_t state = 12345;
+    for (std::uint32_t i = 0; i < universe / density; ++i) {
+      state = state * 1664525U + 1013904223U;
+      keys.push_back(state % universe);
+    }
+    std::printf("universe %u, %zu inserts (1 in %u ids)\n", universe,
+                keys.size(), density);
+    run<s21::set<std::uint32_t>>("s21::set<uint32_t>", keys, universe);
+    run<s21::int_set<std::uint32_t>>("s21::int_set<uint32_t>", keys, universe);
+  }
+  return 0;
+}
@@ -0,0 +1,97 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../model/s21_intrusive_set.hh"
+#include "../model/s21_multiset.hh"
+
+using clock_type = std::chrono::steady_clock;
+using timer = std::pair<std::uint64_t, std::uint32_t>;  // deadline, id
+
+constexpr std::uint32_t kConnections = 100000;
+constexpr std::uint64_t kReschedules = 5000000;
+
+static double ms_since(clock_type::time_point start) {
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+}
+
+struct connection {
+  timer deadline;
+  s21::rb_hook by_deadline;
+};
+
+struct by_deadline_less {
+  bool operator()(const connection &lhs, const connection &rhs) const {
+    return lhs.deadline < rhs.deadline;
+  }
+};
+
+/*
+  A deadline index over pool-allocated connections: each reschedule
+  moves a random connection to a new deadline, and every 16th step the
+  earliest one expires and is rearmed.
+*/
+static void run_intrusive() {
+  std::mt19937_64 random(48);
+  std::vector<connection> pool(kConnections);
+  s21::intrusive_set<connection, &connection::by_deadline, by_deadline_less> index;
+  for (std::uint32_t id = 0; id < kConnections; ++id) {
+    pool[id].deadline = timer(random() % 1000000, id);
+    index.insert(pool[id]);
+  }
+  std::uint64_t now = 0;
+  auto start = clock_type::now();
+  for (std::uint64_t i = 0; i < kReschedules; ++i) {
+    connection *c;
+    if (i % 16 == 0) {
+      c = &*index.begin();
+      now = c->deadline.first;
+    } else {
+      c = &pool[random() % kConnections];
+    }
+    index.erase(*c);
+    c->deadline.first = now + random() % 1000000;
+    index.insert(*c);
+  }
+  std::printf("%-32s %7.1f ms  (now %llu)\n", "s21::intrusive_set", ms_since(start),
+              static_cast<unsigned long long>(now));
+}
+
+template <typename Set>
+static void run_node_based(const char *name) {
+  std::mt19937_64 random(48);
+  Set index;
+  std::vector<typename Set::iterator> pool;
+  for (std::uint32_t id = 0; id < kConnections; ++id) {
+    pool.push_back(index.insert(timer(random() % 1000000, id)));
+  }
+  std::uint64_t now = 0;
+  auto start = clock_type::now();
+  for (std::uint64_t i = 0; i < kReschedules; ++i) {
+    std::uint32_t id;
+    if (i % 16 == 0) {
+      timer expired = *index.begin();
+      now = expired.first;
+      id = expired.second;
+    } else {
+      id = random() % kConnections;
+    }
+    index.erase(pool[id]);
+    pool[id] = index.insert(timer(now + random() % 1000000, id));
+  }
+  std::printf("%-32s %7.1f ms  (now %llu)\n", name, ms_since(start),
+              static_cast<unsigned long long>(now));
+}
+
+int main() {
+  std::printf("%llu reschedules over %u connections\n",
+              static_cast<unsigned long long>(kReschedules), kConnections);
+  run_node_based<std::multiset<timer>>("std::multiset erase + insert");
+  run_node_based<s21::multiset<timer>>("s21::multiset erase + insert");
+  run_intrusive();
+  return 0;
+}
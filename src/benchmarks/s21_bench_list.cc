@@ -0,0 +1,79 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <list>
+#include <unordered_map>
+
+#include "../model/s21_list.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::uint64_t kCapacity = 100000;
+constexpr std::uint64_t kRequests = 10000000;
+constexpr std::uint64_t kKeys = 400000;
+
+/*
+  LRU cache of kCapacity keys: a hit moves the key to the front of the
+  chain, a miss evicts the back and pushes the new key to the front.
+*/
+template <typename List>
+static void run(const char *name) {
+  List chain;
+  std::unordered_map<std::uint64_t, decltype(chain.begin())> index;
+  index.reserve(kCapacity * 2);
+  std::uint64_t hits = 0;
+  std::uint64_t state = 88172645463325252ULL;
+  auto start = clock_type::now();
+  for (std::uint64_t i = 0; i < kRequests; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    // skewed keys, so the cache has a working set
+    std::uint64_t key = (state % kKeys) * (state % kKeys) / kKeys;
+    auto found = index.find(key);
+    if (found != index.end()) {
+      chain.splice(chain.begin(), chain, found->second);
+      ++hits;
+      continue;
+    }
+    if (index.size() == kCapacity) {
+      index.erase(chain.back());
+      chain.pop_back();
+    }
+    chain.push_front(key);
+    index.emplace(key, chain.begin());
+  }
+  double ms = std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+  std::printf("%-12s %8.1f ms (%llu hits)\n", name, ms, static_cast<unsigned long long>(hits));
+}
+
+// node churn alone: the chain stays at kCapacity nodes while every
+// request frees one node and allocates another
+template <typename List>
+static void run_churn(const char *name) {
+  List chain;
+  for (std::uint64_t i = 0; i < kCapacity; ++i) {
+    chain.push_back(i);
+  }
+  auto start = clock_type::now();
+  for (std::uint64_t i = 0; i < kRequests; ++i) {
+    chain.pop_back();
+    chain.push_front(i);
+  }
+  double ms = std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+  std::printf("%-12s %8.1f ms (front %llu)\n", name, ms,
+              static_cast<unsigned long long>(chain.front()));
+}
+
+int main() {
+  std::printf("LRU chain of %llu keys, %llu requests\n",
+              static_cast<unsigned long long>(kCapacity),
+              static_cast<unsigned long long>(kRequests));
+  run<std::list<std::uint64_t>>("std::list");
+  run<s21::list<std::uint64_t>>("s21::list");
+  std::printf("pop_back + push_front on a chain of %llu nodes\n",
+              static_cast<unsigned long long>(kCapacity));
+  run_churn<std::list<std::uint64_t>>("std::list");
+  run_churn<s21::list<std::uint64_t>>("s21::list");
+  return 0;
+}
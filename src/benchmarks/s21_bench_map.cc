@@ -0,0 +1,56 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory_resource>
+#include <vector>
+
+#include "../model/s21_map.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr int kRequests = 20000;
+constexpr int kKeys = 500;
+
+static double ms_since(clock_type::time_point start) {
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+}
+
+/*
+  Request-scoped maps: every request fills a map of kKeys keys, looks
+  them up and drops the whole map. make_map(resource) gives the map of
+  one request, resource is released after it.
+*/
+template <typename MakeMap>
+static void run(const char *name, MakeMap make_map) {
+  std::vector<unsigned char> buffer(kKeys * 128);
+  std::uint64_t state = 88172645463325252ULL;
+  std::uint64_t sum = 0;
+  auto start = clock_type::now();
+  for (int request = 0; request < kRequests; ++request) {
+    std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size());
+    auto headers = make_map(&resource);
+    for (int i = 0; i < kKeys; ++i) {
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      headers[static_cast<int>(state % (kKeys * 4))] = i;
+    }
+    for (int i = 0; i < kKeys; ++i) {
+      sum += headers.find(i) != headers.end();
+    }
+  }
+  std::printf("%-44s %7.1f ms  (%llu hits)\n", name, ms_since(start),
+              static_cast<unsigned long long>(sum));
+}
+
+int main() {
+  std::printf("%d requests, a map of %d keys each\n", kRequests, kKeys);
+  run("std::map", [](std::pmr::memory_resource *) { return std::map<int, int>(); });
+  run("s21::map", [](std::pmr::memory_resource *) { return s21::map<int, int>(); });
+  run("std::pmr::map, monotonic_buffer_resource",
+      [](std::pmr::memory_resource *resource) { return std::pmr::map<int, int>(resource); });
+  run("s21::pmr::map, monotonic_buffer_resource",
+      [](std::pmr::memory_resource *resource) { return s21::pmr::map<int, int>(resource); });
+  return 0;
+}
@@ -0,0 +1,50 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_merge_all.hh"
+#include "../model/s21_set.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+static double ms_since(clock_type::time_point start) {
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start)
+      .count();
+}
+
+int main() {
+  constexpr std::size_t kParts = 256;
+  constexpr std::size_t kKeysPerPart = 8000;
+  std::vector<s21::set<std::uint32_t>> parts(kParts);
+  std::uint32_t state = 2463534242U;
+  for (auto &part : parts) {
+    for (std::size_t i = 0; i < kKeysPerPart; ++i) {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+      part.insert(state % 4000000);
+    }
+  }
+
+  std::printf("hardware threads: %u, %zu sets of %zu keys\n",
+              std::thread::hardware_concurrency(), kParts, kKeysPerPart);
+  {
+    std::vector<s21::set<std::uint32_t>> copies(parts);
+    auto start = clock_type::now();
+    s21::set<std::uint32_t> result;
+    for (auto &part : copies) {
+      result.merge(part);
+    }
+    std::printf("%-22s %10.1f ms (%zu keys)\n", "repeated merge", ms_since(start),
+                result.size());
+  }
+  for (unsigned threads = 1; threads <= 32; threads *= 2) {
+    auto start = clock_type::now();
+    s21::set<std::uint32_t> result = s21::merge_all(parts, threads);
+    std::printf("merge_all %2u threads   %10.1f ms (%zu keys)\n", threads,
+                ms_since(start), result.size());
+  }
+  return 0;
+}
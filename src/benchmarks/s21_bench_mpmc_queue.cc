@@ -0,0 +1,85 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_mpmc_queue.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::uint64_t kItems = 4000000;
+
+// the baseline: a std::queue behind one mutex
+class locked_queue {
+ public:
+  bool try_push(std::uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+    return true;
+  }
+  bool try_pop(std::uint64_t &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return false;
+    }
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::queue<std::uint64_t> queue_;
+};
+
+// pairs producers and consumers, returns million items per second
+template <typename Queue>
+static double run(Queue &queue, unsigned pairs) {
+  std::atomic<std::uint64_t> consumed(0);
+  std::vector<std::thread> threads;
+  auto start = clock_type::now();
+  for (unsigned p = 0; p < pairs; ++p) {
+    threads.emplace_back([&queue, p, pairs] {
+      for (std::uint64_t i = p; i < kItems; i += pairs) {
+        while (!queue.try_push(i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+    threads.emplace_back([&queue, &consumed] {
+      std::uint64_t value;
+      while (consumed.load(std::memory_order_relaxed) < kItems) {
+        if (queue.try_pop(value)) {
+          consumed.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  double seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+  return kItems / seconds / 1e6;
+}
+
+int main() {
+  std::printf("hardware threads: %u, %llu items\n",
+              std::thread::hardware_concurrency(),
+              static_cast<unsigned long long>(kItems));
+  std::printf("%16s %22s %22s\n", "prod+cons pairs", "mutex queue Mitems/s",
+              "mpmc_queue Mitems/s");
+  for (unsigned pairs = 1; pairs <= 16; pairs *= 2) {
+    locked_queue locked;
+    s21::mpmc_queue<std::uint64_t> mpmc(1 << 14);
+    double locked_rate = run(locked, pairs);
+    double mpmc_rate = run(mpmc, pairs);
+    std::printf("%16u %22.2f %22.2f\n", pairs, locked_rate, mpmc_rate);
+  }
+  return 0;
+}
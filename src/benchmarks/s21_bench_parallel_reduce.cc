@@ -0,0 +1,53 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../model/s21_map.hh"
+#include "../model/s21_parallel.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+static double ms_since(clock_type::time_point start) {
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start)
+      .count();
+}
+
+using map_type = s21::map<std::uint64_t, std::uint64_t>;
+
+static std::uint64_t add_mapped(std::uint64_t sum,
+                                const std::pair<const std::uint64_t, std::uint64_t> &value) {
+  return sum + value.second;
+}
+
+int main() {
+  constexpr std::uint64_t kEntries = 4000000;
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> input;
+  for (std::uint64_t i = 0; i < kEntries; ++i) {
+    input.emplace_back(i * 2654435761ULL % kEntries, i);
+  }
+  map_type m = map_type::build_parallel(input.begin(), input.end());
+
+  std::printf("hardware threads: %u, %llu entries\n",
+              std::thread::hardware_concurrency(),
+              static_cast<unsigned long long>(m.size()));
+  auto start = clock_type::now();
+  std::uint64_t sum = 0;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    sum = add_mapped(sum, *it);
+  }
+  std::printf("%-22s %10.1f ms (sum %llu)\n", "sequential iterator", ms_since(start),
+              static_cast<unsigned long long>(sum));
+  for (unsigned threads = 1; threads <= 32; threads *= 2) {
+    s21::thread_pool pool(threads);
+    start = clock_type::now();
+    sum = s21::parallel_reduce(
+        m, std::uint64_t{0}, add_mapped,
+        [](std::uint64_t lhs, std::uint64_t rhs) { return lhs + rhs; }, pool);
+    std::printf("parallel_reduce %2u thr %10.1f ms (sum %llu)\n", threads,
+                ms_since(start), static_cast<unsigned long long>(sum));
+  }
+  return 0;
+}
@@ -0,0 +1,130 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../model/s21_multiset.hh"
+#include "../model/s21_priority_queue.hh"
+
+using clock_type = std::chrono::steady_clock;
+using timer = std::pair<std::uint64_t, std::uint32_t>;  // deadline, id
+
+constexpr std::uint32_t kTimers = 100000;
+constexpr std::uint64_t kReschedules = 5000000;
+constexpr std::uint64_t kElements = 2000000;
+
+static double ms_since(clock_type::time_point start) {
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+}
+
+// kElements random pushes, then pops everything
+template <typename Queue>
+static void run_heap(const char *name) {
+  std::mt19937_64 random(47);
+  Queue queue;
+  auto start = clock_type::now();
+  for (std::uint64_t i = 0; i < kElements; ++i) {
+    queue.push(random());
+  }
+  double push = ms_since(start);
+  start = clock_type::now();
+  std::uint64_t sum = 0;
+  while (!queue.empty()) {
+    sum += queue.top() >> 32;
+    queue.pop();
+  }
+  std::printf("%-36s push %6.1f ms  pop %7.1f ms  (sum %llu)\n", name, push, ms_since(start),
+              static_cast<unsigned long long>(sum));
+}
+
+static void run_multiset_heap() {
+  std::mt19937_64 random(47);
+  s21::multiset<std::uint64_t> queue;
+  auto start = clock_type::now();
+  for (std::uint64_t i = 0; i < kElements; ++i) {
+    queue.insert(random());
+  }
+  double push = ms_since(start);
+  start = clock_type::now();
+  std::uint64_t sum = 0;
+  while (!queue.empty()) {
+    auto min = queue.begin();
+    sum += *min >> 32;
+    queue.erase(min);
+  }
+  std::printf("%-36s push %6.1f ms  pop %7.1f ms  (sum %llu)\n", "s21::multiset (min)", push,
+              ms_since(start), static_cast<unsigned long long>(sum));
+}
+
+/*
+  A timer queue: kTimers armed timers, each reschedule moves a random
+  timer to a new deadline, and every 16th step the earliest one fires
+  and is rearmed.
+*/
+template <std::size_t Arity>
+static void run_timers(const char *name) {
+  std::mt19937_64 random(4747);
+  s21::addressable_priority_queue<timer, std::greater<timer>, Arity> queue;
+  std::vector<typename decltype(queue)::handle> handles;
+  for (std::uint32_t id = 0; id < kTimers; ++id) {
+    handles.push_back(queue.push(timer(random() % 1000000, id)));
+  }
+  std::uint64_t now = 0;
+  auto start = clock_type::now();
+  for (std::uint64_t i = 0; i < kReschedules; ++i) {
+    if (i % 16 == 0) {
+      timer fired = queue.top();
+      now = fired.first;
+      queue.update(queue.top_handle(), timer(now + random() % 1000000, fired.second));
+    } else {
+      std::uint32_t id = random() % kTimers;
+      queue.update(handles[id], timer(now + random() % 1000000, id));
+    }
+  }
+  std::printf("%-36s %7.1f ms  (now %llu)\n", name, ms_since(start),
+              static_cast<unsigned long long>(now));
+}
+
+static void run_multiset_timers() {
+  std::mt19937_64 random(4747);
+  s21::multiset<timer> queue;
+  std::vector<s21::multiset<timer>::iterator> timers;
+  for (std::uint32_t id = 0; id < kTimers; ++id) {
+    timers.push_back(queue.insert(timer(random() % 1000000, id)));
+  }
+  std::uint64_t now = 0;
+  auto start = clock_type::now();
+  for (std::uint64_t i = 0; i < kReschedules; ++i) {
+    std::uint32_t id;
+    if (i % 16 == 0) {
+      timer fired = *queue.begin();
+      now = fired.first;
+      id = fired.second;
+    } else {
+      id = random() % kTimers;
+    }
+    queue.erase(timers[id]);
+    timers[id] = queue.insert(timer(now + random() % 1000000, id));
+  }
+  std::printf("%-36s %7.1f ms  (now %llu)\n", "s21::multiset erase + insert", ms_since(start),
+              static_cast<unsigned long long>(now));
+}
+
+int main() {
+  std::printf("%llu random pushes, then pops\n", static_cast<unsigned long long>(kElements));
+  run_heap<std::priority_queue<std::uint64_t>>("std::priority_queue (binary)");
+  run_heap<s21::priority_queue<std::uint64_t, std::less<std::uint64_t>, 2>>(
+      "s21::priority_queue, arity 2");
+  run_heap<s21::priority_queue<std::uint64_t>>("s21::priority_queue, arity 4");
+  run_multiset_heap();
+  std::printf("%llu reschedules over %u timers\n", static_cast<unsigned long long>(kReschedules),
+              kTimers);
+  run_multiset_timers();
+  run_timers<2>("addressable_priority_queue, arity 2");
+  run_timers<4>("addressable_priority_queue, arity 4");
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_rcu_set.hh"
+#include "../model/s21_set.hh"
+
+// One writer keeps inserting and erasing keys while the readers look
+// up random keys; reported is the total reader throughput.
+constexpr std::uint32_t kKeyRange = 1 << 18;
+constexpr auto kDuration = std::chrono::milliseconds(300);
+
+// s21::set behind a reader/writer lock, what the RCU set replaces
+class shared_locked_set {
+ public:
+  bool contains(std::uint32_t key) {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return set_.contains(key);
+  }
+  void insert(std::uint32_t key) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    set_.insert(key);
+  }
+  void erase(std::uint32_t key) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = set_.find(key);
+    if (it != set_.end()) {
+      set_.erase(it);
+    }
+  }
+
+ private:
+  std::shared_mutex mutex_;
+  s21::set<std::uint32_t> set_;
+};
+
+template <typename Set>
+static double run(Set& set, unsigned readers) {
+  for (std::uint32_t key = 0; key < kKeyRange; key += 2) {
+    set.insert(key);
+  }
+  std::atomic<bool> stop{false};
+  std::atomic<std::uint64_t> total{0};
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < readers; ++t) {
+    threads.emplace_back([&set, &stop, &total, t] {
+      std::uint32_t state = 2654435761U * (t + 1);
+      std::uint64_t ops = 0, hits = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        hits += set.contains(state % kKeyRange);
+        ++ops;
+      }
+      total += ops + (hits > ops);
+    });
+  }
+  std::thread writer([&set, &stop] {
+    std::uint32_t key = 1;
+    while (!stop.load(std::memory_order_relaxed)) {
+      set.insert(key);
+      set.erase(key);
+      key = (key + 2) % kKeyRange;
+      // a steady trickle of updates rather than a saturated writer
+      std::this_thread::yield();
+    }
+  });
+  std::this_thread::sleep_for(kDuration);
+  stop = true;
+  writer.join();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return total / std::chrono::duration<double>(kDuration).count() / 1e6;
+}
+
+int main() {
+  std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+  std::printf("%8s %22s %22s\n", "readers", "shared_mutex Mops/s",
+              "rcu_set Mops/s");
+  for (unsigned readers = 1; readers <= 64; readers *= 2) {
+    shared_locked_set locked;
+    s21::rcu_set<std::uint32_t> rcu;
+    double locked_rate = run(locked, readers);
+    double rcu_rate = run(rcu, readers);
+    std::printf("%8u %22.2f %22.2f\n", readers, locked_rate, rcu_rate);
+  }
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_map.hh"
+#include "../model/s21_seqlock_map.hh"
+
+// One writer keeps inserting and erasing keys while the readers look
+// up random keys; reported is the total reader throughput.
+constexpr std::uint32_t kKeyRange = 1 << 18;
+constexpr auto kDuration = std::chrono::milliseconds(300);
+
+// s21::map behind a reader/writer lock, what the seqlock replaces
+class shared_locked_map {
+ public:
+  bool contains(std::uint32_t key) {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+  void insert(std::uint32_t key, std::uint32_t value) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    map_.insert(key, value);
+  }
+  void erase(std::uint32_t key) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) {
+      map_.erase(it);
+    }
+  }
+
+ private:
+  std::shared_mutex mutex_;
+  s21::map<std::uint32_t, std::uint32_t> map_;
+};
+
+template <typename Map>
+static double run(Map& map, unsigned readers) {
+  for (std::uint32_t key = 0; key < kKeyRange; key += 2) {
+    map.insert(key, key);
+  }
+  std::atomic<bool> stop{false};
+  std::atomic<std::uint64_t> total{0};
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < readers; ++t) {
+    threads.emplace_back([&map, &stop, &total, t] {
+      std::uint32_t state = 2654435761U * (t + 1);
+      std::uint64_t ops = 0, hits = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        hits += map.contains(state % kKeyRange);
+        ++ops;
+      }
+      total += ops + (hits > ops);
+    });
+  }
+  std::thread writer([&map, &stop] {
+    std::uint32_t key = 1;
+    while (!stop.load(std::memory_order_relaxed)) {
+      map.insert(key, key);
+      map.erase(key);
+      key = (key + 2) % kKeyRange;
+      // a steady trickle of updates rather than a saturated writer
+      std::this_thread::yield();
+    }
+  });
+  std::this_thread::sleep_for(kDuration);
+  stop = true;
+  writer.join();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return total / std::chrono::duration<double>(kDuration).count() / 1e6;
+}
+
+int main() {
+  std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+  std::printf("%8s %22s %22s\n", "readers", "shared_mutex Mops/s",
+              "seqlock_map Mops/s");
+  for (unsigned readers = 1; readers <= 64; readers *= 2) {
+    shared_locked_map locked;
+    s21::seqlock_map<std::uint32_t, std::uint32_t> seqlock;
+    double locked_rate = run(locked, readers);
+    double seqlock_rate = run(seqlock, readers);
+    std::printf("%8u %22.2f %22.2f\n", readers, locked_rate, seqlock_rate);
+  }
+  return 0;
+}
@@ -0,0 +1,37 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "../model/s21_small_vector.hh"
+#include "../model/s21_vector.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::size_t kLists = 20000000;
+
+// builds kLists short temporary lists of 3 elements, as insert_many()
+// does with its results
+template <typename List>
+static void run(const char *name) {
+  auto start = clock_type::now();
+  std::uint64_t checksum = 0;
+  for (std::size_t i = 0; i < kLists; ++i) {
+    List list;
+    list.push_back(i);
+    list.push_back(i + 1);
+    list.push_back(i + 2);
+    checksum += list[i % 3];
+  }
+  double ms = std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+  std::printf("%-30s %8.1f ms (checksum %llu)\n", name, ms,
+              static_cast<unsigned long long>(checksum));
+}
+
+int main() {
+  std::printf("%zu lists of 3 elements\n", kLists);
+  run<std::vector<std::uint64_t>>("std::vector");
+  run<s21::vector<std::uint64_t>>("s21::vector");
+  run<s21::small_vector<std::uint64_t, 3>>("s21::small_vector<T, 3>");
+  return 0;
+}
@@ -0,0 +1,113 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_spsc_queue.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::uint64_t kRecords = 20000000;
+constexpr std::size_t kBatch = 64;
+
+// the baseline: a std::queue behind one mutex
+class locked_queue {
+ public:
+  bool try_push(std::uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+    return true;
+  }
+  bool try_pop(std::uint64_t &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return false;
+    }
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::queue<std::uint64_t> queue_;
+};
+
+static double rate(clock_type::time_point start) {
+  double seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+  return kRecords / seconds / 1e6;
+}
+
+template <typename Queue>
+static double run_single(Queue &queue) {
+  auto start = clock_type::now();
+  std::thread producer([&queue] {
+    for (std::uint64_t i = 0; i < kRecords;) {
+      if (queue.try_push(i)) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  std::uint64_t sum = 0;
+  for (std::uint64_t received = 0, value; received < kRecords;) {
+    if (queue.try_pop(value)) {
+      sum += value;
+      ++received;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  return rate(start) + (sum == 0);
+}
+
+static double run_batched(s21::spsc_queue<std::uint64_t, 4096> &queue) {
+  auto start = clock_type::now();
+  std::thread producer([&queue] {
+    std::vector<std::uint64_t> batch(kBatch);
+    for (std::uint64_t i = 0; i < kRecords;) {
+      std::size_t count = kRecords - i < kBatch ? kRecords - i : kBatch;
+      for (std::size_t j = 0; j < count; ++j) {
+        batch[j] = i + j;
+      }
+      auto rest = queue.push_batch(batch.begin(), batch.begin() + count);
+      std::size_t pushed = rest - batch.begin();
+      i += pushed;
+      if (pushed < count) {
+        std::this_thread::yield();
+      }
+    }
+  });
+  std::uint64_t sum = 0;
+  std::vector<std::uint64_t> batch(kBatch);
+  for (std::uint64_t received = 0; received < kRecords;) {
+    std::size_t count = queue.pop_batch(batch.begin(), kBatch);
+    for (std::size_t j = 0; j < count; ++j) {
+      sum += batch[j];
+    }
+    received += count;
+    if (count == 0) {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  return rate(start) + (sum == 0);
+}
+
+int main() {
+  std::printf("hardware threads: %u, %llu records\n",
+              std::thread::hardware_concurrency(),
+              static_cast<unsigned long long>(kRecords));
+  locked_queue locked;
+  std::printf("%-28s %8.1f Mrec/s\n", "mutex + std::queue", run_single(locked));
+  auto spsc = std::make_unique<s21::spsc_queue<std::uint64_t, 4096>>();
+  std::printf("%-28s %8.1f Mrec/s\n", "spsc_queue try_push/try_pop", run_single(*spsc));
+  std::printf("%-28s %8.1f Mrec/s\n", "spsc_queue batches of 64", run_batched(*spsc));
+  return 0;
+}
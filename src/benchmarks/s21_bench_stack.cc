@@ -0,0 +1,54 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <stack>
+#include <vector>
+
+#include "../model/s21_chunked_storage.hh"
+#include "../model/s21_stack.hh"
+#include "../model/s21_vector.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::uint64_t kFrames = 100000000;
+constexpr std::uint64_t kBatch = 4096;
+
+/*
+  A DFS that only descends: kFrames pushes, timed in batches of kBatch
+  so the worst batch shows the cost of a reallocation, then all pops.
+*/
+template <typename Stack>
+static void run(const char *name) {
+  Stack stack;
+  double worst = 0;
+  auto start = clock_type::now();
+  for (std::uint64_t i = 0; i < kFrames; i += kBatch) {
+    auto batch = clock_type::now();
+    for (std::uint64_t j = i; j < i + kBatch; ++j) {
+      stack.push(j);
+    }
+    double ms = std::chrono::duration<double, std::milli>(clock_type::now() - batch).count();
+    worst = ms > worst ? ms : worst;
+  }
+  double push = std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+  start = clock_type::now();
+  std::uint64_t sum = 0;
+  while (!stack.empty()) {
+    sum += stack.top();
+    stack.pop();
+  }
+  double pop = std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+  std::printf("%-34s push %7.1f ms (worst batch %7.2f ms)  pop %7.1f ms  (sum %llu)\n", name,
+              push, worst, pop, static_cast<unsigned long long>(sum));
+}
+
+int main() {
+  std::printf("%llu pushes, batches of %llu\n", static_cast<unsigned long long>(kFrames),
+              static_cast<unsigned long long>(kBatch));
+  run<std::stack<std::uint64_t, std::vector<std::uint64_t>>>("std::stack<std::vector>");
+  run<s21::stack<std::uint64_t, s21::vector<std::uint64_t>>>("s21::stack<s21::vector>");
+  run<s21::stack<std::uint64_t, s21::chunked_storage<std::uint64_t>>>(
+      "s21::stack<chunked_storage>");
+  run<s21::stack<std::uint64_t>>("s21::stack<deque>");
+  return 0;
+}
@@ -0,0 +1,71 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../model/s21_set.hh"
+#include "../model/s21_thread_pool.hh"
+
+using clock_type = std::chrono::steady_clock;
+using set_type = s21::set<std::uint64_t>;
+using range_type = decltype(std::declval<set_type &>().split_ranges(1))::value_type;
+
+static double ms_since(clock_type::time_point start) {
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start)
+      .count();
+}
+
+static std::uint64_t sum_range(const range_type &range) {
+  std::uint64_t sum = 0;
+  for (auto it = range.first; it != range.second; ++it) {
+    sum += *it;
+  }
+  return sum;
+}
+
+// forks the left half of the subtree ranges, works on the right half
+static std::uint64_t fork_join_sum(s21::thread_pool &pool,
+                                   const std::vector<range_type> &ranges,
+                                   std::size_t first, std::size_t last) {
+  if (last - first == 1) {
+    return sum_range(ranges[first]);
+  }
+  std::size_t middle = first + (last - first) / 2;
+  std::uint64_t left = 0;
+  std::uint64_t right = 0;
+  pool.fork_join([&] { right = fork_join_sum(pool, ranges, middle, last); },
+                 [&] { left = fork_join_sum(pool, ranges, first, middle); });
+  return left + right;
+}
+
+int main() {
+  constexpr std::uint64_t kNodes = 10000000;
+  std::vector<std::uint64_t> keys;
+  keys.reserve(kNodes);
+  for (std::uint64_t i = 0; i < kNodes; ++i) {
+    keys.push_back(i * 2654435761ULL % kNodes);
+  }
+  set_type tree = set_type::build_parallel(keys.begin(), keys.end());
+  keys = std::vector<std::uint64_t>();
+
+  std::printf("hardware threads: %u, rb_tree of %zu nodes\n",
+              std::thread::hardware_concurrency(), tree.size());
+  auto start = clock_type::now();
+  std::uint64_t sum = 0;
+  for (auto it = tree.begin(); it != tree.end(); ++it) {
+    sum += *it;
+  }
+  std::printf("%-24s %10.1f ms (sum %llu)\n", "sequential iterator", ms_since(start),
+              static_cast<unsigned long long>(sum));
+  for (unsigned threads = 1; threads <= 32; threads *= 2) {
+    s21::thread_pool pool(threads);
+    auto ranges = tree.split_ranges(threads * 16);
+    start = clock_type::now();
+    sum = fork_join_sum(pool, ranges, 0, ranges.size());
+    std::printf("fork_join %2u threads     %10.1f ms (sum %llu)\n", threads,
+                ms_since(start), static_cast<unsigned long long>(sum));
+  }
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <list>
+
+#include "../model/s21_list.hh"
+#include "../model/s21_unrolled_list.hh"
+#include "../model/s21_vector.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::uint64_t kEvents = 1000000;
+constexpr int kScans = 50;
+
+static double ms_since(clock_type::time_point start) {
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+}
+
+/*
+  An event log: kEvents appended, then one pass that inserts a
+  correction after every 8th event, then kScans full scans.
+*/
+template <typename List>
+static void run(const char *name) {
+  List log;
+  auto start = clock_type::now();
+  for (std::uint64_t i = 0; i < kEvents; ++i) {
+    log.push_back(i);
+  }
+  double append = ms_since(start);
+  start = clock_type::now();
+  for (auto it = log.begin(); it != log.end(); ++it) {
+    if (*it % 8 == 0) {
+      it = log.insert(std::next(it), *it + 1);
+    }
+  }
+  double insert = ms_since(start);
+  start = clock_type::now();
+  std::uint64_t sum = 0;
+  for (int scan = 0; scan < kScans; ++scan) {
+    for (std::uint64_t value : log) {
+      sum += value;
+    }
+  }
+  std::printf("%-20s append %6.1f ms  insert %7.1f ms  scans %7.1f ms  (sum %llu)\n", name,
+              append, insert, ms_since(start), static_cast<unsigned long long>(sum));
+}
+
+// the scan alone over an array, as the floor
+static void run_vector() {
+  s21::vector<std::uint64_t> log;
+  for (std::uint64_t i = 0; i < kEvents + kEvents / 8; ++i) {
+    log.push_back(i);
+  }
+  auto start = clock_type::now();
+  std::uint64_t sum = 0;
+  for (int scan = 0; scan < kScans; ++scan) {
+    for (std::uint64_t value : log) {
+      sum += value;
+    }
+  }
+  std::printf("%-20s %50s %7.1f ms  (sum %llu)\n", "s21::vector", "scans", ms_since(start),
+              static_cast<unsigned long long>(sum));
+}
+
+int main() {
+  std::printf("%llu events, an insert after every 8th, %d scans\n",
+              static_cast<unsigned long long>(kEvents), kScans);
+  run<std::list<std::uint64_t>>("std::list");
+  run<s21::list<std::uint64_t>>("s21::list");
+  run<s21::unrolled_list<std::uint64_t>>("s21::unrolled_list");
+  run_vector();
+  return 0;
+}
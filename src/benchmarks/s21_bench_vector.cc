@@ -0,0 +1,65 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../model/s21_vector.hh"
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::size_t kInts = 50000000;
+constexpr std::size_t kStrings = 5000000;
+
+static double ms_since(clock_type::time_point start) {
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start)
+      .count();
+}
+
+// push_back of count elements without reserving, so every growth step
+// is timed
+template <typename Vector, typename Make>
+static void run(const char *name, std::size_t count, Make make) {
+  auto start = clock_type::now();
+  Vector vec;
+  for (std::size_t i = 0; i < count; ++i) {
+    vec.push_back(make(i));
+  }
+  double elapsed = ms_since(start);
+  std::printf("%-36s %9.1f ms (capacity %zu)\n", name, elapsed, vec.capacity());
+}
+
+// reserve() up front, then the unchecked push
+static void run_unchecked(std::size_t count) {
+  auto start = clock_type::now();
+  s21::vector<std::uint64_t> vec;
+  vec.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    vec.unchecked_push_back(i);
+  }
+  std::printf("%-36s %9.1f ms\n", "s21::vector reserve + unchecked", ms_since(start));
+  start = clock_type::now();
+  std::vector<std::uint64_t> std_vec;
+  std_vec.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    std_vec.push_back(i);
+  }
+  std::printf("%-36s %9.1f ms\n", "std::vector reserve + push_back", ms_since(start));
+}
+
+int main() {
+  auto make_int = [](std::size_t i) { return static_cast<std::uint64_t>(i); };
+  auto make_string = [](std::size_t i) { return std::to_string(i); };
+  std::printf("%zu uint64_t push_backs\n", kInts);
+  run<std::vector<std::uint64_t>>("std::vector", kInts, make_int);
+  run<s21::vector<std::uint64_t>>("s21::vector growth 2 (realloc)", kInts, make_int);
+  run<s21::vector<std::uint64_t, std::ratio<3, 2>>>("s21::vector growth 1.5 (realloc)", kInts,
+                                                    make_int);
+  run_unchecked(kInts);
+  std::printf("%zu std::string push_backs\n", kStrings);
+  run<std::vector<std::string>>("std::vector", kStrings, make_string);
+  run<s21::vector<std::string>>("s21::vector growth 2 (move)", kStrings, make_string);
+  run<s21::vector<std::string, std::ratio<3, 2>>>("s21::vector growth 1.5 (move)", kStrings,
+                                                  make_string);
+  return 0;
+}
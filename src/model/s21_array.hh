@@ -0,0 +1,308 @@
+#pragma once
+
+#include <algorithm>  // std::find
+#include <cstddef>    // std::size_t
+#include <cstring>    // std::memcmp, std::memcpy
+#include <initializer_list>
+#include <stdexcept>    // std::out_of_range
+#include <type_traits>  // std::is_arithmetic, std::is_integral, std::is_same
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+/*
+  Fixed-size array, usable in constant expressions.
+
+  Everything is constexpr, so tables can be computed at compile time:
+
+    constexpr auto squares = [] {
+      s21::array<int, 16> t;
+      for (std::size_t i = 0; i < t.size(); ++i) t[i] = i * i;
+      return t;
+    }();
+
+  At run time fill(), find() and operator== on arithmetic elements of
+  1, 2, 4 or 8 bytes run SSE2 kernels over 16 bytes at a time (the
+  compiler does not vectorize the early-exit loops of find and == on
+  its own), except where something else is faster: == on integers is a
+  memcmp, and find on 8-byte integers is std::find. Floating-point
+  elements are compared as values, so -0.0 equals 0.0 and NaN equals
+  nothing, as with the scalar loop.
+*/
+template <typename T, std::size_t N>
+class array {
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = std::size_t;
+
+ public:
+  /*
+      Member functions
+  */
+
+  // default ctor, value-initialized elements
+  constexpr array() : data_{} {}
+
+  // init-list ctor, the elements past the list value-initialized
+  constexpr array(std::initializer_list<value_type> const &items) : data_{} {
+    if (items.size() > N) {
+      throw std::out_of_range("Too many initializers for array");
+    }
+    size_type i = 0;
+    for (const value_type &value : items) {
+      data_[i++] = value;
+    }
+  }
+
+  // copy ctor
+  constexpr array(const array &a) = default;
+
+  // move ctor
+  constexpr array(array &&a) = default;
+
+  // destructor
+  ~array() = default;
+
+  // copy assigment
+  constexpr array &operator=(const array &other) = default;
+
+  // move assigment
+  constexpr array &operator=(array &&other) = default;
+
+  /*
+      Element access
+  */
+
+  constexpr reference at(size_type pos) {
+    check_index(pos);
+    return data_[pos];
+  }
+
+  constexpr const_reference at(size_type pos) const {
+    check_index(pos);
+    return data_[pos];
+  }
+
+  constexpr reference operator[](size_type pos) { return data_[pos]; }
+
+  constexpr const_reference operator[](size_type pos) const { return data_[pos]; }
+
+  constexpr reference front() { return data_[0]; }
+
+  constexpr const_reference front() const { return data_[0]; }
+
+  constexpr reference back() { return data_[N - 1]; }
+
+  constexpr const_reference back() const { return data_[N - 1]; }
+
+  constexpr T *data() { return data_; }
+
+  constexpr const T *data() const { return data_; }
+
+  /*
+      Iterators
+  */
+
+  constexpr iterator begin() { return data_; }
+
+  constexpr iterator end() { return data_ + N; }
+
+  constexpr const_iterator begin() const { return data_; }
+
+  constexpr const_iterator end() const { return data_ + N; }
+
+  /*
+      Capacity
+  */
+
+  constexpr bool empty() const { return N == 0; }
+
+  constexpr size_type size() const { return N; }
+
+  constexpr size_type max_size() const { return N; }
+
+  /*
+      Modifiers
+  */
+
+  constexpr void swap(array &other) {
+    for (size_type i = 0; i < N; ++i) {
+      value_type tmp(static_cast<value_type &&>(data_[i]));
+      data_[i] = static_cast<value_type &&>(other.data_[i]);
+      other.data_[i] = static_cast<value_type &&>(tmp);
+    }
+  }
+
+  constexpr void fill(const_reference value) {
+    if constexpr (kVectorized) {
+      if (!__builtin_is_constant_evaluated()) {
+        vector_fill(data_, value);
+        return;
+      }
+    }
+    for (size_type i = 0; i < N; ++i) {
+      data_[i] = value;
+    }
+  }
+
+  /*
+      Lookup
+  */
+
+  // the first element equal to value, end() if there is none
+  constexpr iterator find(const_reference value) { return data_ + index_of(value); }
+
+  constexpr const_iterator find(const_reference value) const {
+    return data_ + index_of(value);
+  }
+
+  constexpr bool contains(const_reference value) const { return index_of(value) != N; }
+
+  /*
+      Comparison
+  */
+
+  constexpr bool operator==(const array &other) const {
+    if constexpr (std::is_integral<T>::value) {
+      // integers are equal exactly when their bytes are
+      if (!__builtin_is_constant_evaluated()) {
+        return std::memcmp(data_, other.data_, sizeof(data_)) == 0;
+      }
+    } else if constexpr (kVectorized) {
+      if (!__builtin_is_constant_evaluated()) {
+        return vector_equal(data_, other.data_);
+      }
+    }
+    for (size_type i = 0; i < N; ++i) {
+      if (!(data_[i] == other.data_[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  constexpr bool operator!=(const array &other) const { return !(*this == other); }
+
+ private:
+#if defined(__SSE2__)
+  static constexpr bool kVectorized =
+      std::is_arithmetic<T>::value && (sizeof(T) == 1 || sizeof(T) == 2 ||
+                                       sizeof(T) == 4 || sizeof(T) == 8);
+#else
+  static constexpr bool kVectorized = false;
+#endif
+  // SSE2 has no 64-bit integer compare, and emulating it loses to the
+  // unrolled std::find
+  static constexpr bool kVectorizedFind =
+      kVectorized && !(std::is_integral<T>::value && sizeof(T) == 8);
+  static constexpr size_type kLanes = kVectorized ? 16 / sizeof(T) : 1;
+  // elements covered by whole 16-byte blocks
+  static constexpr size_type kBlocked = N / kLanes * kLanes;
+
+  constexpr void check_index(size_type pos) const {
+    if (pos >= N) {
+      throw std::out_of_range("No such element exists");
+    }
+  }
+
+  constexpr size_type index_of(const_reference value) const {
+    if (!__builtin_is_constant_evaluated()) {
+      if constexpr (kVectorizedFind) {
+        return vector_find(data_, value);
+      } else {
+        return std::find(data_, data_ + N, value) - data_;
+      }
+    }
+    size_type i = 0;
+    while (i < N && !(data_[i] == value)) {
+      ++i;
+    }
+    return i;
+  }
+
+#if defined(__SSE2__)
+  static __m128i load(const T *from) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(from));
+  }
+
+  // one bit per byte of the block, set where the lanes equal
+  static unsigned lanes_equal(__m128i lhs, __m128i rhs) {
+    if constexpr (std::is_same<T, float>::value) {
+      return static_cast<unsigned>(_mm_movemask_epi8(
+          _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(lhs), _mm_castsi128_ps(rhs)))));
+    } else if constexpr (std::is_same<T, double>::value) {
+      return static_cast<unsigned>(_mm_movemask_epi8(
+          _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(lhs), _mm_castsi128_pd(rhs)))));
+    } else if constexpr (sizeof(T) == 1) {
+      return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(lhs, rhs)));
+    } else if constexpr (sizeof(T) == 2) {
+      return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(lhs, rhs)));
+    } else {
+      // 8-byte integers never get here: == is a memcmp and find is std::find
+      static_assert(sizeof(T) == 4, "no SSE2 lane compare for this element size");
+      return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi32(lhs, rhs)));
+    }
+  }
+
+  static void vector_fill(T *data, const T &value) {
+    alignas(16) unsigned char pattern[16];
+    for (size_type lane = 0; lane < kLanes; ++lane) {
+      std::memcpy(pattern + lane * sizeof(T), &value, sizeof(T));
+    }
+    __m128i block = _mm_load_si128(reinterpret_cast<const __m128i *>(pattern));
+    for (size_type i = 0; i < kBlocked; i += kLanes) {
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(data + i), block);
+    }
+    for (size_type i = kBlocked; i < N; ++i) {
+      data[i] = value;
+    }
+  }
+
+  static bool vector_equal(const T *lhs, const T *rhs) {
+    for (size_type i = 0; i < kBlocked; i += kLanes) {
+      if (lanes_equal(load(lhs + i), load(rhs + i)) != 0xFFFFU) {
+        return false;
+      }
+    }
+    for (size_type i = kBlocked; i < N; ++i) {
+      if (!(lhs[i] == rhs[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static size_type vector_find(const T *data, const T &value) {
+    alignas(16) T pattern[kLanes];
+    for (size_type lane = 0; lane < kLanes; ++lane) {
+      pattern[lane] = value;
+    }
+    __m128i needle = _mm_load_si128(reinterpret_cast<const __m128i *>(pattern));
+    for (size_type i = 0; i < kBlocked; i += kLanes) {
+      unsigned mask = lanes_equal(load(data + i), needle);
+      if (mask) {
+        return i + static_cast<size_type>(__builtin_ctz(mask)) / sizeof(T);
+      }
+    }
+    size_type i = kBlocked;
+    while (i < N && !(data[i] == value)) {
+      ++i;
+    }
+    return i;
+  }
+#else
+  static void vector_fill(T *, const T &) {}
+  static bool vector_equal(const T *, const T *) { return true; }
+  static size_type vector_find(const T *, const T &) { return N; }
+#endif
+
+  value_type data_[N ? N : 1];
+};
+
+}  // namespace s21
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>  // std::sort
+#include <atomic>
+#include <cstddef>     // std::size_t
+#include <functional>  // std::plus, std::hash
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>  // std::pair, std::move
+#include <vector>
+
+#include "s21_epoch.hh"
+#include "s21_map.hh"
+
+namespace s21 {
+
+/*
+  Write-combining front end for a shared s21::map.
+
+  update(key, delta) never touches the shared map: it folds delta into a
+  hash table owned by the calling thread, where repeated updates of a hot
+  key cost one lookup and no shared cache line. A buffer is published
+  when it holds flush_threshold keys or when flush() is called: it is
+  moved out, sorted by key, and applied to the shared map in one pass
+  under a single exclusive lock.
+
+  The first update of a key stores delta as is, later ones store
+  combine(value, delta), so combine must be associative and commutative
+  (e.g. std::plus, or max). Lookups see published values only.
+*/
+template <typename Key, typename T, typename Combine = std::plus<T>,
+          typename Hash = std::hash<Key>>
+class buffered_map {
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = std::size_t;
+
+  using map_type = map<Key, T>;
+  using buffer_type = std::unordered_map<Key, T, Hash>;
+
+  // one buffer per thread index, its lock is only contended by flush()
+  struct alignas(64) slot {
+    std::mutex mutex_;
+    buffer_type buffer_;
+  };
+
+ public:
+  static constexpr size_type kDefaultFlushThreshold = 1 << 16;
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  explicit buffered_map(size_type flush_threshold = kDefaultFlushThreshold,
+                        Combine combine = Combine{})
+      : flush_threshold_(flush_threshold ? flush_threshold : 1), combine_(combine) {
+    for (std::atomic<slot *> &s : slots_) {
+      s.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  buffered_map(const buffered_map &) = delete;
+  buffered_map &operator=(const buffered_map &) = delete;
+
+  // destructor, unflushed updates are dropped
+  ~buffered_map() {
+    for (std::atomic<slot *> &s : slots_) {
+      delete s.load(std::memory_order_relaxed);
+    }
+  }
+
+  /*
+      Modifiers
+  */
+
+  // combines delta into the calling thread's buffer
+  void update(const key_type &key, const mapped_type &delta) {
+    slot &own = own_slot();
+    std::unique_lock<std::mutex> lock(own.mutex_);
+    auto found = own.buffer_.find(key);
+    if (found == own.buffer_.end()) {
+      own.buffer_.emplace(key, delta);
+    } else {
+      found->second = combine_(found->second, delta);
+    }
+    if (own.buffer_.size() >= flush_threshold_) {
+      // clear() keeps the buckets for the next round
+      std::vector<std::pair<Key, T>> updates(own.buffer_.begin(), own.buffer_.end());
+      own.buffer_.clear();
+      lock.unlock();
+      publish(updates);
+    }
+  }
+
+  // publishes the buffers of all threads in one batch
+  void flush() {
+    std::vector<std::pair<Key, T>> updates;
+    for (std::atomic<slot *> &s : slots_) {
+      slot *buffer = s.load(std::memory_order_acquire);
+      if (!buffer) {
+        continue;
+      }
+      std::lock_guard<std::mutex> lock(buffer->mutex_);
+      updates.insert(updates.end(), buffer->buffer_.begin(), buffer->buffer_.end());
+      buffer->buffer_.clear();
+    }
+    publish(updates);
+  }
+
+  /*
+      Lookup (published values)
+  */
+
+  std::optional<mapped_type> find(const key_type &key) const {
+    std::shared_lock<std::shared_mutex> lock(map_mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      return std::nullopt;
+    }
+    return (*it).second;
+  }
+
+  bool contains(const key_type &key) const {
+    std::shared_lock<std::shared_mutex> lock(map_mutex_);
+    return map_.contains(key);
+  }
+
+  size_type size() const {
+    std::shared_lock<std::shared_mutex> lock(map_mutex_);
+    return map_.size();
+  }
+
+  bool empty() const { return size() == 0; }
+
+  size_type flush_threshold() const { return flush_threshold_; }
+
+  // flushes and returns a copy of the shared map
+  map_type snapshot() {
+    flush();
+    std::shared_lock<std::shared_mutex> lock(map_mutex_);
+    return map_;
+  }
+
+ private:
+  slot &own_slot() {
+    std::atomic<slot *> &s = slots_[epoch_domain::thread_index()];
+    slot *buffer = s.load(std::memory_order_acquire);
+    if (!buffer) {
+      // only the owner of a thread index creates its slot
+      buffer = new slot;
+      s.store(buffer, std::memory_order_release);
+    }
+    return *buffer;
+  }
+
+  // sorts the updates, combines equal keys and applies them under one lock
+  void publish(std::vector<std::pair<Key, T>> &updates) {
+    if (updates.empty()) {
+      return;
+    }
+    std::sort(updates.begin(), updates.end(),
+              [](const std::pair<Key, T> &lhs, const std::pair<Key, T> &rhs) {
+                return lhs.first < rhs.first;
+              });
+    size_type kept = 0;
+    for (size_type i = 1; i < updates.size(); ++i) {
+      if (updates[kept].first < updates[i].first) {
+        updates[++kept] = std::move(updates[i]);
+      } else {
+        updates[kept].second = combine_(updates[kept].second, updates[i].second);
+      }
+    }
+    updates.erase(updates.begin() + kept + 1, updates.end());
+    std::unique_lock<std::shared_mutex> lock(map_mutex_);
+    for (const std::pair<Key, T> &update : updates) {
+      auto it = map_.find(update.first);
+      if (it == map_.end()) {
+        map_.insert(update.first, update.second);
+      } else {
+        (*it).second = combine_((*it).second, update.second);
+      }
+    }
+  }
+
+  const size_type flush_threshold_;
+  Combine combine_;
+  std::atomic<slot *> slots_[epoch_domain::kMaxThreads];
+  alignas(64) mutable std::shared_mutex map_mutex_;
+  mutable map_type map_;
+};
+
+}  // namespace s21
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <initializer_list>
+#include <new>      // operator new, placement new, std::align_val_t
+#include <utility>  // std::exchange, std::forward, std::move, std::swap
+
+namespace s21 {
+
+/*
+  Sequence that grows and shrinks at the back only, stored in a doubly
+  linked chain of chunks.
+
+  Each chunk is twice the size of the one before it (starting at one
+  page and capped at kMaxChunkBytes), so the number of allocations stays
+  logarithmic, but a full chunk is never reallocated: push_back() just
+  opens the next chunk. Elements therefore never move, references to
+  them stay valid until they are popped, and no push costs more than
+  one allocation.
+
+  Chunks emptied by pop_back() are kept for the next pushes (so pushing
+  and popping across a chunk boundary does not allocate every time)
+  until shrink_to_fit().
+*/
+template <typename T>
+class chunked_storage {
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  struct chunk {
+    chunk *prev_;
+    chunk *next_;
+    size_type capacity_;
+
+    T *begin() { return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(this) + kHeader); }
+
+    T *end() { return begin() + capacity_; }
+  };
+
+ public:
+  static constexpr size_type kMinChunkBytes = 4096;
+  static constexpr size_type kMaxChunkBytes = size_type(1) << 24;
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  chunked_storage()
+      : first_(nullptr), last_(nullptr), top_chunk_(nullptr), top_(nullptr),
+        limit_(nullptr), size_(0), capacity_(0) {}
+
+  // init-list ctor
+  chunked_storage(std::initializer_list<value_type> const &items) : chunked_storage() {
+    reserve(items.size());
+    for (const value_type &value : items) {
+      push_back(value);
+    }
+  }
+
+  // copy ctor
+  chunked_storage(const chunked_storage &other) : chunked_storage() {
+    reserve(other.size_);
+    other.for_each([this](const value_type &value) { push_back(value); });
+  }
+
+  // move ctor
+  chunked_storage(chunked_storage &&other) noexcept
+      : first_(std::exchange(other.first_, nullptr)),
+        last_(std::exchange(other.last_, nullptr)),
+        top_chunk_(std::exchange(other.top_chunk_, nullptr)),
+        top_(std::exchange(other.top_, nullptr)),
+        limit_(std::exchange(other.limit_, nullptr)),
+        size_(std::exchange(other.size_, 0)),
+        capacity_(std::exchange(other.capacity_, 0)) {}
+
+  // destructor
+  ~chunked_storage() {
+    clear();
+    release(first_);
+  }
+
+  // copy assigment
+  chunked_storage &operator=(const chunked_storage &other) {
+    if (this != &other) {
+      chunked_storage copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  // move assigment
+  chunked_storage &operator=(chunked_storage &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  /*
+      Element access
+  */
+
+  reference back() { return top_[-1]; }
+
+  const_reference back() const { return top_[-1]; }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  // elements that fit in the allocated chunks
+  size_type capacity() const { return capacity_; }
+
+  // makes room for count elements, the pushes up to there then allocate
+  // nothing
+  void reserve(size_type count) {
+    if (count > capacity_) {
+      size_type grown = last_ ? next_capacity(last_->capacity_) : first_capacity();
+      append(count - capacity_ > grown ? count - capacity_ : grown);
+    }
+  }
+
+  // frees the chunks above the top one
+  void shrink_to_fit() {
+    chunk *spare = top_chunk_ ? top_chunk_->next_ : first_;
+    if (!spare) {
+      return;
+    }
+    if (top_chunk_) {
+      top_chunk_->next_ = nullptr;
+    } else {
+      first_ = nullptr;
+    }
+    last_ = top_chunk_;
+    for (chunk *c = spare; c; c = c->next_) {
+      capacity_ -= c->capacity_;
+    }
+    release(spare);
+  }
+
+  /*
+      Modifiers
+  */
+
+  void clear() {
+    for_each([](value_type &value) { value.~value_type(); });
+    size_ = 0;
+    top_chunk_ = nullptr;
+    top_ = limit_ = nullptr;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    T *place = top_;
+    chunk *next = nullptr;
+    if (top_ == limit_) {
+      next = next_chunk();
+      place = next->begin();
+    }
+    new (place) value_type(std::forward<Args>(args)...);
+    // the top moves only once the element exists, so a throwing
+    // constructor leaves the new chunk as a spare
+    if (next) {
+      top_chunk_ = next;
+      limit_ = next->end();
+    }
+    top_ = place + 1;
+    ++size_;
+    return *place;
+  }
+
+  void pop_back() {
+    (--top_)->~value_type();
+    --size_;
+    // step down once the top chunk is empty, keeping it as a spare
+    if (top_ == top_chunk_->begin()) {
+      top_chunk_ = top_chunk_->prev_;
+      top_ = limit_ = top_chunk_ ? top_chunk_->end() : nullptr;
+    }
+  }
+
+  void swap(chunked_storage &other) noexcept {
+    std::swap(first_, other.first_);
+    std::swap(last_, other.last_);
+    std::swap(top_chunk_, other.top_chunk_);
+    std::swap(top_, other.top_);
+    std::swap(limit_, other.limit_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+ private:
+  static constexpr size_type kAlign = alignof(T) > alignof(chunk) ? alignof(T) : alignof(chunk);
+  // the elements start at the first multiple of alignof(T) past the header
+  static constexpr size_type kHeader = (sizeof(chunk) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+  static size_type first_capacity() {
+    return kMinChunkBytes / sizeof(T) ? kMinChunkBytes / sizeof(T) : 1;
+  }
+
+  static size_type next_capacity(size_type capacity) {
+    size_type max = kMaxChunkBytes / sizeof(T) ? kMaxChunkBytes / sizeof(T) : 1;
+    return 2 * capacity < max ? 2 * capacity : max;
+  }
+
+  // links a new chunk of capacity elements at the end of the chain
+  chunk *append(size_type capacity) {
+    void *memory = ::operator new(kHeader + capacity * sizeof(value_type), std::align_val_t(kAlign));
+    chunk *c = new (memory) chunk{last_, nullptr, capacity};
+    if (last_) {
+      last_->next_ = c;
+    } else {
+      first_ = c;
+    }
+    last_ = c;
+    capacity_ += capacity;
+    return c;
+  }
+
+  // the chunk above the top one, allocated if there is no spare
+  chunk *next_chunk() {
+    chunk *next = top_chunk_ ? top_chunk_->next_ : first_;
+    if (!next) {
+      next = append(top_chunk_ ? next_capacity(top_chunk_->capacity_) : first_capacity());
+    }
+    return next;
+  }
+
+  // frees c and the chunks after it
+  static void release(chunk *c) {
+    while (c) {
+      chunk *next = c->next_;
+      c->~chunk();
+      ::operator delete(c, std::align_val_t(kAlign));
+      c = next;
+    }
+  }
+
+  // calls f on every element, bottom to top
+  template <typename F>
+  void for_each(F f) const {
+    if (!top_chunk_) {
+      return;
+    }
+    for (chunk *c = first_;; c = c->next_) {
+      T *end = c == top_chunk_ ? top_ : c->end();
+      for (T *value = c->begin(); value != end; ++value) {
+        f(*value);
+      }
+      if (c == top_chunk_) {
+        return;
+      }
+    }
+  }
+
+  chunk *first_;
+  chunk *last_;
+  chunk *top_chunk_;  // the chunk holding back(), null when empty
+  T *top_;            // one past back()
+  T *limit_;          // end of the top chunk
+  size_type size_;
+  size_type capacity_;
+};
+
+}  // namespace s21
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <functional>  // std::hash
+#include <initializer_list>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>  // std::out_of_range
+#include <utility>    // std::move, std::pair
+#include <vector>
+
+#include "s21_map.hh"
+#include "s21_tournament_tree.hh"
+
+namespace s21 {
+
+/*
+  Thread-safe map striped over Shards independent s21::map instances.
+
+  A key always lives in shard shard_index(key): its hash is scrambled by
+  a Fibonacci multiply and the top bits pick the shard, so identity
+  hashes (std::hash of an integer) of strided or aligned keys still
+  spread over all shards. Every shard has its own reader/writer lock, so
+  operations on different shards never contend. Lookups take the shard
+  lock shared, modifications take it exclusive.
+
+  Nothing that points into a shard escapes its lock: lookups return copies
+  and in-place updates go through upsert(), which runs a callback under
+  the lock. Ordered traversal of the whole map is for_each(): it locks all
+  shards (always in index order, so it cannot deadlock with itself) and
+  merges their sorted sequences with a tournament tree.
+*/
+template <typename Key, typename T, std::size_t Shards = 16,
+          typename Hash = std::hash<Key>>
+class concurrent_map {
+  static_assert(Shards > 0, "concurrent_map needs at least one shard");
+
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  using map_type = map<Key, T>;
+
+  // one lock and one map per cache line
+  struct alignas(64) shard {
+    std::shared_mutex mutex_;
+    map_type map_;
+  };
+
+ public:
+  /*
+      Member functions
+  */
+
+  // default ctor
+  concurrent_map() = default;
+
+  // init-list ctor
+  concurrent_map(const std::initializer_list<value_type> &items) {
+    for (const value_type &value : items) {
+      insert(value);
+    }
+  }
+
+  concurrent_map(const concurrent_map &) = delete;
+  concurrent_map &operator=(const concurrent_map &) = delete;
+
+  // destructor
+  ~concurrent_map() = default;
+
+  /*
+      Element access
+  */
+
+  /*
+  @brief Returns a copy of the mapped value of the element with
+  specified key. If no such element exists, an exception of type
+  std::out_of_range is thrown.
+  */
+  mapped_type at(const key_type &key) const {
+    std::optional<mapped_type> value = find(key);
+    if (!value) {
+      throw std::out_of_range("No such element exists");
+    }
+    return *value;
+  }
+
+  /*
+      Capacity
+  */
+
+  // Sums the shards one by one, so under concurrent writes the result
+  // is only a recent approximation.
+  bool empty() const { return size() == 0; }
+
+  size_type size() const {
+    size_type total = 0;
+    for (shard &s : shards_) {
+      std::shared_lock<std::shared_mutex> lock(s.mutex_);
+      total += s.map_.size();
+    }
+    return total;
+  }
+
+  size_type max_size() const { return shards_[0].map_.max_size(); }
+
+  static constexpr size_type shard_count() { return Shards; }
+
+  // the shard key lives in
+  static size_type shard_index(const key_type &key) {
+    std::uint64_t mixed = static_cast<std::uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+    // the top 32 bits, scaled down to [0, Shards)
+    return static_cast<size_type>(((mixed >> 32) * Shards) >> 32);
+  }
+
+  /*
+      Modifiers
+  */
+
+  // clears the content, one shard at a time
+  void clear() {
+    for (shard &s : shards_) {
+      std::unique_lock<std::shared_mutex> lock(s.mutex_);
+      s.map_.clear();
+    }
+  }
+
+  // @return true if the insertion took place
+  bool insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+
+  // @return true if the insertion took place
+  bool insert(const key_type &key, const mapped_type &obj) {
+    shard &s = shard_for(key);
+    std::unique_lock<std::shared_mutex> lock(s.mutex_);
+    return s.map_.insert(key, obj).second;
+  }
+
+  // inserts an element or assigns to the current element if the key already exists
+  // @return true if the insertion took place and false if the assignment took place
+  bool insert_or_assign(const key_type &key, const mapped_type &obj) {
+    shard &s = shard_for(key);
+    std::unique_lock<std::shared_mutex> lock(s.mutex_);
+    return s.map_.insert_or_assign(key, obj).second;
+  }
+
+  /*
+  @brief Calls fn(mapped_type&) on the element with the given key while
+  holding its shard lock, default-constructing the element first if the
+  key is absent. fn must not access this map.
+  @return true if the element was inserted.
+  */
+  template <typename Fn>
+  bool upsert(const key_type &key, Fn fn) {
+    shard &s = shard_for(key);
+    std::unique_lock<std::shared_mutex> lock(s.mutex_);
+    auto it = s.map_.find(key);
+    bool inserted = it == s.map_.end();
+    if (inserted) {
+      it = s.map_.insert(key, mapped_type{}).first;
+    }
+    fn((*it).second);
+    return inserted;
+  }
+
+  // @return the number of elements removed (0 or 1)
+  size_type erase(const key_type &key) {
+    shard &s = shard_for(key);
+    std::unique_lock<std::shared_mutex> lock(s.mutex_);
+    auto it = s.map_.find(key);
+    if (it == s.map_.end()) {
+      return 0;
+    }
+    s.map_.erase(it);
+    return 1;
+  }
+
+  /*
+      Lookup
+  */
+
+  // a copy of the mapped value, or nothing if the key is absent
+  std::optional<mapped_type> find(const key_type &key) const {
+    shard &s = shard_for(key);
+    std::shared_lock<std::shared_mutex> lock(s.mutex_);
+    auto it = s.map_.find(key);
+    if (it == s.map_.end()) {
+      return std::nullopt;
+    }
+    return (*it).second;
+  }
+
+  bool contains(const key_type &key) const {
+    shard &s = shard_for(key);
+    std::shared_lock<std::shared_mutex> lock(s.mutex_);
+    return s.map_.contains(key);
+  }
+
+  /*
+      Iteration
+  */
+
+  /*
+  @brief Calls fn(const value_type&) for every element in key order.
+  All shards are locked shared for the duration, so the traversal sees
+  one consistent state; fn must not modify this map.
+  */
+  template <typename Fn>
+  void for_each(Fn fn) const {
+    std::vector<std::shared_lock<std::shared_mutex>> locks;
+    locks.reserve(Shards);
+    using map_iterator = decltype(shards_[0].map_.begin());
+    std::vector<std::pair<map_iterator, map_iterator>> heads;
+    for (shard &s : shards_) {
+      locks.emplace_back(s.mutex_);
+      if (!s.map_.empty()) {
+        heads.emplace_back(s.map_.begin(), s.map_.end());
+      }
+    }
+    // shards are disjoint, so the merged sequence is strictly increasing
+    auto key_less = [](const_reference lhs, const_reference rhs) {
+      return lhs.first < rhs.first;
+    };
+    tournament_tree<map_iterator, decltype(key_less)> tree(std::move(heads), key_less);
+    for (; !tree.empty(); tree.pop()) {
+      fn(static_cast<const_reference>(*tree.top()));
+    }
+  }
+
+  // ordered copy of the whole content taken under all shard locks
+  map_type snapshot() const {
+    map_type result;
+    for_each([&result](const_reference value) { result.insert(value); });
+    return result;
+  }
+
+ private:
+  shard &shard_for(const key_type &key) const {
+    return shards_[shard_index(key)];
+  }
+
+  mutable shard shards_[Shards];
+};
+
+}  // namespace s21
@@ -0,0 +1,439 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>           // std::uintptr_t
+#include <functional>        // std::less
+#include <initializer_list>  // std::initializer_list
+#include <iterator>          // std::forward_iterator_tag
+#include <limits>            // std::numeric_limits
+#include <new>               // placement new, std::launder
+#include <stdexcept>         // std::out_of_range
+#include <utility>           // std::pair
+#include <vector>
+
+#include "s21_epoch.hh"
+#include "s21_small_vector.hh"
+
+namespace s21 {
+
+/*
+  Ordered map that many threads may insert into, erase from and search
+  at the same time without locks.
+
+  It is a skip list whose links carry a "marked" bit in the lowest pointer
+  bit: erase marks every level of a node top-down (the level 0 mark is the
+  linearization point) and any traversal that meets a marked node snips
+  it out with a CAS. Unlinked nodes go to an epoch_domain, so traversals
+  never touch freed memory.
+
+  Mapped values are immutable once inserted. Iterators pin the epoch while
+  they exist, must stay on the thread that created them, and see a weakly
+  consistent view: every element present for the whole traversal is
+  visited exactly once, concurrent changes may or may not be seen.
+*/
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class concurrent_skiplist_map {
+ public:
+  // member types
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+ private:
+  static constexpr int kMaxLevel = 24;
+
+  using link = std::atomic<std::uintptr_t>;
+
+  // towers are allocated in one block: the node header followed by height_ links
+  struct node {
+    alignas(value_type) unsigned char storage_[sizeof(value_type)];
+    int height_;
+    // the inserting and the erasing thread both release the node,
+    // whoever comes last retires it
+    std::atomic<int> owners_;
+
+    explicit node(int height) : height_(height), owners_(2) {}
+
+    value_type &value() { return *std::launder(reinterpret_cast<value_type *>(storage_)); }
+    link *next() { return reinterpret_cast<link *>(this + 1); }
+  };
+
+  static node *ptr(std::uintptr_t word) {
+    return reinterpret_cast<node *>(word & ~std::uintptr_t{1});
+  }
+
+  static bool marked(std::uintptr_t word) { return word & 1; }
+
+  static std::uintptr_t pack(node *ptr, bool mark = false) {
+    return reinterpret_cast<std::uintptr_t>(ptr) | (mark ? 1 : 0);
+  }
+
+ public:
+  class iterator {
+    friend class concurrent_skiplist_map;
+    using value_type = concurrent_skiplist_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = const value_type &;
+    using pointer = const value_type *;
+    using iterator_category = std::forward_iterator_tag;
+
+    epoch_domain::guard guard_;  // keeps ptr_ alive
+    node *ptr_;
+
+    iterator(epoch_domain::guard guard, node *ptr) : guard_(std::move(guard)), ptr_(ptr) {}
+
+   public:
+    iterator() : ptr_(nullptr) {}
+
+    reference operator*() const { return ptr_->value(); }
+
+    pointer operator->() const { return &ptr_->value(); }
+
+    iterator &operator++() {
+      ptr_ = next_alive(ptr_);
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator old(*this);
+      ptr_ = next_alive(ptr_);
+      return old;
+    }
+
+    bool operator==(const iterator &other) const { return ptr_ == other.ptr_; }
+
+    bool operator!=(const iterator &other) const { return ptr_ != other.ptr_; }
+  };
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  concurrent_skiplist_map() : head_(make_head()), size_(0) {}
+
+  // init-list ctor
+  concurrent_skiplist_map(std::initializer_list<value_type> const &items)
+      : concurrent_skiplist_map() {
+    for (const value_type &value : items) {
+      insert(value);
+    }
+  }
+
+  concurrent_skiplist_map(const concurrent_skiplist_map &) = delete;
+  concurrent_skiplist_map &operator=(const concurrent_skiplist_map &) = delete;
+
+  // destructor, no other thread may access the map
+  ~concurrent_skiplist_map() {
+    clear();
+    ::operator delete(head_);
+  }
+
+  /*
+      Element access
+  */
+
+  /*
+  @brief Returns a copy of the mapped value of the element with
+  specified key. If no such element exists, an exception of type
+  std::out_of_range is thrown.
+  */
+  mapped_type at(const key_type &key) {
+    epoch_domain::guard guard(&epoch_);
+    node *found = lookup(key);
+    if (found == nullptr) {
+      throw std::out_of_range("No such element exists");
+    }
+    return found->value().second;
+  }
+
+  /*
+      Iterators
+  */
+
+  iterator begin() {
+    epoch_domain::guard guard(&epoch_);
+    node *first = next_alive(head_);
+    return iterator(std::move(guard), first);
+  }
+
+  iterator end() { return iterator(); }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size() == 0; }
+
+  // exact when no writer runs concurrently
+  size_type size() const { return size_.load(std::memory_order_relaxed); }
+
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / (sizeof(node) + 2 * sizeof(link));
+  }
+
+  /*
+      Modifiers
+  */
+
+  // clears the content, no other thread may access the map
+  void clear() {
+    node *curr = ptr(head_->next()[0].load(std::memory_order_relaxed));
+    while (curr != nullptr) {
+      node *next = ptr(curr->next()[0].load(std::memory_order_relaxed));
+      destroy_node(curr);
+      curr = next;
+    }
+    for (int level = 0; level < kMaxLevel; ++level) {
+      head_->next()[level].store(0, std::memory_order_relaxed);
+    }
+    size_.store(0, std::memory_order_relaxed);
+  }
+
+  // inserts value if the key is absent, returns iterator to the element
+  // with the key and bool denoting whether the insertion took place
+  std::pair<iterator, bool> insert(const value_type &value) {
+    epoch_domain::guard guard(&epoch_);
+    const key_type &key = value.first;
+    node *preds[kMaxLevel];
+    node *succs[kMaxLevel];
+    node *created = nullptr;
+    while (true) {
+      if (find(key, preds, succs)) {
+        if (created != nullptr) {
+          destroy_node(created);  // never published
+        }
+        return {iterator(std::move(guard), succs[0]), false};
+      }
+      if (created == nullptr) {
+        created = make_node(random_height(), value);
+      }
+      for (int level = 0; level < created->height_; ++level) {
+        created->next()[level].store(pack(succs[level]), std::memory_order_relaxed);
+      }
+      std::uintptr_t expected = pack(succs[0]);
+      if (preds[0]->next()[0].compare_exchange_strong(expected, pack(created),
+                                                      std::memory_order_release,
+                                                      std::memory_order_relaxed)) {
+        break;
+      }
+    }
+    size_.fetch_add(1, std::memory_order_relaxed);
+    link_upper_levels(created, preds, succs);
+    if (marked(created->next()[0].load(std::memory_order_acquire))) {
+      // erased while we were linking: snip whatever we linked meanwhile
+      find(key, preds, succs);
+    }
+    release(created);
+    return {iterator(std::move(guard), created), true};
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj) {
+    return insert(value_type{key, obj});
+  }
+
+  // erases element by key, returns number of erased elements
+  size_type erase(const key_type &key) {
+    epoch_domain::guard guard(&epoch_);
+    node *preds[kMaxLevel];
+    node *succs[kMaxLevel];
+    if (!find(key, preds, succs)) {
+      return 0;
+    }
+    node *victim = succs[0];
+    for (int level = victim->height_ - 1; level > 0; --level) {
+      std::uintptr_t succ = victim->next()[level].load(std::memory_order_acquire);
+      while (!marked(succ) &&
+             !victim->next()[level].compare_exchange_weak(succ, succ | 1, std::memory_order_acq_rel)) {
+      }
+    }
+    std::uintptr_t succ = victim->next()[0].load(std::memory_order_acquire);
+    while (!marked(succ)) {
+      if (victim->next()[0].compare_exchange_weak(succ, succ | 1, std::memory_order_acq_rel)) {
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        find(key, preds, succs);  // unlinks victim on every level
+        release(victim);
+        return 1;
+      }
+    }
+    return 0;  // another thread erased it first
+  }
+
+  // erases element at iterator
+  void erase(const iterator &it) {
+    if (it.ptr_ != nullptr) {
+      erase(it.ptr_->value().first);
+    }
+  }
+
+  /*
+      Lookup
+  */
+
+  // @brief Checks if there is an element with key equivalent to key.
+  // Never writes to shared memory.
+  bool contains(const key_type &key) {
+    epoch_domain::guard guard(&epoch_);
+    return lookup(key) != nullptr;
+  }
+
+  iterator find(const key_type &key) {
+    epoch_domain::guard guard(&epoch_);
+    node *found = lookup(key);
+    return found ? iterator(std::move(guard), found) : end();
+  }
+
+  size_type count(const key_type &key) { return contains(key) ? 1 : 0; }
+
+  /*
+      Insert many
+  */
+
+  template <typename... Args>
+  small_vector<std::pair<iterator, bool>, sizeof...(Args)> insert_many(Args &&...args) {
+    small_vector<std::pair<iterator, bool>, sizeof...(Args)> vec;
+    (vec.emplace_back(insert(std::forward<Args>(args))), ...);
+    return vec;
+  }
+
+ private:
+  node *head_;
+  std::atomic<size_type> size_;
+  Compare cmp_{};
+  epoch_domain epoch_;
+
+  static node *allocate(int height) {
+    void *memory = ::operator new(sizeof(node) + height * sizeof(link));
+    node *created = new (memory) node(height);
+    for (int level = 0; level < height; ++level) {
+      new (created->next() + level) link(0);
+    }
+    return created;
+  }
+
+  static node *make_head() { return allocate(kMaxLevel); }
+
+  static node *make_node(int height, const value_type &value) {
+    node *created = allocate(height);
+    try {
+      new (created->storage_) value_type(value);
+    } catch (...) {
+      ::operator delete(created);
+      throw;
+    }
+    return created;
+  }
+
+  static void destroy_node(node *victim) {
+    victim->value().~value_type();
+    ::operator delete(victim);
+  }
+
+  static void destroy_erased(void *victim) { destroy_node(static_cast<node *>(victim)); }
+
+  void release(node *item) {
+    if (item->owners_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      epoch_.retire(item, &destroy_erased);
+    }
+  }
+
+  // geometric distribution with p = 1/2
+  static int random_height() {
+    thread_local std::uint32_t state =
+        0x9E3779B9u ^ static_cast<std::uint32_t>(epoch_domain::thread_index() * 0x85EBCA6Bu + 1);
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return 1 + __builtin_ctz(state | (1u << (kMaxLevel - 1)));
+  }
+
+  // first unmarked node after item on level 0
+  static node *next_alive(node *item) {
+    node *curr = ptr(item->next()[0].load(std::memory_order_acquire));
+    while (curr != nullptr && marked(curr->next()[0].load(std::memory_order_acquire))) {
+      curr = ptr(curr->next()[0].load(std::memory_order_acquire));
+    }
+    return curr;
+  }
+
+  // Fills preds/succs with the nodes around key on every level and snips
+  // marked nodes on the way. Returns whether succs[0] holds key.
+  bool find(const key_type &key, node **preds, node **succs) {
+  retry:
+    node *pred = head_;
+    for (int level = kMaxLevel - 1; level >= 0; --level) {
+      node *curr = ptr(pred->next()[level].load(std::memory_order_acquire));
+      while (curr != nullptr) {
+        std::uintptr_t succ = curr->next()[level].load(std::memory_order_acquire);
+        if (marked(succ)) {
+          std::uintptr_t expected = pack(curr);
+          if (!pred->next()[level].compare_exchange_strong(expected, pack(ptr(succ)),
+                                                           std::memory_order_acq_rel)) {
+            goto retry;
+          }
+          curr = ptr(succ);
+        } else if (cmp_(curr->value().first, key)) {
+          pred = curr;
+          curr = ptr(succ);
+        } else {
+          break;
+        }
+      }
+      preds[level] = pred;
+      succs[level] = curr;
+    }
+    return succs[0] != nullptr && !cmp_(key, succs[0]->value().first);
+  }
+
+  // read-only search, skips marked nodes instead of unlinking them
+  node *lookup(const key_type &key) {
+    node *pred = head_;
+    node *curr = nullptr;
+    for (int level = kMaxLevel - 1; level >= 0; --level) {
+      curr = ptr(pred->next()[level].load(std::memory_order_acquire));
+      while (curr != nullptr && cmp_(curr->value().first, key)) {
+        pred = curr;
+        curr = ptr(curr->next()[level].load(std::memory_order_acquire));
+      }
+    }
+    while (curr != nullptr && !cmp_(key, curr->value().first)) {
+      if (!marked(curr->next()[0].load(std::memory_order_acquire))) {
+        return curr;
+      }
+      curr = ptr(curr->next()[0].load(std::memory_order_acquire));
+    }
+    return nullptr;
+  }
+
+  // links the tower of a node already present on level 0
+  void link_upper_levels(node *created, node **preds, node **succs) {
+    const key_type &key = created->value().first;
+    for (int level = 1; level < created->height_; ++level) {
+      while (true) {
+        std::uintptr_t own = created->next()[level].load(std::memory_order_acquire);
+        if (marked(own)) {
+          return;
+        }
+        if (ptr(own) != succs[level] &&
+            !created->next()[level].compare_exchange_strong(own, pack(succs[level]),
+                                                            std::memory_order_acq_rel)) {
+          return;  // marked meanwhile
+        }
+        std::uintptr_t expected = pack(succs[level]);
+        if (preds[level]->next()[level].compare_exchange_strong(expected, pack(created),
+                                                                std::memory_order_release,
+                                                                std::memory_order_relaxed)) {
+          break;
+        }
+        if (!find(key, preds, succs) || succs[0] != created) {
+          return;
+        }
+      }
+    }
+  }
+};
+
+}  // namespace s21
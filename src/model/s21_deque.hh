@@ -0,0 +1,440 @@
+#pragma once
+
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#include <cstdint>  // PTRDIFF_MAX
+#include <cstring>  // std::memmove
+#include <initializer_list>
+#include <iterator>   // std::random_access_iterator_tag
+#include <new>        // operator new, placement new, std::align_val_t
+#include <stdexcept>  // std::out_of_range
+#include <utility>    // std::exchange, std::forward, std::move, std::swap
+
+namespace s21 {
+
+/*
+  Double-ended queue stored in fixed-size blocks under a map of block
+  pointers.
+
+  Element i lives at the global position start_ + i, in block
+  (start_ + i) / kBlockSize of the map. Pushing at either end constructs
+  in place and at most allocates one block, so elements never move and
+  references to them stay valid until they are popped; only the map,
+  one pointer per block, is ever copied, when it is recentered or grown.
+
+  Blocks are a whole number of pages holding at least kMinBlockSize
+  elements. Blocks emptied at either end are kept for later pushes, and
+  a queue-like pattern (push at the back, pop at the front) recycles the
+  front block to the back, so it runs without allocating;
+  shrink_to_fit() frees the spares.
+*/
+template <typename T>
+class deque {
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+ public:
+  static constexpr size_type kPageSize = 4096;
+  static constexpr size_type kMinBlockSize = 16;
+  static constexpr size_type kBlockBytes =
+      (kMinBlockSize * sizeof(T) + kPageSize - 1) / kPageSize * kPageSize;
+  static constexpr size_type kBlockSize = kBlockBytes / sizeof(T);
+
+ private:
+  template <typename Deque, typename Value>
+  class deque_iterator {
+    friend class deque;
+
+   public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = Value &;
+    using pointer = Value *;
+    using iterator_category = std::random_access_iterator_tag;
+
+    deque_iterator() : deque_(nullptr), pos_(0) {}
+
+    deque_iterator(Deque *d, size_type pos) : deque_(d), pos_(pos) {}
+
+    // iterator to const_iterator
+    template <typename OtherDeque, typename OtherValue>
+    deque_iterator(const deque_iterator<OtherDeque, OtherValue> &other)
+        : deque_(other.deque_), pos_(other.pos_) {}
+
+    reference operator*() const { return (*deque_)[pos_]; }
+
+    pointer operator->() const { return &(*deque_)[pos_]; }
+
+    reference operator[](difference_type n) const { return (*deque_)[pos_ + n]; }
+
+    deque_iterator &operator++() {
+      ++pos_;
+      return *this;
+    }
+
+    deque_iterator operator++(int) {
+      deque_iterator old(*this);
+      ++pos_;
+      return old;
+    }
+
+    deque_iterator &operator--() {
+      --pos_;
+      return *this;
+    }
+
+    deque_iterator operator--(int) {
+      deque_iterator old(*this);
+      --pos_;
+      return old;
+    }
+
+    deque_iterator &operator+=(difference_type n) {
+      pos_ += n;
+      return *this;
+    }
+
+    deque_iterator &operator-=(difference_type n) {
+      pos_ -= n;
+      return *this;
+    }
+
+    deque_iterator operator+(difference_type n) const { return deque_iterator(deque_, pos_ + n); }
+
+    deque_iterator operator-(difference_type n) const { return deque_iterator(deque_, pos_ - n); }
+
+    difference_type operator-(const deque_iterator &other) const {
+      return static_cast<difference_type>(pos_) - static_cast<difference_type>(other.pos_);
+    }
+
+    bool operator==(const deque_iterator &other) const { return pos_ == other.pos_; }
+
+    bool operator!=(const deque_iterator &other) const { return pos_ != other.pos_; }
+
+    bool operator<(const deque_iterator &other) const { return pos_ < other.pos_; }
+
+   private:
+    template <typename, typename>
+    friend class deque_iterator;
+
+    Deque *deque_;
+    size_type pos_;  // index from front()
+  };
+
+ public:
+  using iterator = deque_iterator<deque, T>;
+  using const_iterator = deque_iterator<const deque, const T>;
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  deque()
+      : map_(nullptr), map_size_(0), block_lo_(0), block_hi_(0), start_(0), size_(0) {}
+
+  // init-list ctor
+  deque(std::initializer_list<value_type> const &items) : deque() {
+    for (const value_type &value : items) {
+      push_back(value);
+    }
+  }
+
+  // copy ctor
+  deque(const deque &d) : deque() {
+    for (size_type i = 0; i < d.size_; ++i) {
+      push_back(d[i]);
+    }
+  }
+
+  // move ctor
+  deque(deque &&d) noexcept
+      : map_(std::exchange(d.map_, nullptr)),
+        map_size_(std::exchange(d.map_size_, 0)),
+        block_lo_(std::exchange(d.block_lo_, 0)),
+        block_hi_(std::exchange(d.block_hi_, 0)),
+        start_(std::exchange(d.start_, 0)),
+        size_(std::exchange(d.size_, 0)) {}
+
+  // destructor
+  ~deque() {
+    clear();
+    for (size_type i = block_lo_; i < block_hi_; ++i) {
+      free_block(map_[i]);
+    }
+    delete[] map_;
+  }
+
+  // copy assigment
+  deque &operator=(const deque &other) {
+    if (this != &other) {
+      deque copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  // move assigment
+  deque &operator=(deque &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  /*
+      Element access
+  */
+
+  reference at(size_type pos) {
+    check_index(pos);
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    check_index(pos);
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) { return *slot(start_ + pos); }
+
+  const_reference operator[](size_type pos) const { return *slot(start_ + pos); }
+
+  reference front() { return *slot(start_); }
+
+  const_reference front() const { return *slot(start_); }
+
+  reference back() { return *slot(start_ + size_ - 1); }
+
+  const_reference back() const { return *slot(start_ + size_ - 1); }
+
+  /*
+      Iterators
+  */
+
+  iterator begin() { return iterator(this, 0); }
+
+  iterator end() { return iterator(this, size_); }
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+
+  const_iterator end() const { return const_iterator(this, size_); }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const { return static_cast<size_type>(PTRDIFF_MAX) / sizeof(value_type); }
+
+  // size() plus the elements push_back() can add without allocating
+  size_type capacity() const { return block_hi_ * kBlockSize - start_; }
+
+  // allocates the blocks for count elements from the front, so the
+  // push_back() calls up to there allocate nothing
+  void reserve(size_type count) {
+    while (capacity() < count) {
+      add_back_block();
+    }
+  }
+
+  // frees the blocks holding no element
+  void shrink_to_fit() {
+    size_type first = size_ ? start_ / kBlockSize : block_hi_;
+    size_type last = size_ ? (start_ + size_ - 1) / kBlockSize + 1 : block_hi_;
+    for (; block_lo_ < first; ++block_lo_) {
+      free_block(std::exchange(map_[block_lo_], nullptr));
+    }
+    for (; block_hi_ > last; --block_hi_) {
+      free_block(std::exchange(map_[block_hi_ - 1], nullptr));
+    }
+    if (!size_) {
+      start_ = block_lo_ * kBlockSize;
+    }
+  }
+
+  /*
+      Modifiers
+  */
+
+  void clear() {
+    while (size_) {
+      pop_back();
+    }
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (start_ + size_ == block_hi_ * kBlockSize) {
+      add_back_block();
+    }
+    T *place = slot(start_ + size_);
+    new (place) value_type(std::forward<Args>(args)...);
+    ++size_;
+    return *place;
+  }
+
+  void push_front(const_reference value) { emplace_front(value); }
+
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    if (start_ == block_lo_ * kBlockSize) {
+      add_front_block();
+    }
+    T *place = slot(start_ - 1);
+    new (place) value_type(std::forward<Args>(args)...);
+    --start_;
+    ++size_;
+    return *place;
+  }
+
+  void pop_back() {
+    --size_;
+    slot(start_ + size_)->~value_type();
+  }
+
+  void pop_front() {
+    slot(start_)->~value_type();
+    ++start_;
+    --size_;
+    if (start_ % kBlockSize == 0) {
+      recycle_front_block();
+    }
+  }
+
+  void swap(deque &other) noexcept {
+    std::swap(map_, other.map_);
+    std::swap(map_size_, other.map_size_);
+    std::swap(block_lo_, other.block_lo_);
+    std::swap(block_hi_, other.block_hi_);
+    std::swap(start_, other.start_);
+    std::swap(size_, other.size_);
+  }
+
+  /*
+      Insert many
+  */
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+  // the arguments end up in order at the front
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    size_type count = sizeof...(args);
+    (emplace_back(std::forward<Args>(args)), ...);
+    // rotate the new elements from the back to the front, one at a time
+    for (size_type i = 0; i < count; ++i) {
+      emplace_front(std::move(back()));
+      pop_back();
+    }
+  }
+
+ private:
+  static constexpr size_type kMinMapSize = 8;
+
+  void check_index(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("No such element exists");
+    }
+  }
+
+  T *slot(size_type position) const {
+    return map_[position / kBlockSize] + position % kBlockSize;
+  }
+
+  static T *allocate_block() {
+    return static_cast<T *>(::operator new(kBlockBytes, std::align_val_t(alignof(T))));
+  }
+
+  static void free_block(T *block) { ::operator delete(block, std::align_val_t(alignof(T))); }
+
+  void add_back_block() {
+    if (block_hi_ == map_size_) {
+      remap();
+    }
+    map_[block_hi_++] = allocate_block();
+  }
+
+  void add_front_block() {
+    if (block_lo_ == 0) {
+      remap();
+    }
+    map_[--block_lo_] = allocate_block();
+  }
+
+  // the front block has just been emptied: moves it to the back as the
+  // next block to fill, unless a spare is already there. When the blocks
+  // have drifted to the end of the map it is recentered first, so the
+  // block is parked rather than freed and reallocated.
+  void recycle_front_block() {
+    size_type front = start_ / kBlockSize - 1;
+    if (front != block_lo_) {
+      return;  // spares before it, keep it as one more
+    }
+    size_type used_hi = size_ ? (start_ + size_ - 1) / kBlockSize + 1 : start_ / kBlockSize;
+    T *block = std::exchange(map_[block_lo_++], nullptr);
+    if (used_hi != block_hi_) {
+      free_block(block);
+      return;
+    }
+    if (block_hi_ == map_size_) {
+      remap();
+    }
+    map_[block_hi_++] = block;
+  }
+
+  /*
+    @brief Centers the allocated blocks in a map with free slots at both
+  ends: in place when the map is at most half full, otherwise in a map of
+  twice the size. Only block pointers are copied.
+  */
+  void remap() {
+    size_type count = block_hi_ - block_lo_;
+    size_type offset = start_ - block_lo_ * kBlockSize;
+    T **map = map_;
+    size_type map_size = map_size_;
+    if (!map_ || 2 * (count + 2) > map_size_) {
+      map_size = 2 * (count + 2) > kMinMapSize ? 2 * (count + 2) : kMinMapSize;
+      map = new T *[map_size]();
+    }
+    size_type lo = (map_size - count) / 2;
+    if (count) {
+      std::memmove(static_cast<void *>(map + lo), static_cast<void *>(map_ + block_lo_),
+                   count * sizeof(T *));
+    }
+    if (map == map_) {
+      for (size_type i = 0; i < map_size; ++i) {
+        if (i < lo || i >= lo + count) {
+          map[i] = nullptr;
+        }
+      }
+    } else {
+      delete[] map_;
+      map_ = map;
+      map_size_ = map_size;
+    }
+    block_lo_ = lo;
+    block_hi_ = lo + count;
+    start_ = lo * kBlockSize + offset;
+  }
+
+  T **map_;
+  size_type map_size_;
+  size_type block_lo_;  // allocated blocks are map_[block_lo_, block_hi_)
+  size_type block_hi_;
+  size_type start_;  // global position of front()
+  size_type size_;
+};
+
+}  // namespace s21
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>    // std::uint64_t
+#include <stdexcept>  // std::length_error
+#include <utility>    // std::swap
+#include <vector>
+
+namespace s21 {
+
+/*
+  Epoch-based memory reclamation.
+
+  Readers pin the domain for the duration of a traversal. Writers unlink
+  a node first and then retire() it; the node is freed only once the
+  global epoch has advanced twice past the epoch of retirement, which
+  guarantees that every reader that could still hold a pointer to it has
+  unpinned in between.
+
+  Every thread owns one cache-line-sized record per domain, so pinning is
+  a store to a line no other thread writes. Retired pointers are kept in
+  the record of the retiring thread and freed in batches.
+*/
+class epoch_domain {
+ public:
+  using size_type = std::size_t;
+  using deleter_type = void (*)(void*);
+
+  static constexpr size_type kMaxThreads = 256;
+  static constexpr size_type kCollectThreshold = 64;
+
+  // RAII pin, must be destroyed on the thread that created it
+  class guard {
+   public:
+    guard() : domain_(nullptr) {}
+    explicit guard(epoch_domain* domain) : domain_(domain) {
+      if (domain_) {
+        domain_->pin();
+      }
+    }
+    guard(const guard& other) : guard(other.domain_) {}
+    guard(guard&& other) noexcept : domain_(other.domain_) {
+      other.domain_ = nullptr;
+    }
+    guard& operator=(const guard& other) {
+      guard copy(other);
+      std::swap(domain_, copy.domain_);
+      return *this;
+    }
+    guard& operator=(guard&& other) noexcept {
+      std::swap(domain_, other.domain_);
+      return *this;
+    }
+    ~guard() {
+      if (domain_) {
+        domain_->unpin();
+      }
+    }
+
+   private:
+    epoch_domain* domain_;
+  };
+
+  epoch_domain() : global_epoch_(0) {}
+  epoch_domain(const epoch_domain&) = delete;
+  epoch_domain& operator=(const epoch_domain&) = delete;
+
+  // frees everything still retired, no thread may be pinned
+  ~epoch_domain() {
+    for (record& rec : records_) {
+      for (const retired& item : rec.retired_) {
+        item.deleter_(item.ptr_);
+      }
+    }
+  }
+
+  guard pin_guard() { return guard(this); }
+
+  // announces that the calling thread may read shared nodes
+  void pin() {
+    record& rec = records_[thread_index()];
+    if (rec.nesting_++ == 0) {
+      std::uint64_t epoch = global_epoch_.load(std::memory_order_relaxed);
+      rec.epoch_.store((epoch << 1) | 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+  }
+
+  void unpin() {
+    record& rec = records_[thread_index()];
+    if (--rec.nesting_ == 0) {
+      rec.epoch_.store(0, std::memory_order_release);
+    }
+  }
+
+  // hands an unlinked pointer over for deferred deletion
+  void retire(void* ptr, deleter_type deleter) {
+    record& rec = records_[thread_index()];
+    rec.retired_.push_back(
+        retired{ptr, deleter, global_epoch_.load(std::memory_order_acquire)});
+    if (rec.retired_.size() >= kCollectThreshold) {
+      collect();
+    }
+  }
+
+  // advances the epoch if possible and frees what became safe
+  void collect() {
+    try_advance();
+    record& rec = records_[thread_index()];
+    std::uint64_t epoch = global_epoch_.load(std::memory_order_acquire);
+    size_type kept = 0;
+    for (size_type i = 0; i < rec.retired_.size(); ++i) {
+      if (rec.retired_[i].epoch_ + 2 <= epoch) {
+        rec.retired_[i].deleter_(rec.retired_[i].ptr_);
+      } else {
+        rec.retired_[kept++] = rec.retired_[i];
+      }
+    }
+    rec.retired_.resize(kept);
+  }
+
+  std::uint64_t epoch() const {
+    return global_epoch_.load(std::memory_order_acquire);
+  }
+
+  /// @brief Small dense id of the calling thread, reused after it exits.
+  static size_type thread_index() {
+    thread_local thread_slot slot;
+    return slot.index_;
+  }
+
+ private:
+  struct retired {
+    void* ptr_;
+    deleter_type deleter_;
+    std::uint64_t epoch_;
+  };
+
+  // epoch_ is (epoch << 1) | 1 while pinned and 0 otherwise
+  struct alignas(64) record {
+    std::atomic<std::uint64_t> epoch_{0};
+    size_type nesting_ = 0;
+    std::vector<retired> retired_;
+  };
+
+  struct thread_slot {
+    size_type index_;
+    thread_slot() : index_(0) {
+      while (index_ < kMaxThreads) {
+        bool expected = false;
+        if (slots_in_use()[index_].compare_exchange_strong(expected, true)) {
+          return;
+        }
+        ++index_;
+      }
+      throw std::length_error("epoch_domain: too many threads");
+    }
+    ~thread_slot() {
+      slots_in_use()[index_].store(false, std::memory_order_release);
+    }
+  };
+
+  static std::atomic<bool>* slots_in_use() {
+    static std::atomic<bool> in_use[kMaxThreads] = {};
+    return in_use;
+  }
+
+  // the epoch moves on once every pinned thread has observed it
+  void try_advance() {
+    std::uint64_t epoch = global_epoch_.load(std::memory_order_acquire);
+    for (const record& rec : records_) {
+      std::uint64_t local = rec.epoch_.load(std::memory_order_acquire);
+      if ((local & 1) && (local >> 1) != epoch) {
+        return;
+      }
+    }
+    global_epoch_.compare_exchange_strong(epoch, epoch + 1,
+                                          std::memory_order_acq_rel);
+  }
+
+  alignas(64) std::atomic<std::uint64_t> global_epoch_;
+  record records_[kMaxThreads];
+};
+
+}  // namespace s21
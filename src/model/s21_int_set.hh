@@ -0,0 +1,397 @@
+#pragma once
+
+#include <algorithm>         // std::fill
+#include <cstdint>           // std::uint64_t
+#include <initializer_list>  // std::initializer_list
+#include <iterator>          // std::bidirectional_iterator_tag
+#include <limits>            // std::numeric_limits
+#include <type_traits>       // std::is_unsigned
+#include <utility>           // std::pair
+#include <vector>
+
+#include "s21_small_vector.hh"
+
+namespace s21 {
+
+/*
+  Ordered set of unsigned integers stored as a hierarchical bitset.
+
+  Level 0 keeps one bit per possible key, every next level keeps one bit
+  per word of the level below ("this word is not empty"). The top level is
+  always a single word, so for 32-bit keys there are at most 6 levels and
+  insert/erase/contains as well as successor/predecessor searches touch at
+  most one word per level.
+
+  The universe grows on demand to cover the largest inserted key,
+  so the memory footprint is about max_key / 8 bytes regardless of size().
+*/
+template <typename Key = std::uint32_t>
+class int_set {
+  static_assert(std::is_unsigned<Key>::value,
+                "int_set supports only unsigned integer keys");
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type;
+  using const_reference = value_type;
+  using size_type = std::size_t;
+
+ private:
+  using word_type = std::uint64_t;
+
+  static constexpr size_type kWordBits = 64;
+  static constexpr size_type kWordShift = 6;
+  static constexpr size_type kWordMask = kWordBits - 1;
+  static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+ public:
+  class iterator {
+    friend class int_set;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using reference = Key;
+    using pointer = const Key*;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    const int_set* set_;
+    size_type pos_;
+
+   public:
+    iterator() = delete;
+    iterator(const int_set* set, size_type pos) : set_(set), pos_(pos) {}
+
+    value_type operator*() const { return static_cast<value_type>(pos_); }
+
+    iterator operator++() {
+      pos_ = pos_ == npos ? npos : set_->next_set(pos_ + 1);
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator old(*this);
+      ++(*this);
+      return old;
+    }
+
+    // Decrementing end() yields the largest key.
+    iterator operator--() {
+      if (pos_ == npos) {
+        pos_ = set_->prev_set(set_->universe() - 1);
+      } else {
+        pos_ = pos_ == 0 ? npos : set_->prev_set(pos_ - 1);
+      }
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator old(*this);
+      --(*this);
+      return old;
+    }
+
+    bool operator==(const iterator& other) const {
+      return pos_ == other.pos_;
+    }
+
+    bool operator!=(const iterator& other) const {
+      return pos_ != other.pos_;
+    }
+  };
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  int_set() : levels_(1, std::vector<word_type>(1, 0)), size_(0) {}
+
+  // reserves room for keys in [0, universe) up front
+  explicit int_set(size_type universe) : int_set() { reserve(universe); }
+
+  // init-list ctor
+  int_set(std::initializer_list<value_type> const& items) : int_set() {
+    for (value_type value : items) {
+      insert(value);
+    }
+  }
+
+  // copy ctor
+  int_set(const int_set& other) = default;
+
+  // move ctor
+  int_set(int_set&& other) noexcept : int_set() { swap(other); }
+
+  // destructor
+  ~int_set() = default;
+
+  // copy assigment
+  int_set& operator=(const int_set& other) = default;
+
+  // move assigment
+  int_set& operator=(int_set&& other) noexcept {
+    clear();
+    swap(other);
+    return *this;
+  }
+
+  /*
+      Iterators
+  */
+
+  iterator begin() const { return iterator(this, next_set(0)); }
+
+  iterator end() const { return iterator(this, npos); }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    if (std::numeric_limits<Key>::digits <
+        std::numeric_limits<size_type>::digits) {
+      return static_cast<size_type>(std::numeric_limits<Key>::max()) + 1;
+    }
+    return npos;
+  }
+
+  // number of keys representable without growing
+  size_type universe() const { return levels_[0].size() * kWordBits; }
+
+  // grows the bitmap so that keys in [0, universe) never reallocate
+  void reserve(size_type universe) {
+    if (universe > this->universe()) {
+      grow((universe + kWordMask) >> kWordShift);
+    }
+  }
+
+  // bytes occupied by the bitmap words
+  size_type memory_usage() const {
+    size_type words = 0;
+    for (const auto& level : levels_) {
+      words += level.capacity();
+    }
+    return words * sizeof(word_type) + sizeof(*this);
+  }
+
+  /*
+      Modifiers
+  */
+
+  // clears the content, keeps the universe
+  void clear() {
+    for (auto& level : levels_) {
+      std::fill(level.begin(), level.end(), 0);
+    }
+    size_ = 0;
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    size_type pos = static_cast<size_type>(value);
+    if (pos >= universe()) {
+      size_type words = levels_[0].size() * 2;
+      size_type needed = (pos >> kWordShift) + 1;
+      grow(words > needed ? words : needed);
+    }
+    bool inserted = set_bit(pos);
+    if (inserted) {
+      ++size_;
+    }
+    return std::pair<iterator, bool>(iterator(this, pos), inserted);
+  }
+
+  // erases element at iterator
+  void erase(const iterator it) {
+    if (it.pos_ != npos && clear_bit(it.pos_)) {
+      --size_;
+    }
+  }
+
+  // erases key, returns number of erased elements
+  size_type erase(const key_type& key) {
+    size_type pos = static_cast<size_type>(key);
+    if (pos < universe() && clear_bit(pos)) {
+      --size_;
+      return 1;
+    }
+    return 0;
+  }
+
+  // swaps the contents
+  void swap(int_set& other) noexcept {
+    levels_.swap(other.levels_);
+    std::swap(size_, other.size_);
+  }
+
+  // unites with another set word by word
+  void merge(const int_set& other) {
+    reserve(other.universe());
+    size_ = 0;
+    for (size_type level = 0; level < levels_.size(); ++level) {
+      if (level < other.levels_.size()) {
+        for (size_type i = 0; i < other.levels_[level].size(); ++i) {
+          levels_[level][i] |= other.levels_[level][i];
+        }
+      } else {
+        // other is shallower, its whole content sits under bit 0
+        levels_[level][0] |= other.empty() ? 0 : 1;
+      }
+    }
+    for (word_type word : levels_[0]) {
+      size_ += __builtin_popcountll(word);
+    }
+  }
+
+  /*
+      Lookup
+  */
+
+  bool contains(const key_type& key) const {
+    size_type pos = static_cast<size_type>(key);
+    return pos < universe() && test_bit(0, pos);
+  }
+
+  iterator find(const key_type& key) const {
+    return contains(key) ? iterator(this, key) : end();
+  }
+
+  size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+  // first element that is not less than key
+  iterator lower_bound(const key_type& key) const {
+    return iterator(this, next_set(static_cast<size_type>(key)));
+  }
+
+  // first element that is greater than key
+  iterator upper_bound(const key_type& key) const {
+    size_type pos = static_cast<size_type>(key);
+    return iterator(this, pos == npos ? npos : next_set(pos + 1));
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type& key) const {
+    return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+  }
+
+  /*
+      Insert many
+  */
+
+  template <typename... Args>
+  small_vector<std::pair<iterator, bool>, sizeof...(Args)> insert_many(Args&&... args) {
+    small_vector<std::pair<iterator, bool>, sizeof...(Args)> vec;
+    (vec.emplace_back(insert(std::forward<Args>(args))), ...);
+    return vec;
+  }
+
+ private:
+  // levels_[0] is the key bitmap, levels_.back() is a single summary word
+  std::vector<std::vector<word_type>> levels_;
+  size_type size_;
+
+  bool test_bit(size_type level, size_type pos) const {
+    return (levels_[level][pos >> kWordShift] >> (pos & kWordMask)) & 1;
+  }
+
+  // sets key bit and propagates "non-empty" marks upwards
+  bool set_bit(size_type pos) {
+    if (test_bit(0, pos)) {
+      return false;
+    }
+    for (auto& level : levels_) {
+      word_type& word = level[pos >> kWordShift];
+      bool was_empty = word == 0;
+      word |= word_type{1} << (pos & kWordMask);
+      if (!was_empty) {
+        break;
+      }
+      pos >>= kWordShift;
+    }
+    return true;
+  }
+
+  // clears key bit and drops summary bits of words that became empty
+  bool clear_bit(size_type pos) {
+    if (!test_bit(0, pos)) {
+      return false;
+    }
+    for (auto& level : levels_) {
+      word_type& word = level[pos >> kWordShift];
+      word &= ~(word_type{1} << (pos & kWordMask));
+      if (word != 0) {
+        break;
+      }
+      pos >>= kWordShift;
+    }
+    return true;
+  }
+
+  // resizes level 0 to `words` words and rebuilds the summary levels
+  void grow(size_type words) {
+    levels_[0].resize(words, 0);
+    size_type level = 0;
+    while (levels_[level].size() > 1) {
+      size_type upper = (levels_[level].size() + kWordMask) >> kWordShift;
+      if (level + 1 == levels_.size()) {
+        // new top level: the old top word is bit 0 of the new one
+        levels_.emplace_back(upper, 0);
+        levels_[level + 1][0] = levels_[level][0] != 0 ? 1 : 0;
+      } else {
+        levels_[level + 1].resize(upper, 0);
+      }
+      ++level;
+    }
+  }
+
+  // smallest key >= pos or npos
+  size_type next_set(size_type pos) const {
+    for (size_type level = 0; level < levels_.size(); ++level) {
+      size_type idx = pos >> kWordShift;
+      if (idx >= levels_[level].size()) {
+        return npos;
+      }
+      word_type word = levels_[level][idx] & (~word_type{0} << (pos & kWordMask));
+      if (word != 0) {
+        pos = (idx << kWordShift) + __builtin_ctzll(word);
+        while (level > 0) {
+          --level;
+          pos = (pos << kWordShift) + __builtin_ctzll(levels_[level][pos]);
+        }
+        return pos;
+      }
+      pos = idx + 1;
+    }
+    return npos;
+  }
+
+  // largest key <= pos or npos
+  size_type prev_set(size_type pos) const {
+    if (pos >= universe()) {
+      pos = universe() - 1;
+    }
+    for (size_type level = 0; level < levels_.size(); ++level) {
+      size_type idx = pos >> kWordShift;
+      word_type word =
+          levels_[level][idx] & (~word_type{0} >> (kWordMask - (pos & kWordMask)));
+      if (word != 0) {
+        pos = (idx << kWordShift) + kWordMask - __builtin_clzll(word);
+        while (level > 0) {
+          --level;
+          pos = (pos << kWordShift) + kWordMask -
+                __builtin_clzll(levels_[level][pos]);
+        }
+        return pos;
+      }
+      if (idx == 0) {
+        return npos;
+      }
+      pos = idx - 1;
+    }
+    return npos;
+  }
+};
+
+}  // namespace s21
@@ -0,0 +1,309 @@
+#pragma once
+
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <cstring>     // std::memcpy
+#include <functional>  // std::less
+#include <iterator>    // std::bidirectional_iterator_tag
+#include <utility>     // std::exchange, std::pair, std::swap
+
+#include "s21_rb_tree.hh"
+
+namespace s21 {
+
+/*
+  The links that put an object into an intrusive_set, embedded in the
+  object as a member. An object can be in as many sets at once as it has
+  hooks, one set per hook.
+
+  Copying an object gives the copy unlinked hooks, and assigning to an
+  object keeps its own hooks, so objects holding hooks stay copyable.
+*/
+struct rb_hook {
+  rb_hook *parent_, *left_, *right_;
+  rb_tree_color color_;
+
+  rb_hook() : parent_(nullptr), left_(nullptr), right_(nullptr), color_(rb_tree_color::red) {}
+
+  rb_hook(const rb_hook &) : rb_hook() {}
+
+  rb_hook &operator=(const rb_hook &) { return *this; }
+
+  // whether the object is in a set through this hook
+  bool is_linked() const { return parent_ != nullptr; }
+};
+
+/*
+  Ordered set of objects of type T that are linked through their member
+  Hook (an rb_hook) instead of being copied into allocated nodes:
+
+    struct connection {
+      int id;
+      long deadline;
+      s21::rb_hook by_id, by_deadline;
+    };
+    s21::intrusive_set<connection, &connection::by_id, by_id_less> ids;
+
+  insert() and erase() never allocate and never throw, and erase() of an
+  element needs no lookup. The set does not own its elements: they must
+  outlive their membership, and must not change their keys while in the
+  set. The balancing is rb_tree's own, through rb_tree_algorithms.
+*/
+template <typename T, rb_hook T::*Hook, typename Compare = std::less<T>>
+class intrusive_set {
+  using key_type = T;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using tree_algorithms = rb_tree_algorithms<rb_hook>;
+
+ public:
+  class iterator {
+    friend class intrusive_set;
+
+   public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using pointer = T *;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    iterator() : ptr_(nullptr) {}
+
+    reference operator*() const { return *owner(ptr_); }
+
+    pointer operator->() const { return owner(ptr_); }
+
+    iterator &operator++() {
+      ptr_ = tree_algorithms::increment(ptr_);
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator old(*this);
+      ptr_ = tree_algorithms::increment(ptr_);
+      return old;
+    }
+
+    iterator &operator--() {
+      ptr_ = tree_algorithms::decrement(ptr_);
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator old(*this);
+      ptr_ = tree_algorithms::decrement(ptr_);
+      return old;
+    }
+
+    bool operator==(const iterator &other) const { return ptr_ == other.ptr_; }
+
+    bool operator!=(const iterator &other) const { return ptr_ != other.ptr_; }
+
+   private:
+    explicit iterator(rb_hook *ptr) : ptr_(ptr) {}
+
+    rb_hook *ptr_;
+  };
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  intrusive_set() : root_(nullptr), size_(0) { end_.parent_ = &end_; }
+
+  intrusive_set(const intrusive_set &) = delete;
+
+  // move ctor
+  intrusive_set(intrusive_set &&other) : intrusive_set() { swap(other); }
+
+  // destructor, unlinks the elements
+  ~intrusive_set() { clear(); }
+
+  intrusive_set &operator=(const intrusive_set &) = delete;
+
+  // move assigment
+  intrusive_set &operator=(intrusive_set &&other) {
+    clear();
+    swap(other);
+    return *this;
+  }
+
+  /*
+      Iterators
+  */
+
+  iterator begin() { return iterator(tree_algorithms::leftmost(&end_)); }
+
+  iterator end() { return iterator(&end_); }
+
+  // the iterator to value, which must be in the set
+  iterator iterator_to(reference value) { return iterator(&(value.*Hook)); }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  /*
+      Modifiers
+  */
+
+  // unlinks every element, in O(n) without rebalancing
+  void clear() {
+    rb_hook *x = root_;
+    while (x && x != &end_) {
+      if (x->left_) {
+        x = x->left_;
+      } else if (x->right_) {
+        x = x->right_;
+      } else {
+        rb_hook *parent = x->parent_;
+        tree_algorithms::unlink_leaf(x, root_, &end_);
+        x->parent_ = nullptr;
+        x = parent;
+      }
+    }
+    size_ = 0;
+  }
+
+  // links value in, unless an equivalent element is already there;
+  // value must not be in a set through Hook
+  std::pair<iterator, bool> insert(reference value) {
+    rb_hook *hook = &(value.*Hook);
+    rb_hook *parent = &end_;
+    rb_hook **slot = &root_;
+    while (*slot) {
+      parent = *slot;
+      if (cmp_(value, *owner(parent))) {
+        slot = &parent->left_;
+      } else if (cmp_(*owner(parent), value)) {
+        slot = &parent->right_;
+      } else {
+        return std::pair<iterator, bool>(iterator(parent), false);
+      }
+    }
+    link(hook, parent, slot);
+    return std::pair<iterator, bool>(iterator(hook), true);
+  }
+
+  // links value in after the elements equivalent to it
+  iterator multiinsert(reference value) {
+    rb_hook *hook = &(value.*Hook);
+    rb_hook *parent = &end_;
+    rb_hook **slot = &root_;
+    while (*slot) {
+      parent = *slot;
+      slot = cmp_(value, *owner(parent)) ? &parent->left_ : &parent->right_;
+    }
+    link(hook, parent, slot);
+    return iterator(hook);
+  }
+
+  void erase(iterator pos) {
+    rb_hook *hook = pos.ptr_;
+    if (hook == &end_) {
+      return;
+    }
+    tree_algorithms::erase(hook, root_, &end_);
+    hook->parent_ = nullptr;
+    --size_;
+  }
+
+  // unlinks value, which must be in the set, without looking it up
+  void erase(reference value) { erase(iterator_to(value)); }
+
+  void swap(intrusive_set &other) {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    adopt_root();
+    other.adopt_root();
+  }
+
+  /*
+      Lookup
+  */
+
+  iterator find(const key_type &key) {
+    iterator it = lower_bound(key);
+    return it != end() && !cmp_(key, *it) ? it : end();
+  }
+
+  bool contains(const key_type &key) { return find(key) != end(); }
+
+  // the first element not less than key
+  iterator lower_bound(const key_type &key) {
+    rb_hook *result = &end_;
+    for (rb_hook *curr = root_; curr;) {
+      if (cmp_(*owner(curr), key)) {
+        curr = curr->right_;
+      } else {
+        result = std::exchange(curr, curr->left_);
+      }
+    }
+    return iterator(result);
+  }
+
+  // the first element greater than key
+  iterator upper_bound(const key_type &key) {
+    rb_hook *result = &end_;
+    for (rb_hook *curr = root_; curr;) {
+      if (cmp_(key, *owner(curr))) {
+        result = std::exchange(curr, curr->left_);
+      } else {
+        curr = curr->right_;
+      }
+    }
+    return iterator(result);
+  }
+
+ private:
+  // The offset of Hook inside T. A pointer to data member holds exactly
+  // that offset under the Itanium C++ ABI (GCC, Clang) and the MSVC ABI
+  // for classes without virtual bases.
+  static std::ptrdiff_t hook_offset() {
+    static_assert(sizeof(Hook) == sizeof(std::ptrdiff_t),
+                  "pointer to data member is not a plain offset");
+    std::ptrdiff_t offset;
+    rb_hook T::*hook = Hook;
+    std::memcpy(&offset, &hook, sizeof(offset));
+    return offset;
+  }
+
+  static T *owner(rb_hook *hook) {
+    return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(hook) - hook_offset());
+  }
+
+  // hangs hook, as a new red leaf, in the empty slot of parent
+  void link(rb_hook *hook, rb_hook *parent, rb_hook **slot) {
+    hook->left_ = hook->right_ = nullptr;
+    hook->color_ = rb_tree_color::red;
+    if (parent == &end_) {
+      tree_algorithms::link_root(hook, root_, &end_);
+    } else {
+      hook->parent_ = parent;
+      *slot = hook;
+    }
+    tree_algorithms::insert_fixup(hook, root_, &end_);
+    ++size_;
+  }
+
+  // points the header and the root at each other again after a swap
+  void adopt_root() {
+    end_.left_ = end_.right_ = root_;
+    if (root_) {
+      root_->parent_ = &end_;
+    }
+  }
+
+  rb_hook end_;  // header, see rb_tree_algorithms
+  rb_hook *root_;
+  size_type size_;
+  Compare cmp_{};
+};
+
+}  // namespace s21
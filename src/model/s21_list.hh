@@ -0,0 +1,551 @@
+#pragma once
+
+#include <cstddef>           // std::size_t, std::ptrdiff_t
+#include <functional>        // std::less, std::equal_to
+#include <initializer_list>  // std::initializer_list
+#include <iterator>          // std::bidirectional_iterator_tag
+#include <limits>            // std::numeric_limits
+#include <memory>            // std::shared_ptr, std::make_shared
+#include <stdexcept>         // std::out_of_range
+#include <utility>           // std::forward, std::move, std::swap
+
+#include "s21_node_pool.hh"
+
+namespace s21 {
+
+/*
+  Doubly linked list around a sentinel node.
+
+  The sentinel lives inside the list object and closes the ring, so
+  inserting and erasing never test for the ends and end() is just the
+  sentinel. The size is counted, and all the relinking operations
+  (splice, merge, sort, reverse) move nodes rather than values and never
+  allocate.
+
+  Nodes come from a node_pool. Every list creates its own by default; to
+  splice nodes between lists in O(1) the lists must share one, passed to
+  the constructor (see make_pool()). Splicing between lists with
+  different pools still works, but then moves the values into new nodes
+  one by one.
+*/
+template <typename T>
+class list {
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  struct node_base {
+    node_base *prev_;
+    node_base *next_;
+  };
+
+  struct node : node_base {
+    template <typename... Args>
+    explicit node(Args &&...args) : value_(std::forward<Args>(args)...) {}
+
+    value_type value_;
+  };
+
+  template <typename Value>
+  class list_iterator {
+    friend class list;
+
+   public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = Value &;
+    using pointer = Value *;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    list_iterator() : ptr_(nullptr) {}
+
+    explicit list_iterator(node_base *ptr) : ptr_(ptr) {}
+
+    // iterator to const_iterator
+    template <typename Other>
+    list_iterator(const list_iterator<Other> &other) : ptr_(other.ptr_) {}
+
+    reference operator*() const { return static_cast<node *>(ptr_)->value_; }
+
+    pointer operator->() const { return &static_cast<node *>(ptr_)->value_; }
+
+    list_iterator &operator++() {
+      ptr_ = ptr_->next_;
+      return *this;
+    }
+
+    list_iterator operator++(int) {
+      list_iterator old(*this);
+      ptr_ = ptr_->next_;
+      return old;
+    }
+
+    list_iterator &operator--() {
+      ptr_ = ptr_->prev_;
+      return *this;
+    }
+
+    list_iterator operator--(int) {
+      list_iterator old(*this);
+      ptr_ = ptr_->prev_;
+      return old;
+    }
+
+    template <typename Other>
+    bool operator==(const list_iterator<Other> &other) const {
+      return ptr_ == other.ptr_;
+    }
+
+    template <typename Other>
+    bool operator!=(const list_iterator<Other> &other) const {
+      return ptr_ != other.ptr_;
+    }
+
+   private:
+    template <typename>
+    friend class list_iterator;
+
+    node_base *ptr_;
+  };
+
+ public:
+  using iterator = list_iterator<T>;
+  using const_iterator = list_iterator<const T>;
+  using pool_type = node_pool<node>;
+
+  // a pool to share between lists that splice nodes to each other
+  static std::shared_ptr<pool_type> make_pool() { return std::make_shared<pool_type>(); }
+
+  /*
+      Member functions
+  */
+
+  // default ctor, with a pool of its own
+  list() : list(make_pool()) {}
+
+  // takes its nodes from pool
+  explicit list(std::shared_ptr<pool_type> pool) : pool_(std::move(pool)), size_(0) {
+    head_.prev_ = head_.next_ = &head_;
+  }
+
+  // parameterized ctor, n value-initialized elements
+  explicit list(size_type n) : list() {
+    for (size_type i = 0; i < n; ++i) {
+      emplace_back();
+    }
+  }
+
+  // init-list ctor
+  list(std::initializer_list<value_type> const &items) : list() {
+    for (const value_type &value : items) {
+      push_back(value);
+    }
+  }
+
+  // copy ctor, with a pool of its own
+  list(const list &l) : list() {
+    for (const value_type &value : l) {
+      push_back(value);
+    }
+  }
+
+  // move ctor, the moved-from list keeps sharing the pool
+  list(list &&l) : list(l.pool_) { take_nodes(l); }
+
+  // destructor
+  ~list() { clear(); }
+
+  // copy assigment
+  list &operator=(const list &other) {
+    if (this != &other) {
+      list copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  // move assigment
+  list &operator=(list &&other) {
+    swap(other);
+    return *this;
+  }
+
+  std::shared_ptr<pool_type> pool() const { return pool_; }
+
+  /*
+      Element access
+  */
+
+  reference front() {
+    check_not_empty();
+    return value(head_.next_);
+  }
+
+  reference back() {
+    check_not_empty();
+    return value(head_.prev_);
+  }
+
+  const_reference front() const {
+    check_not_empty();
+    return value(head_.next_);
+  }
+
+  const_reference back() const {
+    check_not_empty();
+    return value(head_.prev_);
+  }
+
+  /*
+      Iterators
+  */
+
+  iterator begin() { return iterator(head_.next_); }
+
+  iterator end() { return iterator(&head_); }
+
+  const_iterator begin() const { return const_iterator(head_.next_); }
+
+  const_iterator end() const { return const_iterator(const_cast<node_base *>(&head_)); }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(node);
+  }
+
+  /*
+      Modifiers
+  */
+
+  void clear() {
+    node_base *current = head_.next_;
+    while (current != &head_) {
+      node_base *next = current->next_;
+      destroy(current);
+      current = next;
+    }
+    head_.prev_ = head_.next_ = &head_;
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) { return emplace(pos, value); }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    node_base *created = create(std::forward<Args>(args)...);
+    link_before(pos.ptr_, created, created);
+    ++size_;
+    return iterator(created);
+  }
+
+  // @return an iterator to the element after the erased one
+  iterator erase(const_iterator pos) {
+    node_base *next = pos.ptr_->next_;
+    unlink(pos.ptr_, pos.ptr_);
+    destroy(pos.ptr_);
+    --size_;
+    return iterator(next);
+  }
+
+  void push_back(const_reference value) { emplace(end(), value); }
+
+  void push_back(value_type &&value) { emplace(end(), std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  void pop_back() {
+    check_not_empty();
+    erase(const_iterator(head_.prev_));
+  }
+
+  void push_front(const_reference value) { emplace(begin(), value); }
+
+  void push_front(value_type &&value) { emplace(begin(), std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+  }
+
+  void pop_front() {
+    check_not_empty();
+    erase(begin());
+  }
+
+  void swap(list &other) {
+    list tmp(other.pool_);
+    tmp.take_nodes(other);
+    other.pool_ = pool_;
+    other.take_nodes(*this);
+    pool_ = tmp.pool_;
+    take_nodes(tmp);
+  }
+
+  /*
+  @brief Merges the sorted list other into this sorted list, leaving
+  other empty. The merge is stable: of equal elements those of this list
+  come first.
+  */
+  void merge(list &other) { merge(other, std::less<value_type>()); }
+
+  template <typename Less>
+  void merge(list &other, Less less) {
+    if (&other == this || other.empty()) {
+      return;
+    }
+    node_base *middle;
+    if (pool_ == other.pool_) {
+      middle = other.head_.next_;
+      splice(end(), other);
+    } else {
+      middle = move_nodes(other);
+    }
+    // the runs [begin, middle) and [middle, end), cut out of the ring
+    node_base *left = head_.next_ == middle ? nullptr : head_.next_;
+    head_.prev_->next_ = nullptr;
+    middle->prev_->next_ = nullptr;
+    relink(merge_runs(left, middle, less));
+  }
+
+  /*
+  @brief Moves all elements of other before pos, leaving other empty.
+  O(1) when both lists share a pool.
+  */
+  void splice(const_iterator pos, list &other) {
+    if (&other == this || other.empty()) {
+      return;
+    }
+    if (pool_ != other.pool_) {
+      node_base *first = move_nodes(other);
+      splice_range(pos.ptr_, first, head_.prev_);
+      return;
+    }
+    node_base *first = other.head_.next_;
+    node_base *last = other.head_.prev_;
+    other.unlink(first, last);
+    link_before(pos.ptr_, first, last);
+    size_ += other.size_;
+    other.size_ = 0;
+  }
+
+  // moves the element at it of other before pos
+  void splice(const_iterator pos, list &other, const_iterator it) {
+    if (pos.ptr_ == it.ptr_ || pos.ptr_ == it.ptr_->next_) {
+      return;
+    }
+    if (pool_ != other.pool_) {
+      emplace(pos, std::move(*iterator(it.ptr_)));
+      other.erase(it);
+      return;
+    }
+    other.unlink(it.ptr_, it.ptr_);
+    link_before(pos.ptr_, it.ptr_, it.ptr_);
+    --other.size_;
+    ++size_;
+  }
+
+  void reverse() {
+    node_base *current = &head_;
+    do {
+      std::swap(current->prev_, current->next_);
+      current = current->prev_;
+    } while (current != &head_);
+  }
+
+  // removes consecutive duplicate elements
+  void unique() {
+    for (node_base *current = head_.next_; current != &head_;) {
+      node_base *next = current->next_;
+      if (next != &head_ && value(next) == value(current)) {
+        erase(const_iterator(next));
+      } else {
+        current = next;
+      }
+    }
+  }
+
+  // stable merge sort that relinks the nodes, O(n log n), no allocation
+  void sort() { sort(std::less<value_type>()); }
+
+  template <typename Less>
+  void sort(Less less) {
+    if (size_ < 2) {
+      return;
+    }
+    head_.prev_->next_ = nullptr;
+    // bins_[i] is a sorted run of 2^i nodes or empty, as in a binary
+    // counter; each node is carried in and merged upward
+    node_base *bins[64] = {};
+    node_base *current = head_.next_;
+    while (current) {
+      node_base *run = current;
+      current = current->next_;
+      run->next_ = nullptr;
+      size_type i = 0;
+      for (; bins[i]; ++i) {
+        run = merge_runs(bins[i], run, less);
+        bins[i] = nullptr;
+      }
+      bins[i] = run;
+    }
+    node_base *sorted = nullptr;
+    for (node_base *bin : bins) {
+      if (bin) {
+        sorted = merge_runs(bin, sorted, less);
+      }
+    }
+    relink(sorted);
+  }
+
+  /*
+      Insert many
+  */
+
+  // inserts the arguments, in order, before pos, returns an iterator to
+  // the last of them
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    iterator last(pos.ptr_->prev_);
+    ((last = emplace(pos, std::forward<Args>(args))), ...);
+    return last;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace(end(), std::forward<Args>(args)), ...);
+  }
+
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    insert_many(begin(), std::forward<Args>(args)...);
+  }
+
+ private:
+  static reference value(node_base *n) { return static_cast<node *>(n)->value_; }
+
+  static const_reference value(const node_base *n) {
+    return static_cast<const node *>(n)->value_;
+  }
+
+  void check_not_empty() const {
+    if (size_ == 0) {
+      throw std::out_of_range("List is empty");
+    }
+  }
+
+  template <typename... Args>
+  node_base *create(Args &&...args) {
+    void *storage = pool_->allocate();
+    try {
+      return new (storage) node(std::forward<Args>(args)...);
+    } catch (...) {
+      pool_->deallocate(storage);
+      throw;
+    }
+  }
+
+  void destroy(node_base *n) {
+    static_cast<node *>(n)->~node();
+    pool_->deallocate(n);
+  }
+
+  // links the chain first..last before pos
+  static void link_before(node_base *pos, node_base *first, node_base *last) {
+    first->prev_ = pos->prev_;
+    last->next_ = pos;
+    pos->prev_->next_ = first;
+    pos->prev_ = last;
+  }
+
+  // cuts the chain first..last out of the ring
+  static void unlink(node_base *first, node_base *last) {
+    first->prev_->next_ = last->next_;
+    last->next_->prev_ = first->prev_;
+  }
+
+  // moves the chain first..last, already in this list, before pos
+  void splice_range(node_base *pos, node_base *first, node_base *last) {
+    if (pos == first || pos == last->next_) {
+      return;
+    }
+    unlink(first, last);
+    link_before(pos, first, last);
+  }
+
+  // appends the values of other, from another pool, in new nodes of this
+  // one, returns the first of them
+  node_base *move_nodes(list &other) {
+    node_base *before = head_.prev_;
+    for (value_type &v : other) {
+      emplace(end(), std::move(v));
+    }
+    other.clear();
+    return before->next_;
+  }
+
+  // adopts the nodes of other, which shares the pool, this being empty
+  void take_nodes(list &other) {
+    if (other.empty()) {
+      return;
+    }
+    head_.next_ = other.head_.next_;
+    head_.prev_ = other.head_.prev_;
+    head_.next_->prev_ = &head_;
+    head_.prev_->next_ = &head_;
+    size_ = other.size_;
+    other.head_.prev_ = other.head_.next_ = &other.head_;
+    other.size_ = 0;
+  }
+
+  // merges two null-terminated runs linked by next_ only, stable
+  template <typename Less>
+  static node_base *merge_runs(node_base *left, node_base *right, Less &less) {
+    node_base merged;
+    node_base *tail = &merged;
+    while (left && right) {
+      if (less(value(right), value(left))) {
+        tail->next_ = right;
+        right = right->next_;
+      } else {
+        tail->next_ = left;
+        left = left->next_;
+      }
+      tail = tail->next_;
+    }
+    tail->next_ = left ? left : right;
+    return merged.next_;
+  }
+
+  // restores the prev_ links and the ring from a null-terminated chain
+  void relink(node_base *first) {
+    node_base *prev = &head_;
+    for (node_base *current = first; current; current = current->next_) {
+      prev->next_ = current;
+      current->prev_ = prev;
+      prev = current;
+    }
+    prev->next_ = &head_;
+    head_.prev_ = prev;
+  }
+
+  std::shared_ptr<pool_type> pool_;
+  node_base head_;
+  size_type size_;
+};
+
+}  // namespace s21
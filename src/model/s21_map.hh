@@ -1,6 +1,7 @@
 #pragma once
 
-#include <memory>  // std::allocator
+#include <memory>           // std::allocator
+#include <memory_resource>  // std::pmr::polymorphic_allocator
 
 #include "s21_rb_tree.hh"
 namespace s21 {
@@ -8,7 +9,8 @@ namespace s21 {
 template <
     typename Key,
     typename T,
-    typename Compare = std::less<Key>>
+    typename Compare = std::less<Key>,
+    typename Allocator = std::allocator<std::pair<const Key, T>>>
 class map {
   // member types
   using key_type = Key;
@@ -23,12 +25,14 @@ class map {
       return lhs.first < rhs.first;
     }
   };
-  using tree_type = rb_tree<value_type, value_compare>;
+  using tree_type = rb_tree<value_type, value_compare, Allocator>;
 
-  using iterator = typename rb_tree<value_type, value_compare>::iterator;
+  using iterator = typename tree_type::iterator;
   using size_type = std::size_t;
 
  public:
+  using allocator_type = Allocator;
+
   /*
       Member functions
   */
@@ -36,8 +40,13 @@ class map {
   // default ctor
   map() = default;
 
+  // allocates its nodes with alloc
+  explicit map(const allocator_type &alloc) : tree_(alloc) {}
+
   // init-list ctor
-  map(const std::initializer_list<value_type> &items) {
+  map(const std::initializer_list<value_type> &items,
+      const allocator_type &alloc = allocator_type())
+      : tree_(alloc) {
     for (value_type value : items) {
       tree_.insert(value);
     }
@@ -65,6 +74,36 @@ class map {
     return *this;
   }
 
+  /*
+  @brief Builds a map from an unsorted range of key-value pairs in
+  O(n log n / threads): the pairs are sorted in parallel, only the first
+  pair of every key is kept and the tree is built in parallel, with no
+  per-element descent or fix-up. The nodes come from alloc.
+  */
+  template <typename InputIt>
+  static map build_parallel(InputIt first, InputIt last,
+                            unsigned threads = std::thread::hardware_concurrency(),
+                            const allocator_type &alloc = allocator_type()) {
+    map result(alloc);
+    result.tree_.build_parallel(first, last, threads);
+    return result;
+  }
+
+  // Builds a map from a range sorted by key in linear time, only the first
+  // pair of every key is kept. The nodes come from alloc.
+  template <typename ForwardIt>
+  static map from_sorted(ForwardIt first, ForwardIt last,
+                         unsigned threads = std::thread::hardware_concurrency(),
+                         const allocator_type &alloc = allocator_type()) {
+    map result(alloc);
+    result.tree_.assign_sorted(first, last, threads);
+    return result;
+  }
+
+  allocator_type get_allocator() const {
+    return tree_.get_allocator();
+  }
+
   /*
       Element access
   */
@@ -200,17 +239,39 @@ class map {
     return tree_.contains(value_type{key, mapped_type{}});
   }
 
+  // An iterator to the element with key equivalent to key.
+  // If no such element is found, past-the-end iterator is returned.
+  iterator find(const key_type &key) {
+    return tree_.find(value_type{key, mapped_type{}});
+  }
+
   /*
       Insert many
   */
 
   template <typename... Args>
-  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+  small_vector<std::pair<iterator, bool>, sizeof...(Args)> insert_many(Args &&...args) {
     return tree_.insert_many(args...);
   }
 
+  /*
+      Parallel traversal
+  */
+
+  // consecutive ranges covering the container, see rb_tree::split_ranges()
+  std::vector<std::pair<iterator, iterator>> split_ranges(size_type parts) const {
+    return tree_.split_ranges(parts);
+  }
+
  private:
   tree_type tree_;
 };
 
+namespace pmr {
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using map = s21::map<Key, T, Compare, std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+
+}  // namespace pmr
+
 }  // namespace s21
\ No newline at end of file
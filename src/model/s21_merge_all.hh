@@ -0,0 +1,273 @@
+#pragma once
+
+#include <algorithm>   // std::upper_bound
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <iterator>    // std::begin, std::end, std::random_access_iterator_tag
+#include <thread>
+#include <type_traits>  // std::decay_t
+#include <utility>      // std::declval, std::pair
+#include <vector>
+
+#include "s21_multiset.hh"
+#include "s21_set.hh"
+#include "s21_tournament_tree.hh"
+
+namespace s21 {
+
+/*
+  How merge_all() walks and rebuilds each container type. The inputs
+  are walked one distinct key at a time as (key, copies) runs, the
+  merged runs point into the inputs, and build() copies every key
+  exactly once, into the new tree.
+*/
+template <typename Container>
+struct merge_traits;
+
+template <typename Key, typename Compare, typename Allocator>
+struct merge_traits<set<Key, Compare, Allocator>> {
+  using container_type = set<Key, Compare, Allocator>;
+  using iterator = decltype(std::declval<container_type &>().begin());
+  using key_type = Key;
+  using compare_type = Compare;
+
+  static iterator begin(container_type &c) { return c.begin(); }
+
+  static iterator end(container_type &c) { return c.end(); }
+
+  static iterator lower_bound(container_type &c, const key_type &key) {
+    return c.lower_bound(key);
+  }
+
+  static std::size_t copies(iterator) { return 1; }
+
+  // a key in several inputs is kept once
+  static void add_copies(std::size_t &, std::size_t) {}
+
+  struct key_of {
+    const key_type &operator()(const std::pair<const key_type *, std::size_t> &run) const {
+      return *run.first;
+    }
+  };
+
+  template <typename Cursor>
+  static container_type build(Cursor first, Cursor last, unsigned threads,
+                              const Allocator &alloc) {
+    return container_type::from_sorted(first.template project<key_of>(),
+                                       last.template project<key_of>(), threads, alloc);
+  }
+};
+
+template <typename Key, typename Compare, typename Allocator>
+struct merge_traits<multiset<Key, Compare, Allocator>> {
+  using container_type = multiset<Key, Compare, Allocator>;
+  using iterator = typename container_type::key_iterator;
+  using key_type = Key;
+  using compare_type = Compare;
+
+  static iterator begin(container_type &c) { return c.key_begin(); }
+
+  static iterator end(container_type &c) { return c.key_end(); }
+
+  static iterator lower_bound(container_type &c, const key_type &key) {
+    return c.key_lower_bound(key);
+  }
+
+  static std::size_t copies(iterator it) { return it.copies(); }
+
+  // the copies of all inputs add up
+  static void add_copies(std::size_t &total, std::size_t more) { total += more; }
+
+  struct key_and_copies {
+    std::pair<const key_type &, std::size_t> operator()(
+        const std::pair<const key_type *, std::size_t> &run) const {
+      return {*run.first, run.second};
+    }
+  };
+
+  template <typename Cursor>
+  static container_type build(Cursor first, Cursor last, unsigned threads,
+                              const Allocator &alloc) {
+    return container_type::from_sorted_counts(first.template project<key_and_copies>(),
+                                              last.template project<key_and_copies>(),
+                                              threads, alloc);
+  }
+};
+
+/*
+  Random access to the per-slice results of merge_all() as one
+  sequence, so the tree is built from them without concatenating them.
+  Proj turns a run into what the container's builder reads.
+*/
+template <typename Run>
+struct run_identity {
+  const Run &operator()(const Run &run) const { return run; }
+};
+
+template <typename Run, typename Proj = run_identity<Run>>
+class slices_cursor {
+  using slices_type = std::vector<std::vector<Run>>;
+
+ public:
+  using difference_type = std::ptrdiff_t;
+  using value_type = Run;
+  using pointer = void;
+  using reference = decltype(std::declval<Proj>()(std::declval<const Run &>()));
+  using iterator_category = std::random_access_iterator_tag;
+
+  // offsets[s] is the index of the first run of slice s, offsets.back()
+  // the total
+  slices_cursor(const slices_type *slices, const std::vector<std::size_t> *offsets,
+                std::size_t index)
+      : slices_(slices), offsets_(offsets), index_(index) {}
+
+  reference operator*() const { return (*this)[0]; }
+
+  reference operator[](difference_type n) const {
+    std::size_t i = index_ + n;
+    std::size_t s = std::upper_bound(offsets_->begin(), offsets_->end(), i) - offsets_->begin() - 1;
+    return Proj{}((*slices_)[s][i - (*offsets_)[s]]);
+  }
+
+  slices_cursor &operator++() {
+    ++index_;
+    return *this;
+  }
+
+  slices_cursor operator+(difference_type n) const {
+    return slices_cursor(slices_, offsets_, index_ + n);
+  }
+
+  difference_type operator-(const slices_cursor &other) const {
+    return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+  }
+
+  bool operator==(const slices_cursor &other) const { return index_ == other.index_; }
+
+  bool operator!=(const slices_cursor &other) const { return index_ != other.index_; }
+
+  // the same position, read through OtherProj
+  template <typename OtherProj>
+  slices_cursor<Run, OtherProj> project() const {
+    return slices_cursor<Run, OtherProj>(slices_, offsets_, index_);
+  }
+
+ private:
+  const slices_type *slices_;
+  const std::vector<std::size_t> *offsets_;
+  std::size_t index_;
+};
+
+// the container type of a range of containers
+template <typename Range>
+using merged_type = std::decay_t<decltype(*std::begin(std::declval<Range &>()))>;
+
+/*
+  @brief Merges a range of s21::set or s21::multiset containers into a
+new container of the same type. Duplicates follow the semantics of the
+container: a set keeps one copy of every key, a multiset adds up the
+copies of all inputs.
+  The inputs are merged by a tournament tree one distinct key at a time,
+as (key, copies) runs, so the copies of a multiset key are never walked
+one by one. The result is built bottom-up in linear time from the runs,
+which point into the inputs, so every key is copied once and no key is
+inserted by descent. With threads > 1 the key space is cut at pivots
+taken from the largest input and every slice is merged by its own
+thread; equal keys always fall into the same slice.
+  The nodes of the result come from alloc.
+*/
+template <typename Range>
+merged_type<Range> merge_all(Range &containers, unsigned threads,
+                             const typename merged_type<Range>::allocator_type &alloc) {
+  using container_type = merged_type<Range>;
+  using traits = merge_traits<container_type>;
+  using iterator = typename traits::iterator;
+  using key_type = typename traits::key_type;
+  using compare_type = typename traits::compare_type;
+  using sources_type = std::vector<std::pair<iterator, iterator>>;
+  using run = std::pair<const key_type *, std::size_t>;  // a key and its copies
+  constexpr std::size_t kMinSlice = 1 << 15;
+
+  std::size_t total = 0;
+  container_type *largest = nullptr;
+  for (container_type &container : containers) {
+    total += container.size();
+    if (!largest || largest->size() < container.size()) {
+      largest = &container;
+    }
+  }
+  if (!largest) {
+    return container_type(alloc);
+  }
+
+  std::size_t slices = threads ? threads : 1;
+  if (slices > total / kMinSlice) {
+    slices = total / kMinSlice ? total / kMinSlice : 1;
+  }
+  std::vector<key_type> pivots;
+  if (slices > 1) {
+    auto ranges = largest->split_ranges(slices);
+    for (std::size_t i = 1; i < slices && i < ranges.size(); ++i) {
+      key_type pivot = *ranges[i * ranges.size() / slices].first;
+      if (pivots.empty() || compare_type{}(pivots.back(), pivot)) {
+        pivots.push_back(pivot);
+      }
+    }
+  }
+
+  // slice s of every input is [lower_bound(pivot s-1), lower_bound(pivot s))
+  std::vector<sources_type> sources(pivots.size() + 1);
+  for (container_type &container : containers) {
+    iterator from = traits::begin(container);
+    for (std::size_t s = 0; s <= pivots.size(); ++s) {
+      iterator to = s < pivots.size() ? traits::lower_bound(container, pivots[s])
+                                      : traits::end(container);
+      if (from != to) {
+        sources[s].emplace_back(from, to);
+      }
+      from = to;
+    }
+  }
+
+  std::vector<std::vector<run>> merged(sources.size());
+  auto merge_slice = [&sources, &merged](std::size_t s) {
+    tournament_tree<iterator, compare_type> tree(sources[s], compare_type{});
+    std::vector<run> &runs = merged[s];
+    for (; !tree.empty(); tree.pop()) {
+      iterator top = tree.top();
+      const key_type &key = *top;
+      // equal keys of several inputs come out one after the other
+      if (!runs.empty() && !compare_type{}(*runs.back().first, key)) {
+        traits::add_copies(runs.back().second, traits::copies(top));
+      } else {
+        runs.emplace_back(&key, traits::copies(top));
+      }
+    }
+  };
+  std::vector<std::thread> workers;
+  for (std::size_t s = 1; s < sources.size(); ++s) {
+    workers.emplace_back(merge_slice, s);
+  }
+  merge_slice(0);
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+
+  std::vector<std::size_t> offsets(1, 0);
+  for (const std::vector<run> &runs : merged) {
+    offsets.push_back(offsets.back() + runs.size());
+  }
+  slices_cursor<run> first(&merged, &offsets, 0);
+  return traits::build(first, first + offsets.back(), threads, alloc);
+}
+
+// merge_all() into a container with the allocator of the first input
+template <typename Range>
+merged_type<Range> merge_all(Range &containers,
+                             unsigned threads = std::thread::hardware_concurrency()) {
+  using allocator_type = typename merged_type<Range>::allocator_type;
+  auto first = std::begin(containers);
+  return merge_all(containers, threads,
+                   first != std::end(containers) ? first->get_allocator() : allocator_type());
+}
+
+}  // namespace s21
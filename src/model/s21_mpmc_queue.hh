@@ -0,0 +1,182 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#include <new>      // placement new
+#include <thread>   // std::this_thread::yield
+#include <utility>  // std::forward, std::move
+
+#include "s21_ring_buffer.hh"
+
+namespace s21 {
+
+/*
+  Bounded lock-free queue for any number of producer and consumer
+  threads (D. Vyukov's array queue).
+
+  Every slot of the ring carries a sequence number that says whose turn
+  it is. A slot at position p is free for the producer that claims p
+  when its sequence equals p, and holds a value for the consumer that
+  claims p when it equals p + 1; popping sets it to p + capacity, the
+  position of the next lap. Producers claim positions with a CAS on
+  tail_ and consumers with a CAS on head_, so each operation is one CAS
+  plus one release store to the slot, and producers and consumers only
+  meet on the slots themselves.
+
+  The blocking push() and pop() spin briefly and then yield until the
+  queue has room (or an element).
+*/
+template <typename T>
+class alignas(64) mpmc_queue {
+  using value_type = T;
+  using size_type = std::size_t;
+
+  struct cell {
+    std::atomic<size_type> sequence_;
+    alignas(T) unsigned char storage_[sizeof(T)];
+
+    T *value() { return reinterpret_cast<T *>(storage_); }
+  };
+
+ public:
+  /*
+      Member functions
+  */
+
+  // room for at least capacity elements, rounded up to a power of two
+  explicit mpmc_queue(size_type capacity)
+      : ring_(capacity < 2 ? 2 : capacity), capacity_(ring_.capacity()) {
+    for (size_type i = 0; i < capacity_; ++i) {
+      new (ring_.slot(i)) cell;
+      ring_.slot(i)->sequence_.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+  // destructor, no producer or consumer may be running
+  ~mpmc_queue() {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+      ring_.slot(i)->value()->~value_type();
+    }
+    for (size_type i = 0; i < capacity_; ++i) {
+      ring_.slot(i)->~cell();
+    }
+  }
+
+  /*
+      Capacity
+  */
+
+  size_type capacity() const { return capacity_; }
+
+  // a recent value while other threads are running
+  size_type size() const {
+    size_type head = head_.load(std::memory_order_acquire);
+    size_type tail = tail_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  /*
+      Modifiers
+  */
+
+  // @return false if the queue is full
+  bool try_push(const value_type &value) { return try_emplace(value); }
+
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    size_type position = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell *slot = ring_.slot(position);
+      // signed, so the comparison survives the wrap-around of positions
+      auto diff = static_cast<std::ptrdiff_t>(
+          slot->sequence_.load(std::memory_order_acquire) - position);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(position, position + 1,
+                                        std::memory_order_relaxed)) {
+          new (slot->value()) value_type(std::forward<Args>(args)...);
+          slot->sequence_.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;  // the slot still holds last lap's value
+      } else {
+        position = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // @return false if the queue is empty
+  bool try_pop(value_type &value) {
+    size_type position = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell *slot = ring_.slot(position);
+      auto diff = static_cast<std::ptrdiff_t>(
+          slot->sequence_.load(std::memory_order_acquire) - (position + 1));
+      if (diff == 0) {
+        if (head_.compare_exchange_weak(position, position + 1,
+                                        std::memory_order_relaxed)) {
+          value = std::move(*slot->value());
+          slot->value()->~value_type();
+          slot->sequence_.store(position + capacity_, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;  // the producer of this position has not finished
+      } else {
+        position = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // waits until there is room
+  void push(const value_type &value) {
+    for (unsigned attempt = 0; !try_push(value); ++attempt) {
+      backoff(attempt);
+    }
+  }
+
+  void push(value_type &&value) {
+    for (unsigned attempt = 0; !try_push(std::move(value)); ++attempt) {
+      backoff(attempt);
+    }
+  }
+
+  // waits until there is an element
+  void pop(value_type &value) {
+    for (unsigned attempt = 0; !try_pop(value); ++attempt) {
+      backoff(attempt);
+    }
+  }
+
+  value_type pop() {
+    value_type value;
+    pop(value);
+    return value;
+  }
+
+ private:
+  static constexpr unsigned kSpinAttempts = 64;
+
+  static void backoff(unsigned attempt) {
+    if (attempt >= kSpinAttempts) {
+      std::this_thread::yield();
+    }
+  }
+
+  ring_buffer<cell> ring_;
+  const size_type capacity_;
+
+  // one line per side, apart from the slots they meet on
+  alignas(64) std::atomic<size_type> tail_{0};
+  alignas(64) std::atomic<size_type> head_{0};
+};
+
+}  // namespace s21
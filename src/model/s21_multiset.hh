@@ -1,23 +1,145 @@
 #pragma once
 
+#include <memory>           // std::allocator, std::allocator_traits
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+
 #include "s21_rb_tree.hh"
 
 namespace s21 {
 
 template <
     typename Key,
-    typename Compare = std::less<Key>>
+    typename Compare = std::less<Key>,
+    typename Allocator = std::allocator<Key>>
 class multiset {
   using key_type = Key;
   using value_type = Key;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename rb_tree<Key, Compare>::iterator;
   using size_type = std::size_t;
 
-  using tree_type = rb_tree<Key, Compare>;
+  // Every distinct key is stored once together with the number of its
+  // copies, so duplicates cost neither nodes nor tree height.
+  struct entry {
+    value_type key_;
+    size_type count_;
+  };
+
+  struct entry_compare {
+    bool operator()(const entry &lhs, const entry &rhs) const {
+      return Compare{}(lhs.key_, rhs.key_);
+    }
+  };
+
+  using entry_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<entry>;
+  using tree_type = rb_tree<entry, entry_compare, entry_allocator>;
+  using tree_iterator = typename tree_type::iterator;
 
  public:
+  using allocator_type = Allocator;
+
+  // Walks every copy of a key before moving on to the next entry.
+  class iterator {
+    friend class multiset;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using reference = const Key &;
+    using pointer = const Key *;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    tree_iterator it_;
+    size_type index_;  // which copy of the key
+
+   public:
+    iterator() = delete;
+    iterator(tree_iterator it, size_type index) : it_(it), index_(index) {}
+
+    reference operator*() { return (*it_).key_; }
+
+    iterator operator++() {
+      if (++index_ == (*it_).count_) {
+        ++it_;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator old(*this);
+      ++(*this);
+      return old;
+    }
+
+    iterator operator--() {
+      if (index_ == 0) {
+        --it_;
+        index_ = (*it_).count_ - 1;
+      } else {
+        --index_;
+      }
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator old(*this);
+      --(*this);
+      return old;
+    }
+
+    bool operator==(const iterator &other) const {
+      return it_ == other.it_ && index_ == other.index_;
+    }
+
+    bool operator!=(const iterator &other) const { return !(*this == other); }
+  };
+
+  // Walks the distinct keys, one step per key however many copies it has.
+  class key_iterator {
+    friend class multiset;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using reference = const Key &;
+    using pointer = const Key *;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    tree_iterator it_;
+
+   public:
+    key_iterator() = delete;
+    explicit key_iterator(tree_iterator it) : it_(it) {}
+
+    reference operator*() { return (*it_).key_; }
+
+    // number of copies of the key
+    size_type copies() { return (*it_).count_; }
+
+    key_iterator operator++() {
+      ++it_;
+      return *this;
+    }
+
+    key_iterator operator++(int) {
+      key_iterator old(*this);
+      ++it_;
+      return old;
+    }
+
+    key_iterator operator--() {
+      --it_;
+      return *this;
+    }
+
+    key_iterator operator--(int) {
+      key_iterator old(*this);
+      --it_;
+      return old;
+    }
+
+    bool operator==(const key_iterator &other) const { return it_ == other.it_; }
+
+    bool operator!=(const key_iterator &other) const { return it_ != other.it_; }
+  };
+
   /*
       Member functions
   */
@@ -25,47 +147,132 @@ class multiset {
   // default ctor
   multiset() = default;
 
+  // allocates its nodes with alloc
+  explicit multiset(const allocator_type &alloc) : tree_(entry_allocator(alloc)) {}
+
   // init-list ctor
-  multiset(std::initializer_list<value_type> const &items) {
+  multiset(std::initializer_list<value_type> const &items,
+           const allocator_type &alloc = allocator_type())
+      : tree_(entry_allocator(alloc)) {
     for (value_type value : items) {
-      tree_.multiinsert(value);
+      insert(value);
     }
   }
 
   // copy ctor
-  multiset(const multiset &ms) {
-    this->merge(ms);
-  }
+  multiset(const multiset &ms) : tree_(ms.tree_), size_(ms.size_) {}
 
   // move ctor
-  multiset(multiset &&ms) : tree_(std::move(ms.tree_)) {}
+  multiset(multiset &&ms)
+      : tree_(std::move(ms.tree_)), size_(std::exchange(ms.size_, 0)) {}
 
   // destructor
   ~multiset() = default;
 
   // copy assigment
   multiset &operator=(const multiset &other) {
-    tree_.clear();
-    tree_.multimerge(other.tree_);
+    tree_ = other.tree_;
+    size_ = other.size_;
     return *this;
   }
 
   // move assigment
   multiset &operator=(multiset &&other) {
     tree_ = std::move(other.tree_);
+    size_ = std::exchange(other.size_, 0);
     return *this;
   }
 
+  /*
+  @brief Builds a multiset from an unsorted range: the keys are sorted
+  in parallel, every run of equal keys becomes one counted entry and the
+  tree of entries is built in parallel, with no per-element descent or
+  fix-up. The nodes come from alloc.
+  */
+  template <typename InputIt>
+  static multiset build_parallel(InputIt first, InputIt last,
+                                 unsigned threads = std::thread::hardware_concurrency(),
+                                 const allocator_type &alloc = allocator_type()) {
+    std::vector<value_type> keys(first, last);
+    parallel_stable_sort(keys.begin(), keys.end(), Compare{}, threads);
+    return from_sorted(keys.begin(), keys.end(), threads, alloc);
+  }
+
+  // Builds a multiset from a sorted range in linear time, with nodes from
+  // alloc.
+  template <typename ForwardIt>
+  static multiset from_sorted(ForwardIt first, ForwardIt last,
+                              unsigned threads = std::thread::hardware_concurrency(),
+                              const allocator_type &alloc = allocator_type()) {
+    multiset result(alloc);
+    std::vector<entry> entries;
+    for (; first != last; ++first) {
+      if (entries.empty() || Compare{}(entries.back().key_, *first)) {
+        entries.push_back(entry{*first, 1});
+      } else {
+        ++entries.back().count_;
+      }
+      ++result.size_;
+    }
+    result.tree_.build_sorted(entries.begin(), entries.end(), threads,
+                              [](const entry &e) -> const entry & { return e; });
+    return result;
+  }
+
+  allocator_type get_allocator() const {
+    return allocator_type(tree_.get_allocator());
+  }
+
+  /*
+  @brief Builds a multiset from (key, copies) pairs given in strictly
+  increasing key order, in linear time in the number of distinct keys.
+  Pairs with zero copies are skipped. The nodes come from alloc.
+  */
+  template <typename RandomIt>
+  static multiset from_sorted_counts(RandomIt first, RandomIt last,
+                                     unsigned threads = std::thread::hardware_concurrency(),
+                                     const allocator_type &alloc = allocator_type()) {
+    multiset result(alloc);
+    bool has_empty = false;
+    for (RandomIt it = first; it != last; ++it) {
+      result.size_ += (*it).second;
+      has_empty = has_empty || (*it).second == 0;
+    }
+    if (has_empty) {
+      // an entry without copies is a node no iterator can step past
+      std::vector<entry> entries;
+      for (; first != last; ++first) {
+        if ((*first).second != 0) {
+          entries.push_back(entry{(*first).first, (*first).second});
+        }
+      }
+      result.tree_.build_sorted(entries.begin(), entries.end(), threads,
+                                [](const entry &e) -> const entry & { return e; });
+    } else {
+      result.tree_.build_sorted(first, last, threads,
+                                [](const auto &item) { return entry{item.first, item.second}; });
+    }
+    return result;
+  }
+
   /*
       Iterators
   */
 
   iterator begin() {
-    return tree_.begin();
+    return iterator(tree_.begin(), 0);
   }
 
   iterator end() {
-    return tree_.end();
+    return iterator(tree_.end(), 0);
+  }
+
+  key_iterator key_begin() {
+    return key_iterator(tree_.begin());
+  }
+
+  key_iterator key_end() {
+    return key_iterator(tree_.end());
   }
 
   /*
@@ -77,6 +284,11 @@ class multiset {
   };
 
   size_type size() const {
+    return size_;
+  };
+
+  // number of distinct keys, i.e. of tree nodes
+  size_type unique_size() const {
     return tree_.size();
   };
 
@@ -90,30 +302,61 @@ class multiset {
 
   void clear() {
     tree_.clear();
+    size_ = 0;
   }
 
+  // Inserting an existing key only increments its count.
+  // Returns an iterator to the last copy of value.
   iterator insert(const value_type &value) {
-    return tree_.multiinsert(value);
+    return insert(value, 1);
   }
 
+  /// @brief Inserts count copies of value at once. With count 0 nothing
+  /// is inserted and the result is end() when value is absent.
+  iterator insert(const value_type &value, size_type count) {
+    tree_iterator it = tree_.find(entry{value, 0});
+    if (it == tree_.end()) {
+      if (count == 0) {
+        return end();
+      }
+      it = tree_.insert(entry{value, count}).first;
+    } else {
+      (*it).count_ += count;
+    }
+    size_ += count;
+    return iterator(it, (*it).count_ - 1);
+  }
+
+  // Removes one copy, the node goes away with the last one.
   void erase(iterator it) {
-    tree_.erase(it);
+    if (it == end()) {
+      return;
+    }
+    --size_;
+    if (--(*it.it_).count_ == 0) {
+      tree_.erase(it.it_);
+    }
   }
 
   void swap(multiset &other) {
     tree_.swap(other.tree_);
+    std::swap(size_, other.size_);
   }
 
   void merge(const multiset &other) {
-    tree_.multimerge(other.tree_);
+    for (const entry &item : other.tree_) {
+      insert(item.key_, item.count_);
+    }
   }
 
   /*
       Lookup
   */
 
+  // O(log n), the count is stored in the node
   size_type count(const Key &key) {
-    return tree_.count(key);
+    tree_iterator it = tree_.find(entry{key, 0});
+    return it == tree_.end() ? 0 : (*it).count_;
   }
 
   /*
@@ -126,36 +369,65 @@ class multiset {
   is returned.
   */
   iterator find(const Key &key) {
-    return tree_.find(key);
+    return iterator(tree_.find(entry{key, 0}), 0);
   }
 
   bool contains(const Key &key) {
-    return tree_.contains(key);
+    return tree_.contains(entry{key, 0});
   }
 
   // return range of elements matching a specific key
   std::pair<iterator, iterator> equal_range(const Key &key) {
-    return tree_.equal_range(key);
+    return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
   }
 
   // return an iterator to the first element not less than the given key
   iterator lower_bound(const Key &key) {
-    return tree_.lower_bound(key);
+    return iterator(tree_.lower_bound(entry{key, 0}), 0);
   }
 
   // return an iterator to the first element greater than the given key
   iterator upper_bound(const Key &key) {
-    return tree_.upper_bound(key);
+    return iterator(tree_.upper_bound(entry{key, 0}), 0);
+  }
+
+  // the first distinct key not less than key
+  key_iterator key_lower_bound(const Key &key) {
+    return key_iterator(tree_.lower_bound(entry{key, 0}));
   }
 
   //* Insert many *//
   template <typename... Args>
-  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
-    return tree_.multiinsert_many(args...);
+  small_vector<std::pair<iterator, bool>, sizeof...(Args)> insert_many(Args &&...args) {
+    small_vector<std::pair<iterator, bool>, sizeof...(Args)> vec;
+    (vec.emplace_back(insert(std::forward<Args>(args)), true), ...);
+    return vec;
+  }
+
+  /*
+      Parallel traversal
+  */
+
+  // consecutive ranges covering the container, never splitting the
+  // copies of one key, see rb_tree::split_ranges()
+  std::vector<std::pair<iterator, iterator>> split_ranges(size_type parts) const {
+    std::vector<std::pair<iterator, iterator>> ranges;
+    for (const auto &range : tree_.split_ranges(parts)) {
+      ranges.emplace_back(iterator(range.first, 0), iterator(range.second, 0));
+    }
+    return ranges;
   }
 
  private:
   tree_type tree_;
+  size_type size_ = 0;
 };
 
+namespace pmr {
+
+template <typename Key, typename Compare = std::less<Key>>
+using multiset = s21::multiset<Key, Compare, std::pmr::polymorphic_allocator<Key>>;
+
+}  // namespace pmr
+
 }  // namespace s21
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <new>      // operator new, std::align_val_t
+#include <vector>
+
+namespace s21 {
+
+/*
+  Fixed-size allocator for the nodes of linked containers.
+
+  Nodes are carved out of chunks that double in size (from kMinChunk up
+  to kMaxChunk nodes), and freed nodes are kept on a free list that the
+  next allocation pops, so allocating or freeing a node is a couple of
+  pointer moves and the nodes of one container stay close together in
+  memory. Chunks are only returned to the system when the pool is
+  destroyed. The pool is not thread-safe: containers sharing one must
+  not be used from several threads at once.
+*/
+template <typename Node>
+class node_pool {
+  using size_type = std::size_t;
+
+  union slot {
+    slot *next_;
+    alignas(Node) unsigned char storage_[sizeof(Node)];
+  };
+
+ public:
+  static constexpr size_type kMinChunk = 16;
+  static constexpr size_type kMaxChunk = 4096;
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  node_pool() : free_(nullptr), next_chunk_(kMinChunk), capacity_(0) {}
+
+  node_pool(const node_pool &) = delete;
+  node_pool &operator=(const node_pool &) = delete;
+
+  // destructor, every node must have been returned
+  ~node_pool() {
+    for (slot *chunk : chunks_) {
+      ::operator delete(chunk, std::align_val_t(alignof(slot)));
+    }
+  }
+
+  /*
+      Capacity
+  */
+
+  // number of nodes the chunks hold, in use or free
+  size_type capacity() const { return capacity_; }
+
+  /*
+      Modifiers
+  */
+
+  // uninitialized storage for one Node
+  void *allocate() {
+    if (!free_) {
+      refill();
+    }
+    slot *node = free_;
+    free_ = node->next_;
+    return node;
+  }
+
+  // takes back storage returned by allocate(), the Node already destroyed
+  void deallocate(void *node) {
+    slot *freed = static_cast<slot *>(node);
+    freed->next_ = free_;
+    free_ = freed;
+  }
+
+ private:
+  void refill() {
+    size_type count = next_chunk_;
+    chunks_.reserve(chunks_.size() + 1);
+    slot *chunk = static_cast<slot *>(
+        ::operator new(count * sizeof(slot), std::align_val_t(alignof(slot))));
+    chunks_.push_back(chunk);
+    // linked in address order, so consecutive allocations are adjacent
+    for (size_type i = count; i > 0; --i) {
+      chunk[i - 1].next_ = free_;
+      free_ = &chunk[i - 1];
+    }
+    capacity_ += count;
+    if (next_chunk_ < kMaxChunk) {
+      next_chunk_ *= 2;
+    }
+  }
+
+  slot *free_;
+  std::vector<slot *> chunks_;
+  size_type next_chunk_;
+  size_type capacity_;
+};
+
+}  // namespace s21
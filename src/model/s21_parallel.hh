@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>     // std::size_t
+#include <optional>
+#include <utility>  // std::move
+#include <vector>
+
+#include "s21_thread_pool.hh"
+
+namespace s21 {
+
+/*
+  Parallel algorithms over the tree containers (set, map, multiset).
+
+  The container is cut near the root into independent subtree ranges
+  with split_ranges(), several per worker so that stealing can even out
+  subtrees of different size, and every range is walked with the
+  ordinary iterator by one pool task.
+*/
+
+// ranges per worker, enough for stealing to balance uneven subtrees
+constexpr std::size_t kParallelRangesPerThread = 4;
+
+/*
+@brief Calls f(element) for every element of container on pool. f may
+modify the element (e.g. the mapped value of a map) but not the
+container, and calls for different elements may run concurrently.
+*/
+template <typename Container, typename Fn>
+void parallel_for_each(Container &container, Fn f, thread_pool &pool) {
+  auto ranges = container.split_ranges(pool.size() * kParallelRangesPerThread);
+  std::vector<thread_pool::task_type> tasks;
+  tasks.reserve(ranges.size());
+  for (auto &range : ranges) {
+    tasks.emplace_back([&range, &f] {
+      for (auto it = range.first; it != range.second; ++it) {
+        f(*it);
+      }
+    });
+  }
+  pool.run(tasks);
+}
+
+/*
+@brief Folds the elements of container on pool. Every range is folded
+left to right from init with op(T, element) and the partial results are
+combined in key order with combine(T, T), starting from init again. So
+init must be an identity of both (0 for a sum, "" for concatenation)
+and combine must be associative, but neither needs to be commutative.
+*/
+template <typename Container, typename T, typename Op, typename Combine>
+T parallel_reduce(Container &container, T init, Op op, Combine combine,
+                  thread_pool &pool) {
+  auto ranges = container.split_ranges(pool.size() * kParallelRangesPerThread);
+  std::vector<std::optional<T>> partials(ranges.size());
+  std::vector<thread_pool::task_type> tasks;
+  tasks.reserve(ranges.size());
+  for (std::size_t i = 0; i < ranges.size(); ++i) {
+    tasks.emplace_back([&ranges, &partials, &init, &op, i] {
+      T partial = init;
+      for (auto it = ranges[i].first; it != ranges[i].second; ++it) {
+        partial = op(std::move(partial), *it);
+      }
+      partials[i] = std::move(partial);
+    });
+  }
+  pool.run(tasks);
+  for (std::optional<T> &partial : partials) {
+    init = combine(std::move(init), std::move(*partial));
+  }
+  return init;
+}
+
+// the same with op as combine, for reductions like a sum over a set
+template <typename Container, typename T, typename Op>
+T parallel_reduce(Container &container, T init, Op op, thread_pool &pool) {
+  return parallel_reduce(container, std::move(init), op, op, pool);
+}
+
+}  // namespace s21
@@ -0,0 +1,602 @@
+#pragma once
+
+#include <atomic>
+#include <functional>        // std::less
+#include <initializer_list>  // std::initializer_list
+#include <iterator>          // std::bidirectional_iterator_tag
+#include <limits>            // std::numeric_limits
+#include <utility>           // std::pair, std::swap
+#include <vector>
+
+#include "s21_small_vector.hh"
+
+namespace s21 {
+
+/*
+  Persistent red-black tree.
+
+  Nodes have no parent pointers and are shared between versions of the
+  tree through an atomic reference count: a node is owned by its parent
+  links and by the roots that point to it. Insert and erase copy only the
+  root-to-leaf path they touch (plus the siblings recoloured or rotated by
+  the fixup), everything else stays shared. A node is modified in place
+  only while it is reachable from this version alone, so a writer never
+  touches memory a snapshot can see.
+
+  snapshot() and the copy constructor are O(1): they take one more
+  reference to the root. A snapshot is an ordinary tree, it can be moved
+  to another thread and read there while the original keeps changing.
+  One tree object itself must not be used from several threads at once.
+*/
+template <typename Key, typename Compare = std::less<Key>>
+class persistent_rb_tree {
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+
+  using size_type = std::size_t;
+
+  enum rb_tree_color { black,
+                       red };
+
+  struct node {
+    node *left_, *right_;
+    value_type key_;
+    rb_tree_color color_;
+    std::atomic<size_type> refs_;
+
+    node(const value_type& key, rb_tree_color color)
+        : left_(nullptr), right_(nullptr), key_(key), color_(color), refs_(1) {}
+    // copies the key and shares both subtrees
+    node(const node& other)
+        : left_(retain(other.left_)),
+          right_(retain(other.right_)),
+          key_(other.key_),
+          color_(other.color_),
+          refs_(1) {}
+    node(node&& other) = delete;
+    node& operator=(const node& other) = delete;
+    node& operator=(node&& other) = delete;
+    ~node() = default;
+  };
+
+  node* root_;
+  size_type size_;
+  Compare cmp_{};
+
+ public:
+  class iterator {
+    friend class persistent_rb_tree;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using reference = const Key&;
+    using pointer = const Key*;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    // path from the root to the current node, empty for end()
+    const node* root_;
+    std::vector<const node*> path_;
+
+   public:
+    iterator() = delete;
+    explicit iterator(const node* root) : root_(root) {}
+
+    reference operator*() const { return path_.back()->key_; }
+    pointer operator->() const { return &path_.back()->key_; }
+
+    iterator operator++() {
+      const node* x = path_.back();
+      if (x->right_) {
+        push_leftmost(x->right_);
+      } else {
+        path_.pop_back();
+        while (!path_.empty() && path_.back()->right_ == x) {
+          x = path_.back();
+          path_.pop_back();
+        }
+      }
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator old(*this);
+      ++(*this);
+      return old;
+    }
+
+    // Decrementing end() yields the largest element.
+    iterator operator--() {
+      if (path_.empty()) {
+        push_rightmost(root_);
+      } else if (path_.back()->left_) {
+        push_rightmost(path_.back()->left_);
+      } else {
+        const node* x = path_.back();
+        path_.pop_back();
+        while (!path_.empty() && path_.back()->left_ == x) {
+          x = path_.back();
+          path_.pop_back();
+        }
+      }
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator old(*this);
+      --(*this);
+      return old;
+    }
+
+    bool operator==(const iterator& other) const {
+      return current() == other.current();
+    }
+
+    bool operator!=(const iterator& other) const {
+      return current() != other.current();
+    }
+
+   private:
+    const node* current() const {
+      return path_.empty() ? nullptr : path_.back();
+    }
+
+    void push_leftmost(const node* x) {
+      for (; x; x = x->left_) {
+        path_.push_back(x);
+      }
+    }
+
+    void push_rightmost(const node* x) {
+      for (; x; x = x->right_) {
+        path_.push_back(x);
+      }
+    }
+  };
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  persistent_rb_tree() : root_(nullptr), size_(0) {}
+
+  // init-list ctor
+  // duplicates are not allowed
+  persistent_rb_tree(std::initializer_list<value_type> init_list)
+      : persistent_rb_tree() {
+    for (const value_type& value : init_list) {
+      insert(value);
+    }
+  }
+
+  // copy ctor, O(1): shares every node with other
+  persistent_rb_tree(const persistent_rb_tree& other)
+      : root_(retain(other.root_)), size_(other.size_) {}
+
+  // move ctor
+  persistent_rb_tree(persistent_rb_tree&& other) noexcept
+      : persistent_rb_tree() {
+    swap(other);
+  }
+
+  // destructor
+  ~persistent_rb_tree() { release(root_); }
+
+  // copy assigment
+  persistent_rb_tree& operator=(const persistent_rb_tree& other) {
+    persistent_rb_tree copy(other);
+    swap(copy);
+    return *this;
+  }
+
+  // move assigment
+  persistent_rb_tree& operator=(persistent_rb_tree&& other) noexcept {
+    persistent_rb_tree moved(std::move(other));
+    swap(moved);
+    return *this;
+  }
+
+  /// @brief Immutable version of the current contents in O(1).
+  /// Later changes to either tree are not visible in the other one.
+  persistent_rb_tree snapshot() const { return persistent_rb_tree(*this); }
+
+  /*
+      Iterators
+  */
+
+  iterator begin() const {
+    iterator it(root_);
+    it.push_leftmost(root_);
+    return it;
+  }
+
+  iterator end() const { return iterator(root_); }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(node);
+  }
+
+  /*
+      Modifiers
+  */
+
+  /// @brief Clears the content, nodes shared with snapshots survive.
+  void clear() {
+    release(std::exchange(root_, nullptr));
+    size_ = 0;
+  }
+
+  /// @brief Value duplicates ignores if already contains.
+  /// @param value Value to insert
+  /// @return Iterator to where the
+  /// element is in the container and bool denoting
+  /// whether the insertion took place.
+  std::pair<iterator, bool> insert(const value_type& value) {
+    iterator it = find(value);
+    if (it != end()) {
+      return std::pair<iterator, bool>(it, false);
+    }
+    // copy the search path, path.back() is the parent of the new node
+    std::vector<node*> path;
+    node** slot = &root_;
+    while (*slot) {
+      node* x = mutable_node(*slot);
+      path.push_back(x);
+      slot = cmp_(value, x->key_) ? &x->left_ : &x->right_;
+    }
+    node* K = new node(value, red);
+    *slot = K;
+    ++size_;
+    path.push_back(K);
+    fix_insert(path);
+    return std::pair<iterator, bool>(find(value), true);
+  }
+
+  void erase(iterator pos) {
+    if (pos != end()) {
+      key_type key = *pos;  // the node may be freed on the way
+      erase(key);
+    }
+  }
+
+  /// @brief Removes the element with the given key, if any.
+  /// @return Number of elements removed (0 or 1).
+  size_type erase(const key_type& key) {
+    if (!contains(key)) {
+      return 0;
+    }
+    std::vector<node*> path;
+    node** slot = &root_;
+    node* K = mutable_node(*slot);
+    while (cmp_(key, K->key_) || cmp_(K->key_, key)) {
+      path.push_back(K);
+      slot = cmp_(key, K->key_) ? &K->left_ : &K->right_;
+      K = mutable_node(*slot);
+    }
+    // If K has 2 childs, it is replaced by a copy of the max node in
+    // the left subtree, which is then removed instead.
+    if (K->left_ && K->right_) {
+      const node* pred = K->left_;
+      while (pred->right_) {
+        pred = pred->right_;
+      }
+      node* replacement = new node(pred->key_, K->color_);
+      replacement->left_ = K->left_;
+      replacement->right_ = K->right_;
+      *slot = replacement;
+      delete K;
+      path.push_back(replacement);
+      slot = &replacement->left_;
+      K = mutable_node(*slot);
+      while (K->right_) {
+        path.push_back(K);
+        slot = &K->right_;
+        K = mutable_node(*slot);
+      }
+    }
+    // K has at most one child now, which takes its place.
+    node* child = K->left_ ? K->left_ : K->right_;
+    bool x_is_left = !path.empty() && slot == &path.back()->left_;
+    rb_tree_color color = K->color_;
+    *slot = child;
+    delete K;
+    --size_;
+    if (color == black) {
+      if (child && child->color_ == red) {
+        mutable_node(*slot)->color_ = black;
+      } else {
+        fix_delete(path, x_is_left);
+      }
+    }
+    return 1;
+  }
+
+  //	swaps the contents
+  void swap(persistent_rb_tree& other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+  }
+
+  /// @brief Inserts every element of other.
+  /// Doesn't support duplicates.
+  void merge(const persistent_rb_tree& other) {
+    for (const value_type& key : other) {
+      insert(key);
+    }
+  }
+
+  /*
+      Lookup
+  */
+
+  // walks down without building an iterator, so it never allocates
+  bool contains(const key_type& key) const {
+    for (const node* x = root_; x;) {
+      if (cmp_(key, x->key_)) {
+        x = x->left_;
+      } else if (cmp_(x->key_, key)) {
+        x = x->right_;
+      } else {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // An iterator to the requested element.
+  // If no such element is found, past-the-end iterator is returned.
+  iterator find(const key_type& key) const {
+    iterator it(root_);
+    for (const node* x = root_; x;) {
+      it.path_.push_back(x);
+      if (cmp_(key, x->key_)) {
+        x = x->left_;
+      } else if (cmp_(x->key_, key)) {
+        x = x->right_;
+      } else {
+        return it;
+      }
+    }
+    return end();
+  }
+
+  size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+  /*
+    @brief Returns an iterator pointing to the first element that
+  is not less than key, or end() if there is none.
+  */
+  iterator lower_bound(const key_type& key) const {
+    return bound(key, [this](const key_type& k, const value_type& v) {
+      return !cmp_(v, k);
+    });
+  }
+
+  /*
+    @brief Returns an iterator pointing to the first element that
+  is greater than key, or end() if there is none.
+  */
+  iterator upper_bound(const key_type& key) const {
+    return bound(key, [this](const key_type& k, const value_type& v) {
+      return cmp_(k, v);
+    });
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type& key) const {
+    return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+  }
+
+  /*
+      Insert many
+  */
+
+  template <typename... Args>
+  small_vector<std::pair<iterator, bool>, sizeof...(Args)> insert_many(Args&&... args) {
+    small_vector<std::pair<iterator, bool>, sizeof...(Args)> vec;
+    (vec.emplace_back(insert(std::forward<Args>(args))), ...);
+    return vec;
+  }
+
+ private:
+  static node* retain(node* x) {
+    if (x) {
+      x->refs_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return x;
+  }
+
+  static void release(node* x) {
+    while (x && x->refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      release(x->left_);
+      delete std::exchange(x, x->right_);
+    }
+  }
+
+  static bool is_red(const node* x) { return x && x->color_ == red; }
+
+  // Makes the node in slot private to this version. The caller
+  // guarantees that the node holding slot is private already, so a
+  // count of one means nobody else can reach the node.
+  static node* mutable_node(node*& slot) {
+    if (slot->refs_.load(std::memory_order_acquire) != 1) {
+      node* copy = new node(*slot);
+      release(std::exchange(slot, copy));
+    }
+    return slot;
+  }
+
+  // link that owns path[i], the root for i == 0
+  node*& slot_of(std::vector<node*>& path, size_type i) {
+    if (i == 0) {
+      return root_;
+    }
+    return path[i - 1]->left_ == path[i] ? path[i - 1]->left_
+                                         : path[i - 1]->right_;
+  }
+
+  // both rotated nodes must be private
+  static void left_rotation(node*& slot) {
+    node* x = slot;
+    node* y = x->right_;
+    x->right_ = y->left_;
+    y->left_ = x;
+    slot = y;
+  }
+
+  static void right_rotation(node*& slot) {
+    node* x = slot;
+    node* y = x->left_;
+    x->left_ = y->right_;
+    y->right_ = x;
+    slot = y;
+  }
+
+  // path runs from the root to the new red node, all of it private
+  void fix_insert(std::vector<node*>& path) {
+    size_type k = path.size() - 1;
+    // Case 3: P is red, so K is at least two levels deep.
+    while (k >= 2 && path[k - 1]->color_ == red) {
+      node* K = path[k];
+      node* P = path[k - 1];
+      node* G = path[k - 2];
+      bool p_is_left = G->left_ == P;
+      node*& uncle = p_is_left ? G->right_ : G->left_;
+      // Case 3.1: P and U are red, recolour and continue from G.
+      if (is_red(uncle)) {
+        P->color_ = black;
+        mutable_node(uncle)->color_ = black;
+        G->color_ = red;
+        k -= 2;
+        continue;
+      }
+      // Case 3.2: U is black, one or two rotations finish the fixup.
+      if (p_is_left) {
+        if (P->right_ == K) {
+          left_rotation(G->left_);
+          P = K;
+        }
+        right_rotation(slot_of(path, k - 2));
+      } else {
+        if (P->left_ == K) {
+          right_rotation(G->right_);
+          P = K;
+        }
+        left_rotation(slot_of(path, k - 2));
+      }
+      P->color_ = black;
+      G->color_ = red;
+      break;
+    }
+    root_->color_ = black;
+  }
+
+  // Restores black heights after a black leaf position lost one black
+  // node. path runs from the root to the parent of that position and
+  // is private; siblings are copied before they are touched.
+  void fix_delete(std::vector<node*>& path, bool x_is_left) {
+    while (!path.empty()) {
+      node* P = path.back();
+      node*& P_slot = slot_of(path, path.size() - 1);
+      if (x_is_left) {
+        node* S = mutable_node(P->right_);
+        // Case 3.1: S is red, rotate it above P.
+        if (S->color_ == red) {
+          S->color_ = black;
+          P->color_ = red;
+          left_rotation(P_slot);
+          path.back() = S;
+          path.push_back(P);
+          S = mutable_node(P->right_);
+        }
+        // Case 3.2: both children of S are black.
+        if (!is_red(S->left_) && !is_red(S->right_)) {
+          S->color_ = red;
+          if (P->color_ == red) {
+            P->color_ = black;
+            return;
+          }
+          path.pop_back();
+          x_is_left = !path.empty() && path.back()->left_ == P;
+          continue;
+        }
+        // Case 3.3: the near child of S is red, rotate it above S.
+        if (!is_red(S->right_)) {
+          mutable_node(S->left_)->color_ = black;
+          S->color_ = red;
+          right_rotation(P->right_);
+          S = P->right_;
+        }
+        // Case 3.4: the far child of S is red, rotate S above P.
+        S->color_ = P->color_;
+        P->color_ = black;
+        mutable_node(S->right_)->color_ = black;
+        left_rotation(slot_of(path, path.size() - 1));
+        return;
+      } else {
+        node* S = mutable_node(P->left_);
+        // Mirror case 3.1
+        if (S->color_ == red) {
+          S->color_ = black;
+          P->color_ = red;
+          right_rotation(P_slot);
+          path.back() = S;
+          path.push_back(P);
+          S = mutable_node(P->left_);
+        }
+        // Mirror case 3.2
+        if (!is_red(S->left_) && !is_red(S->right_)) {
+          S->color_ = red;
+          if (P->color_ == red) {
+            P->color_ = black;
+            return;
+          }
+          path.pop_back();
+          x_is_left = !path.empty() && path.back()->left_ == P;
+          continue;
+        }
+        // Mirror case 3.3
+        if (!is_red(S->left_)) {
+          mutable_node(S->right_)->color_ = black;
+          S->color_ = red;
+          left_rotation(P->left_);
+          S = P->left_;
+        }
+        // Mirror case 3.4
+        S->color_ = P->color_;
+        P->color_ = black;
+        mutable_node(S->left_)->color_ = black;
+        right_rotation(slot_of(path, path.size() - 1));
+        return;
+      }
+    }
+  }
+
+  // descends to the first element satisfying pred, remembering the path
+  template <typename Pred>
+  iterator bound(const key_type& key, Pred pred) const {
+    iterator it(root_);
+    size_type depth = 0;
+    for (const node* x = root_; x;) {
+      it.path_.push_back(x);
+      if (pred(key, x->key_)) {
+        depth = it.path_.size();
+        x = x->left_;
+      } else {
+        x = x->right_;
+      }
+    }
+    it.path_.resize(depth);
+    return it;
+  }
+};
+
+}  // namespace s21
@@ -0,0 +1,470 @@
+#pragma once
+
+#include <cstddef>     // std::size_t
+#include <functional>  // std::less
+#include <initializer_list>
+#include <stdexcept>  // std::out_of_range
+#include <utility>    // std::exchange, std::forward, std::move, std::swap
+
+#include "s21_vector.hh"
+
+namespace s21 {
+
+/*
+  The sift operations of an implicit Arity-ary heap kept in heap[0, size)
+  with the greatest element, under less, at the root. Node i has its
+  children at Arity * i + 1 ... Arity * i + Arity.
+
+  Elements are moved through place(i, e), which stores e at position i,
+  so a caller can keep track of where every element is. The operations
+  work on a raw pointer rather than on the container: storing a
+  size_t-sized element through the container would make the compiler
+  reload its data pointer and size after every store.
+*/
+template <std::size_t Arity>
+struct d_ary_heap {
+  static_assert(Arity >= 2, "heap arity must be at least 2");
+
+  using size_type = std::size_t;
+
+  // the greatest of the children starting at first. With two children a
+  // branch is fastest (a correct guess starts loading the next level
+  // early); with more the selects are branch-free, since random keys
+  // would mispredict most of the branches.
+  template <typename E, typename Less>
+  static size_type greatest_child(const E *heap, size_type first, size_type size, Less less) {
+    size_type best = first;
+    if (Arity == 2 || first + Arity > size) {
+      for (size_type child = first + 1; child < size && child < first + Arity; ++child) {
+        if (less(heap[best], heap[child])) {
+          best = child;
+        }
+      }
+    } else {
+      for (size_type k = 1; k < Arity; ++k) {
+        size_type mask = 0 - static_cast<size_type>(less(heap[best], heap[first + k]));
+        best ^= (best ^ (first + k)) & mask;
+      }
+    }
+    return best;
+  }
+
+  template <typename E, typename Less, typename Place>
+  static void sift_up(E *heap, size_type i, Less less, Place place) {
+    E e = std::move(heap[i]);
+    while (i > 0) {
+      size_type parent = (i - 1) / Arity;
+      if (!less(heap[parent], e)) {
+        break;
+      }
+      place(i, std::move(heap[parent]));
+      i = parent;
+    }
+    place(i, std::move(e));
+  }
+
+  template <typename E, typename Less, typename Place>
+  static void sift_down(E *heap, size_type size, size_type i, Less less, Place place) {
+    E e = std::move(heap[i]);
+    for (size_type first = Arity * i + 1; first < size; first = Arity * i + 1) {
+      size_type best = greatest_child(heap, first, size, less);
+      if (!less(e, heap[best])) {
+        break;
+      }
+      place(i, std::move(heap[best]));
+      i = best;
+    }
+    place(i, std::move(e));
+  }
+
+  /*
+    @brief Fills the hole left by removing the root with e, which comes
+  from the last position and so almost always belongs near the bottom:
+  the hole moves down to a leaf along the greatest children without
+  comparing against e, then e sifts up from there. That is about half
+  the comparisons of sift_down(), and the grandchildren are prefetched
+  while the children are compared.
+  */
+  template <typename E, typename Less, typename Place>
+  static void replace_root(E *heap, size_type size, E &&e, Less less, Place place) {
+    size_type i = 0;
+    for (size_type first = 1; first < size; first = Arity * i + 1) {
+      __builtin_prefetch(heap + Arity * first + 1);
+      __builtin_prefetch(heap + Arity * (first + Arity - 1) + Arity);
+      size_type best = greatest_child(heap, first, size, less);
+      place(i, std::move(heap[best]));
+      i = best;
+    }
+    place(i, std::move(e));
+    sift_up(heap, i, less, place);
+  }
+};
+
+/*
+  Priority queue kept as an implicit Arity-ary heap in one s21::vector.
+
+  top() is the greatest element under Compare, as with
+  std::priority_queue (use std::greater for a min-queue). With the
+  default Arity of 4 the heap is half as deep as a binary one and the
+  four children of a node are next to each other, so push() and pop()
+  touch about half the cache lines, for a few more comparisons per
+  level. Sifting moves a hole instead of swapping, one move per level.
+*/
+template <typename T, typename Compare = std::less<T>, std::size_t Arity = 4>
+class priority_queue {
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using heap_type = d_ary_heap<Arity>;
+
+ public:
+  /*
+      Member functions
+  */
+
+  // default ctor
+  priority_queue() = default;
+
+  // init-list ctor, heapifies in O(n)
+  priority_queue(std::initializer_list<value_type> const &items) : heap_(items) {
+    T *heap = heap_.data();
+    // sift down every node that has children, the last one first
+    for (size_type i = heap_.size() > 1 ? (heap_.size() - 2) / Arity + 1 : 0; i-- > 0;) {
+      heap_type::sift_down(heap, heap_.size(), i, Compare{}, mover(heap));
+    }
+  }
+
+  // copy ctor
+  priority_queue(const priority_queue &q) : heap_(q.heap_) {}
+
+  // move ctor
+  priority_queue(priority_queue &&q) : heap_(std::move(q.heap_)) {}
+
+  // destructor
+  ~priority_queue() = default;
+
+  // copy assigment
+  priority_queue &operator=(const priority_queue &other) {
+    heap_ = other.heap_;
+    return *this;
+  }
+
+  // move assigment
+  priority_queue &operator=(priority_queue &&other) {
+    heap_ = std::move(other.heap_);
+    return *this;
+  }
+
+  /*
+      Element access
+  */
+
+  const_reference top() const {
+    check_not_empty();
+    return heap_[0];
+  }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return heap_.empty(); }
+
+  size_type size() const { return heap_.size(); }
+
+  size_type capacity() const { return heap_.capacity(); }
+
+  void reserve(size_type count) { heap_.reserve(count); }
+
+  /*
+      Modifiers
+  */
+
+  void push(const_reference value) { emplace(value); }
+
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    heap_.emplace_back(std::forward<Args>(args)...);
+    T *heap = heap_.data();
+    heap_type::sift_up(heap, heap_.size() - 1, Compare{}, mover(heap));
+  }
+
+  void pop() {
+    check_not_empty();
+    value_type last = std::move(heap_.back());
+    heap_.pop_back();
+    if (!heap_.empty()) {
+      T *heap = heap_.data();
+      heap_type::replace_root(heap, heap_.size(), std::move(last), Compare{}, mover(heap));
+    }
+  }
+
+  void swap(priority_queue &other) { heap_.swap(other.heap_); }
+
+  /*
+      Insert many
+  */
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    reserve(size() + sizeof...(args));
+    (push(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  void check_not_empty() const {
+    if (heap_.empty()) {
+      throw std::out_of_range("Priority queue is empty");
+    }
+  }
+
+  static auto mover(T *heap) {
+    return [heap](size_type i, value_type &&value) { heap[i] = std::move(value); };
+  }
+
+  vector<value_type> heap_;
+};
+
+/*
+  Priority queue whose elements can be changed or removed after they are
+  pushed, through the handle push() returns (a timer queue rescheduling
+  its timers, or Dijkstra's algorithm lowering a distance).
+
+  The heap is the same Arity-ary heap as in priority_queue, each entry
+  carrying its handle; a side table maps every handle to its entry's
+  position and is updated as entries move, so update() and erase() find
+  the element in O(1) and resift it in O(log n) without searching.
+  promote() and demote() skip update()'s comparison when the caller
+  knows the direction: lowering a distance in a std::greater min-queue
+  is a promote(), since it moves the element towards top(). A handle
+  stays valid until its element is popped or erased; handles of removed
+  elements are reused by later pushes.
+*/
+template <typename T, typename Compare = std::less<T>, std::size_t Arity = 4>
+class addressable_priority_queue {
+  using value_type = T;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using heap_type = d_ary_heap<Arity>;
+
+  static constexpr size_type kFree = static_cast<size_type>(-1);
+
+  struct entry {
+    value_type value_;
+    size_type id_;
+  };
+
+  struct entry_compare {
+    bool operator()(const entry &lhs, const entry &rhs) const {
+      return Compare{}(lhs.value_, rhs.value_);
+    }
+  };
+
+ public:
+  class handle {
+    friend class addressable_priority_queue;
+
+   public:
+    handle() : id_(kFree) {}
+
+    bool operator==(const handle &other) const { return id_ == other.id_; }
+
+    bool operator!=(const handle &other) const { return id_ != other.id_; }
+
+   private:
+    explicit handle(size_type id) : id_(id) {}
+
+    size_type id_;
+  };
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  addressable_priority_queue() : free_(kFree) {}
+
+  // copy ctor, the handles of q are valid for the copy too
+  addressable_priority_queue(const addressable_priority_queue &q) = default;
+
+  // move ctor
+  addressable_priority_queue(addressable_priority_queue &&q)
+      : heap_(std::move(q.heap_)),
+        position_(std::move(q.position_)),
+        free_(std::exchange(q.free_, kFree)) {}
+
+  // destructor
+  ~addressable_priority_queue() = default;
+
+  // copy assigment
+  addressable_priority_queue &operator=(const addressable_priority_queue &other) = default;
+
+  // move assigment
+  addressable_priority_queue &operator=(addressable_priority_queue &&other) {
+    swap(other);
+    return *this;
+  }
+
+  /*
+      Element access
+  */
+
+  const_reference top() const {
+    check_not_empty();
+    return heap_[0].value_;
+  }
+
+  handle top_handle() const {
+    check_not_empty();
+    return handle(heap_[0].id_);
+  }
+
+  const_reference value(handle h) const { return heap_[position_[h.id_]].value_; }
+
+  // whether h refers to an element still in the queue
+  bool contains(handle h) const {
+    return h.id_ < position_.size() && position_[h.id_] < heap_.size() &&
+           heap_[position_[h.id_]].id_ == h.id_;
+  }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return heap_.empty(); }
+
+  size_type size() const { return heap_.size(); }
+
+  void reserve(size_type count) {
+    heap_.reserve(count);
+    position_.reserve(count);
+  }
+
+  /*
+      Modifiers
+  */
+
+  handle push(const_reference value) { return emplace(value); }
+
+  handle push(value_type &&value) { return emplace(std::move(value)); }
+
+  template <typename... Args>
+  handle emplace(Args &&...args) {
+    size_type id = free_;
+    if (id == kFree) {
+      id = position_.size();
+      position_.push_back(heap_.size());
+    } else {
+      free_ = position_[id];
+      position_[id] = heap_.size();
+    }
+    heap_.emplace_back(entry{value_type(std::forward<Args>(args)...), id});
+    heap_type::sift_up(heap_.data(), heap_.size() - 1, entry_compare{}, placer());
+    return handle(id);
+  }
+
+  void pop() {
+    check_not_empty();
+    size_type id = heap_[0].id_;
+    entry last = std::move(heap_.back());
+    heap_.pop_back();
+    if (!heap_.empty()) {
+      heap_type::replace_root(heap_.data(), heap_.size(), std::move(last), entry_compare{},
+                              placer());
+    }
+    release(id);
+  }
+
+  // removes the element of h
+  void erase(handle h) {
+    size_type i = position_[h.id_];
+    entry last = std::move(heap_.back());
+    heap_.pop_back();
+    if (i < heap_.size()) {
+      bool up = Compare{}(heap_[i].value_, last.value_);
+      heap_[i] = std::move(last);
+      resift(i, up);
+    }
+    release(h.id_);
+  }
+
+  // replaces the element of h with value, wherever that puts it
+  void update(handle h, const_reference value) {
+    size_type i = position_[h.id_];
+    bool up = Compare{}(heap_[i].value_, value);
+    heap_[i].value_ = value;
+    resift(i, up);
+  }
+
+  // update() for a value that moves the element towards top(): value
+  // must not compare less than the old one under Compare, so for a
+  // std::greater min-queue it is a smaller (or equal) value
+  void promote(handle h, const_reference value) {
+    size_type i = position_[h.id_];
+    heap_[i].value_ = value;
+    resift(i, true);
+  }
+
+  // update() for a value that moves the element away from top(): value
+  // must not compare greater than the old one under Compare, so for a
+  // std::greater min-queue it is a larger (or equal) value
+  void demote(handle h, const_reference value) {
+    size_type i = position_[h.id_];
+    heap_[i].value_ = value;
+    resift(i, false);
+  }
+
+  void clear() {
+    heap_.clear();
+    position_.clear();
+    free_ = kFree;
+  }
+
+  void swap(addressable_priority_queue &other) {
+    heap_.swap(other.heap_);
+    position_.swap(other.position_);
+    std::swap(free_, other.free_);
+  }
+
+ private:
+  void check_not_empty() const {
+    if (heap_.empty()) {
+      throw std::out_of_range("Priority queue is empty");
+    }
+  }
+
+  // stores an entry and records its new position under its handle
+  auto placer() {
+    entry *heap = heap_.data();
+    size_type *position = position_.data();
+    return [heap, position](size_type i, entry &&e) {
+      position[e.id_] = i;
+      heap[i] = std::move(e);
+    };
+  }
+
+  void resift(size_type i, bool up) {
+    if (up) {
+      heap_type::sift_up(heap_.data(), i, entry_compare{}, placer());
+    } else {
+      heap_type::sift_down(heap_.data(), heap_.size(), i, entry_compare{}, placer());
+    }
+  }
+
+  // a free handle's slot links to the next free one
+  void release(size_type id) {
+    position_[id] = free_;
+    free_ = id;
+  }
+
+  vector<entry> heap_;
+  // heap position of each handle's entry, or for a free handle the next
+  // free one (kFree ends the list)
+  vector<size_type> position_;
+  size_type free_;
+};
+
+}  // namespace s21
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <initializer_list>
+#include <stdexcept>    // std::out_of_range
+#include <type_traits>  // std::void_t, std::true_type, std::false_type
+#include <utility>      // std::declval, std::forward, std::move
+
+#include "s21_deque.hh"
+#include "s21_ring_deque.hh"
+
+namespace s21 {
+
+/*
+  FIFO adaptor over a Container with front(), back(), push_back(),
+  emplace_back(), pop_front(), size() and empty(), such as deque (the
+  default), ring_deque or s21::list.
+
+  With deque a push never moves the elements already queued and never
+  reallocates more than one block, so there is no doubling spike, and
+  references to elements stay valid until they are popped. In steady
+  state (as many pushes as pops) the block emptied by pop() is reused
+  for the next pushes, so the queue stops allocating. ring_deque keeps
+  the queue in one contiguous ring that doubles when full, for queues
+  of bounded size that are walked or reserved up front. reserve() and
+  capacity() are forwarded to containers that have them.
+*/
+template <typename T, typename Container = deque<T>>
+class queue {
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  template <typename C, typename = void>
+  struct has_reserve : std::false_type {};
+
+  template <typename C>
+  struct has_reserve<C, std::void_t<decltype(std::declval<C &>().reserve(size_type()))>>
+      : std::true_type {};
+
+  template <typename C, typename = void>
+  struct has_capacity : std::false_type {};
+
+  template <typename C>
+  struct has_capacity<C, std::void_t<decltype(std::declval<const C &>().capacity())>>
+      : std::true_type {};
+
+ public:
+  using container_type = Container;
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  queue() = default;
+
+  // init-list ctor
+  queue(std::initializer_list<value_type> const &items) {
+    reserve(items.size());
+    for (const value_type &value : items) {
+      c_.push_back(value);
+    }
+  }
+
+  // copy ctor
+  queue(const queue &q) : c_(q.c_) {}
+
+  // move ctor
+  queue(queue &&q) : c_(std::move(q.c_)) {}
+
+  // destructor
+  ~queue() = default;
+
+  // copy assigment
+  queue &operator=(const queue &other) {
+    c_ = other.c_;
+    return *this;
+  }
+
+  // move assigment
+  queue &operator=(queue &&other) {
+    c_ = std::move(other.c_);
+    return *this;
+  }
+
+  /*
+      Element access
+  */
+
+  reference front() {
+    check_not_empty();
+    return c_.front();
+  }
+
+  reference back() {
+    check_not_empty();
+    return c_.back();
+  }
+
+  const_reference front() const {
+    check_not_empty();
+    return c_.front();
+  }
+
+  const_reference back() const {
+    check_not_empty();
+    return c_.back();
+  }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return c_.empty(); }
+
+  size_type size() const { return c_.size(); }
+
+  // elements the queue holds before push() allocates, size() if the
+  // container cannot tell
+  size_type capacity() const {
+    if constexpr (has_capacity<container_type>::value) {
+      return c_.capacity();
+    } else {
+      return c_.size();
+    }
+  }
+
+  // makes room for count elements, if the container can
+  void reserve(size_type count) {
+    if constexpr (has_reserve<container_type>::value) {
+      c_.reserve(count);
+    }
+  }
+
+  /*
+      Modifiers
+  */
+
+  void push(const_reference value) { c_.push_back(value); }
+
+  void push(value_type &&value) { c_.push_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    return c_.emplace_back(std::forward<Args>(args)...);
+  }
+
+  void pop() {
+    check_not_empty();
+    c_.pop_front();
+  }
+
+  void swap(queue &other) { c_.swap(other.c_); }
+
+  /*
+      Insert many
+  */
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    reserve(size() + sizeof...(args));
+    (c_.push_back(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  void check_not_empty() const {
+    if (c_.empty()) {
+      throw std::out_of_range("Queue is empty");
+    }
+  }
+
+  container_type c_;
+};
+
+}  // namespace s21
@@ -0,0 +1,925 @@
+#pragma once
+
+#include <cstdint>           // std::uint8_t
+#include <cstring>           // std::memmove
+#include <initializer_list>  // std::initializer_list
+#include <iterator>          // std::bidirectional_iterator_tag
+#include <limits>            // std::numeric_limits
+#include <stdexcept>         // std::out_of_range
+#include <string>
+#include <utility>  // std::pair
+#include <vector>
+
+#include "s21_small_vector.hh"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+/*
+  Ordered map from std::string to T built as an adaptive radix tree.
+
+  Inner nodes branch on one key byte and come in four sizes
+  (4, 16, 48 and 256 children), growing and shrinking with their fan-out.
+  Chains of single-child nodes are collapsed into a prefix stored in the
+  node, so a lookup touches one node per branching byte and compares every
+  key byte once, however many keys share the prefix.
+
+  Leaves hold the full key and are additionally threaded into a sorted
+  doubly linked list, which gives O(1) iterator steps and keeps iterators
+  valid across inserts. A key that is a prefix of other keys lives in the
+  value_ slot of the inner node where it ends.
+*/
+template <typename T>
+class radix_map {
+ public:
+  // member types
+  using key_type = std::string;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+ private:
+  enum node_kind : std::uint8_t { leaf_kind, node4_kind, node16_kind, node48_kind, node256_kind };
+
+  struct tree_node {
+    node_kind kind_;
+    explicit tree_node(node_kind kind) : kind_(kind) {}
+  };
+
+  // list links are shared by leaves and by the end sentinel
+  struct list_node {
+    list_node *prev_, *next_;
+    list_node() : prev_(this), next_(this) {}
+  };
+
+  struct leaf : tree_node, list_node {
+    value_type value_;
+    explicit leaf(const value_type &value) : tree_node(leaf_kind), value_(value) {}
+  };
+
+  struct inner_node : tree_node {
+    std::uint16_t count_;  // number of children
+    std::string prefix_;   // bytes skipped before branching
+    leaf *value_;          // key that ends exactly at this node
+    explicit inner_node(node_kind kind) : tree_node(kind), count_(0), value_(nullptr) {}
+  };
+
+  // node4 and node16 keep keys sorted, children_[i] belongs to keys_[i]
+  template <std::size_t N, node_kind Kind>
+  struct sorted_node : inner_node {
+    unsigned char keys_[N];
+    tree_node *children_[N];
+    sorted_node() : inner_node(Kind), keys_{}, children_{} {}
+  };
+  using node4 = sorted_node<4, node4_kind>;
+  using node16 = sorted_node<16, node16_kind>;
+
+  // index_[byte] is 1 + slot in children_, 0 means no child
+  struct node48 : inner_node {
+    unsigned char index_[256];
+    tree_node *children_[48];
+    node48() : inner_node(node48_kind) {
+      std::memset(index_, 0, sizeof(index_));
+      std::memset(children_, 0, sizeof(children_));
+    }
+  };
+
+  struct node256 : inner_node {
+    tree_node *children_[256];
+    node256() : inner_node(node256_kind) { std::memset(children_, 0, sizeof(children_)); }
+  };
+
+ public:
+  class iterator {
+    friend class radix_map;
+    using value_type = radix_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type &;
+    using pointer = value_type *;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    list_node *ptr_;
+
+   public:
+    iterator() = delete;
+    explicit iterator(list_node *ptr) : ptr_(ptr) {}
+
+    reference operator*() const { return static_cast<leaf *>(ptr_)->value_; }
+
+    pointer operator->() const { return &static_cast<leaf *>(ptr_)->value_; }
+
+    iterator operator++() {
+      ptr_ = ptr_->next_;
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator old(*this);
+      ptr_ = ptr_->next_;
+      return old;
+    }
+
+    iterator operator--() {
+      ptr_ = ptr_->prev_;
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator old(*this);
+      ptr_ = ptr_->prev_;
+      return old;
+    }
+
+    bool operator==(const iterator &other) const { return ptr_ == other.ptr_; }
+
+    bool operator!=(const iterator &other) const { return ptr_ != other.ptr_; }
+  };
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  radix_map() : root_(nullptr), size_(0) {}
+
+  // init-list ctor
+  radix_map(const std::initializer_list<value_type> &items) : radix_map() {
+    for (const value_type &value : items) {
+      insert(value);
+    }
+  }
+
+  // copy ctor
+  radix_map(const radix_map &other) : radix_map() {
+    for (const value_type &value : other) {
+      insert(value);
+    }
+  }
+
+  // move ctor
+  radix_map(radix_map &&other) : radix_map() { swap(other); }
+
+  // destructor
+  ~radix_map() { clear(); }
+
+  // copy assigment
+  radix_map &operator=(const radix_map &other) {
+    if (this != &other) {
+      radix_map copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  // move assigment
+  radix_map &operator=(radix_map &&other) {
+    clear();
+    swap(other);
+    return *this;
+  }
+
+  /*
+      Element access
+  */
+
+  /*
+  @brief Returns a reference to the mapped value of the element
+  with specified key. If no such element exists, an exception
+  of type std::out_of_range is thrown.
+  */
+  mapped_type &at(const key_type &key) {
+    leaf *found = find_leaf(key);
+    if (found == nullptr) {
+      throw std::out_of_range("No such element exists");
+    }
+    return found->value_.second;
+  }
+
+  /*
+  @brief Returns a reference to the value that is mapped to a key
+  equivalent to key, performing an insertion if such key does not
+  already exist.
+  */
+  mapped_type &operator[](const key_type &key) {
+    leaf *found = find_leaf(key);
+    if (found == nullptr) {
+      return (*insert(value_type{key, mapped_type{}}).first).second;
+    }
+    return found->value_.second;
+  }
+
+  /*
+      Iterators
+  */
+
+  iterator begin() const { return iterator(end_.next_); }
+
+  iterator end() const { return iterator(const_cast<list_node *>(&end_)); }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(node4);
+  }
+
+  /*
+      Modifiers
+  */
+
+  // clears the content
+  void clear() {
+    destroy_inner(root_);
+    root_ = nullptr;
+    list_node *curr = end_.next_;
+    while (curr != &end_) {
+      delete static_cast<leaf *>(std::exchange(curr, curr->next_));
+    }
+    end_.next_ = end_.prev_ = &end_;
+    size_ = 0;
+  }
+
+  // inserts node and returns iterator to where
+  // the element is in the container and bool
+  // denoting whether the insertion took place
+  std::pair<iterator, bool> insert(const value_type &value) {
+    const key_type &key = value.first;
+    if (root_ == nullptr) {
+      leaf *created = new leaf(value);
+      link_before(created, &end_);
+      root_ = created;
+      ++size_;
+      return {iterator(created), true};
+    }
+
+    tree_node **ref = &root_;
+    size_type depth = 0;
+    while (true) {
+      tree_node *curr = *ref;
+      if (curr->kind_ == leaf_kind) {
+        leaf *existing = static_cast<leaf *>(curr);
+        const key_type &other = existing->value_.first;
+        if (other == key) {
+          return {iterator(existing), false};
+        }
+        // Two keys in one slot: branch on their first differing byte.
+        size_type common = depth;
+        while (common < key.size() && common < other.size() && key[common] == other[common]) {
+          ++common;
+        }
+        node4 *branch = new node4();
+        branch->prefix_.assign(key, depth, common - depth);
+        leaf *created = new leaf(value);
+        place(branch, existing, common);
+        place(branch, created, common);
+        *ref = branch;
+        if (key < other) {
+          link_before(created, existing);
+        } else {
+          link_before(created, existing->next_);
+        }
+        ++size_;
+        return {iterator(created), true};
+      }
+
+      inner_node *node = static_cast<inner_node *>(curr);
+      size_type matched = prefix_match(node, key, depth);
+      if (matched < node->prefix_.size()) {
+        // Key leaves the compressed path: split the prefix at `matched`.
+        node4 *branch = new node4();
+        branch->prefix_.assign(node->prefix_, 0, matched);
+        unsigned char split_byte = static_cast<unsigned char>(node->prefix_[matched]);
+        node->prefix_.erase(0, matched + 1);
+        add_sorted(branch, split_byte, node);
+        leaf *created = new leaf(value);
+        place(branch, created, depth + matched);
+        *ref = branch;
+        bool before = key.size() == depth + matched ||
+                      static_cast<unsigned char>(key[depth + matched]) < split_byte;
+        if (before) {
+          link_before(created, min_leaf(node));
+        } else {
+          link_before(created, max_leaf(node)->next_);
+        }
+        ++size_;
+        return {iterator(created), true};
+      }
+
+      depth += matched;
+      if (depth == key.size()) {
+        if (node->value_ != nullptr) {
+          return {iterator(node->value_), false};
+        }
+        leaf *created = new leaf(value);
+        link_before(created, min_leaf(node));
+        node->value_ = created;
+        ++size_;
+        return {iterator(created), true};
+      }
+
+      unsigned char byte = static_cast<unsigned char>(key[depth]);
+      tree_node **child = find_child(node, byte);
+      if (child == nullptr) {
+        leaf *created = new leaf(value);
+        link_new_child(node, byte, created);
+        add_child(ref, node, byte, created);
+        ++size_;
+        return {iterator(created), true};
+      }
+      ref = child;
+      ++depth;
+    }
+  }
+
+  // inserts value by key and returns iterator to where
+  // the element is in the container and bool
+  // denoting whether the insertion took place
+  std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj) {
+    return insert(value_type{key, obj});
+  }
+
+  // inserts an element or assigns to the current element if the key already exists
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, const mapped_type &obj) {
+    leaf *found = find_leaf(key);
+    if (found != nullptr) {
+      found->value_.second = obj;
+      return {iterator(found), false};
+    }
+    return insert(value_type{key, obj});
+  }
+
+  // erases element at iterator
+  void erase(iterator it) {
+    if (it != end()) {
+      erase_key(static_cast<leaf *>(it.ptr_)->value_.first);
+    }
+  }
+
+  // erases element by key, returns number of erased elements
+  size_type erase(const key_type &key) { return erase_key(key) ? 1 : 0; }
+
+  //	swaps the contents
+  void swap(radix_map &other) {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    // the sentinels stay in place, only the rings are exchanged
+    list_node *first = end_.next_, *last = end_.prev_;
+    list_node *other_first = other.end_.next_, *other_last = other.end_.prev_;
+    relink_ring(end_, other_first == &other.end_ ? nullptr : other_first, other_last);
+    relink_ring(other.end_, first == &end_ ? nullptr : first, last);
+  }
+
+  // splices nodes from another container
+  void merge(radix_map &other) {
+    for (const value_type &value : other) {
+      insert(value);
+    }
+  }
+
+  /*
+      Lookup
+  */
+
+  // @brief Checks if there is an element with key equivalent to key
+  // in the container.
+  bool contains(const key_type &key) const { return find_leaf(key) != nullptr; }
+
+  // An iterator to the requested element.
+  // If no such element is found, past-the-end iterator is returned.
+  iterator find(const key_type &key) const {
+    leaf *found = find_leaf(key);
+    return found ? iterator(found) : end();
+  }
+
+  /*
+      Insert many
+  */
+
+  template <typename... Args>
+  small_vector<std::pair<iterator, bool>, sizeof...(Args)> insert_many(Args &&...args) {
+    small_vector<std::pair<iterator, bool>, sizeof...(Args)> vec;
+    (vec.emplace_back(insert(std::forward<Args>(args))), ...);
+    return vec;
+  }
+
+ private:
+  tree_node *root_;
+  list_node end_;
+  size_type size_;
+
+  /*
+      Leaf list
+  */
+
+  static void link_before(list_node *item, list_node *pos) {
+    item->next_ = pos;
+    item->prev_ = pos->prev_;
+    pos->prev_->next_ = item;
+    pos->prev_ = item;
+  }
+
+  static void unlink(list_node *item) {
+    item->prev_->next_ = item->next_;
+    item->next_->prev_ = item->prev_;
+  }
+
+  static void relink_ring(list_node &sentinel, list_node *first, list_node *last) {
+    if (first == nullptr) {
+      sentinel.next_ = sentinel.prev_ = &sentinel;
+    } else {
+      sentinel.next_ = first;
+      sentinel.prev_ = last;
+      first->prev_ = &sentinel;
+      last->next_ = &sentinel;
+    }
+  }
+
+  // links a leaf that is about to become child `byte` of node
+  void link_new_child(inner_node *node, unsigned char byte, leaf *created) {
+    if (tree_node *prev = child_at_or_before(node, byte - 1)) {
+      link_before(created, max_leaf(prev)->next_);
+    } else if (node->value_ != nullptr) {
+      link_before(created, node->value_->next_);
+    } else {
+      link_before(created, min_leaf(child_at_or_after(node, byte + 1)));
+    }
+  }
+
+  static leaf *min_leaf(tree_node *curr) {
+    while (curr->kind_ != leaf_kind) {
+      inner_node *node = static_cast<inner_node *>(curr);
+      if (node->value_ != nullptr) {
+        return node->value_;
+      }
+      curr = child_at_or_after(node, 0);
+    }
+    return static_cast<leaf *>(curr);
+  }
+
+  static leaf *max_leaf(tree_node *curr) {
+    while (curr->kind_ != leaf_kind) {
+      inner_node *node = static_cast<inner_node *>(curr);
+      tree_node *last = child_at_or_before(node, 255);
+      if (last == nullptr) {
+        return node->value_;
+      }
+      curr = last;
+    }
+    return static_cast<leaf *>(curr);
+  }
+
+  /*
+      Lookup helpers
+  */
+
+  // number of prefix bytes of node equal to key bytes starting at depth
+  static size_type prefix_match(const inner_node *node, const key_type &key, size_type depth) {
+    size_type limit = node->prefix_.size();
+    if (key.size() - depth < limit) {
+      limit = key.size() - depth;
+    }
+    size_type i = 0;
+    while (i < limit && node->prefix_[i] == key[depth + i]) {
+      ++i;
+    }
+    return i;
+  }
+
+  leaf *find_leaf(const key_type &key) const {
+    tree_node *curr = root_;
+    size_type depth = 0;
+    while (curr != nullptr) {
+      if (curr->kind_ == leaf_kind) {
+        leaf *found = static_cast<leaf *>(curr);
+        return found->value_.first == key ? found : nullptr;
+      }
+      inner_node *node = static_cast<inner_node *>(curr);
+      if (prefix_match(node, key, depth) != node->prefix_.size()) {
+        return nullptr;
+      }
+      depth += node->prefix_.size();
+      if (depth == key.size()) {
+        return node->value_;
+      }
+      tree_node **child = find_child(node, static_cast<unsigned char>(key[depth]));
+      curr = child ? *child : nullptr;
+      ++depth;
+    }
+    return nullptr;
+  }
+
+  // puts a leaf under a freshly created branch whose prefix ends at depth
+  void place(node4 *branch, leaf *item, size_type depth) {
+    const key_type &key = item->value_.first;
+    if (key.size() == depth) {
+      branch->value_ = item;
+    } else {
+      add_sorted(branch, static_cast<unsigned char>(key[depth]), item);
+    }
+  }
+
+  /*
+      Inner node operations
+  */
+
+  static tree_node **find_child(inner_node *node, unsigned char byte) {
+    switch (node->kind_) {
+      case node4_kind: {
+        node4 *n = static_cast<node4 *>(node);
+        for (std::uint16_t i = 0; i < n->count_; ++i) {
+          if (n->keys_[i] == byte) {
+            return &n->children_[i];
+          }
+        }
+        return nullptr;
+      }
+      case node16_kind: {
+        node16 *n = static_cast<node16 *>(node);
+#if defined(__SSE2__)
+        __m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(n->keys_)));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(cmp)) & ((1U << n->count_) - 1);
+        return mask ? &n->children_[__builtin_ctz(mask)] : nullptr;
+#else
+        for (std::uint16_t i = 0; i < n->count_; ++i) {
+          if (n->keys_[i] == byte) {
+            return &n->children_[i];
+          }
+        }
+        return nullptr;
+#endif
+      }
+      case node48_kind: {
+        node48 *n = static_cast<node48 *>(node);
+        return n->index_[byte] ? &n->children_[n->index_[byte] - 1] : nullptr;
+      }
+      default: {
+        node256 *n = static_cast<node256 *>(node);
+        return n->children_[byte] ? &n->children_[byte] : nullptr;
+      }
+    }
+  }
+
+  // child with the smallest byte >= from, nullptr if none
+  static tree_node *child_at_or_after(inner_node *node, int from) {
+    switch (node->kind_) {
+      case node4_kind:
+        return sorted_at_or_after(static_cast<node4 *>(node), from);
+      case node16_kind:
+        return sorted_at_or_after(static_cast<node16 *>(node), from);
+      case node48_kind: {
+        node48 *n = static_cast<node48 *>(node);
+        for (int byte = from < 0 ? 0 : from; byte < 256; ++byte) {
+          if (n->index_[byte]) {
+            return n->children_[n->index_[byte] - 1];
+          }
+        }
+        return nullptr;
+      }
+      default: {
+        node256 *n = static_cast<node256 *>(node);
+        for (int byte = from < 0 ? 0 : from; byte < 256; ++byte) {
+          if (n->children_[byte]) {
+            return n->children_[byte];
+          }
+        }
+        return nullptr;
+      }
+    }
+  }
+
+  // child with the largest byte <= to, nullptr if none
+  static tree_node *child_at_or_before(inner_node *node, int to) {
+    switch (node->kind_) {
+      case node4_kind:
+        return sorted_at_or_before(static_cast<node4 *>(node), to);
+      case node16_kind:
+        return sorted_at_or_before(static_cast<node16 *>(node), to);
+      case node48_kind: {
+        node48 *n = static_cast<node48 *>(node);
+        for (int byte = to > 255 ? 255 : to; byte >= 0; --byte) {
+          if (n->index_[byte]) {
+            return n->children_[n->index_[byte] - 1];
+          }
+        }
+        return nullptr;
+      }
+      default: {
+        node256 *n = static_cast<node256 *>(node);
+        for (int byte = to > 255 ? 255 : to; byte >= 0; --byte) {
+          if (n->children_[byte]) {
+            return n->children_[byte];
+          }
+        }
+        return nullptr;
+      }
+    }
+  }
+
+  template <typename Node>
+  static tree_node *sorted_at_or_after(Node *n, int from) {
+    for (std::uint16_t i = 0; i < n->count_; ++i) {
+      if (n->keys_[i] >= from) {
+        return n->children_[i];
+      }
+    }
+    return nullptr;
+  }
+
+  template <typename Node>
+  static tree_node *sorted_at_or_before(Node *n, int to) {
+    for (std::uint16_t i = n->count_; i > 0; --i) {
+      if (n->keys_[i - 1] <= to) {
+        return n->children_[i - 1];
+      }
+    }
+    return nullptr;
+  }
+
+  // inserts into node4/node16 keeping keys sorted, node must not be full
+  template <typename Node>
+  static void add_sorted(Node *n, unsigned char byte, tree_node *child) {
+    std::uint16_t pos = 0;
+    while (pos < n->count_ && n->keys_[pos] < byte) {
+      ++pos;
+    }
+    std::memmove(n->keys_ + pos + 1, n->keys_ + pos, n->count_ - pos);
+    std::memmove(n->children_ + pos + 1, n->children_ + pos, (n->count_ - pos) * sizeof(tree_node *));
+    n->keys_[pos] = byte;
+    n->children_[pos] = child;
+    ++n->count_;
+  }
+
+  template <typename Node>
+  static void remove_sorted(Node *n, unsigned char byte) {
+    std::uint16_t pos = 0;
+    while (n->keys_[pos] != byte) {
+      ++pos;
+    }
+    std::memmove(n->keys_ + pos, n->keys_ + pos + 1, n->count_ - pos - 1);
+    std::memmove(n->children_ + pos, n->children_ + pos + 1, (n->count_ - pos - 1) * sizeof(tree_node *));
+    --n->count_;
+  }
+
+  static void add48(node48 *n, unsigned char byte, tree_node *child) {
+    std::uint16_t slot = 0;
+    while (n->children_[slot] != nullptr) {
+      ++slot;
+    }
+    n->children_[slot] = child;
+    n->index_[byte] = static_cast<unsigned char>(slot + 1);
+    ++n->count_;
+  }
+
+  // moves header fields when a node is replaced by a bigger or smaller one
+  static void move_header(inner_node *from, inner_node *to) {
+    to->prefix_ = std::move(from->prefix_);
+    to->value_ = from->value_;
+    to->count_ = 0;
+  }
+
+  // adds child, growing node (and updating *ref) when it is full
+  static void add_child(tree_node **ref, inner_node *node, unsigned char byte, tree_node *child) {
+    switch (node->kind_) {
+      case node4_kind: {
+        node4 *n = static_cast<node4 *>(node);
+        if (n->count_ < 4) {
+          add_sorted(n, byte, child);
+          return;
+        }
+        node16 *grown = new node16();
+        move_header(n, grown);
+        std::memcpy(grown->keys_, n->keys_, 4);
+        std::memcpy(grown->children_, n->children_, 4 * sizeof(tree_node *));
+        grown->count_ = 4;
+        add_sorted(grown, byte, child);
+        *ref = grown;
+        delete n;
+        return;
+      }
+      case node16_kind: {
+        node16 *n = static_cast<node16 *>(node);
+        if (n->count_ < 16) {
+          add_sorted(n, byte, child);
+          return;
+        }
+        node48 *grown = new node48();
+        move_header(n, grown);
+        for (std::uint16_t i = 0; i < 16; ++i) {
+          add48(grown, n->keys_[i], n->children_[i]);
+        }
+        add48(grown, byte, child);
+        *ref = grown;
+        delete n;
+        return;
+      }
+      case node48_kind: {
+        node48 *n = static_cast<node48 *>(node);
+        if (n->count_ < 48) {
+          add48(n, byte, child);
+          return;
+        }
+        node256 *grown = new node256();
+        move_header(n, grown);
+        for (int b = 0; b < 256; ++b) {
+          if (n->index_[b]) {
+            grown->children_[b] = n->children_[n->index_[b] - 1];
+            ++grown->count_;
+          }
+        }
+        grown->children_[byte] = child;
+        ++grown->count_;
+        *ref = grown;
+        delete n;
+        return;
+      }
+      default: {
+        node256 *n = static_cast<node256 *>(node);
+        n->children_[byte] = child;
+        ++n->count_;
+        return;
+      }
+    }
+  }
+
+  // removes child, shrinking node (and updating *ref) when it gets sparse
+  static void remove_child(tree_node **ref, inner_node *node, unsigned char byte) {
+    switch (node->kind_) {
+      case node4_kind:
+        remove_sorted(static_cast<node4 *>(node), byte);
+        return;
+      case node16_kind: {
+        node16 *n = static_cast<node16 *>(node);
+        remove_sorted(n, byte);
+        if (n->count_ <= 3) {
+          node4 *shrunk = new node4();
+          move_header(n, shrunk);
+          std::memcpy(shrunk->keys_, n->keys_, n->count_);
+          std::memcpy(shrunk->children_, n->children_, n->count_ * sizeof(tree_node *));
+          shrunk->count_ = n->count_;
+          *ref = shrunk;
+          delete n;
+        }
+        return;
+      }
+      case node48_kind: {
+        node48 *n = static_cast<node48 *>(node);
+        n->children_[n->index_[byte] - 1] = nullptr;
+        n->index_[byte] = 0;
+        --n->count_;
+        if (n->count_ <= 12) {
+          node16 *shrunk = new node16();
+          move_header(n, shrunk);
+          for (int b = 0; b < 256; ++b) {
+            if (n->index_[b]) {
+              shrunk->keys_[shrunk->count_] = static_cast<unsigned char>(b);
+              shrunk->children_[shrunk->count_++] = n->children_[n->index_[b] - 1];
+            }
+          }
+          *ref = shrunk;
+          delete n;
+        }
+        return;
+      }
+      default: {
+        node256 *n = static_cast<node256 *>(node);
+        n->children_[byte] = nullptr;
+        --n->count_;
+        if (n->count_ <= 40) {
+          node48 *shrunk = new node48();
+          move_header(n, shrunk);
+          for (int b = 0; b < 256; ++b) {
+            if (n->children_[b]) {
+              add48(shrunk, static_cast<unsigned char>(b), n->children_[b]);
+            }
+          }
+          *ref = shrunk;
+          delete n;
+        }
+        return;
+      }
+    }
+  }
+
+  static void delete_inner(inner_node *node) {
+    switch (node->kind_) {
+      case node4_kind:
+        delete static_cast<node4 *>(node);
+        break;
+      case node16_kind:
+        delete static_cast<node16 *>(node);
+        break;
+      case node48_kind:
+        delete static_cast<node48 *>(node);
+        break;
+      default:
+        delete static_cast<node256 *>(node);
+        break;
+    }
+  }
+
+  // frees inner nodes of a subtree, leaves are owned by the list
+  static void destroy_inner(tree_node *curr) {
+    if (curr == nullptr || curr->kind_ == leaf_kind) {
+      return;
+    }
+    inner_node *node = static_cast<inner_node *>(curr);
+    for (int byte = 0; byte < 256; ++byte) {
+      if (tree_node **child = find_child(node, static_cast<unsigned char>(byte))) {
+        destroy_inner(*child);
+      }
+    }
+    delete_inner(node);
+  }
+
+  // removes key from the tree, restores path compression on the way back
+  bool erase_key(const key_type &key) {
+    tree_node **parent_ref = nullptr;
+    tree_node **ref = &root_;
+    size_type depth = 0;
+    unsigned char byte = 0;
+    while (*ref != nullptr) {
+      tree_node *curr = *ref;
+      if (curr->kind_ == leaf_kind) {
+        leaf *found = static_cast<leaf *>(curr);
+        if (found->value_.first != key) {
+          return false;
+        }
+        if (parent_ref == nullptr) {
+          root_ = nullptr;
+        } else {
+          inner_node *parent = static_cast<inner_node *>(*parent_ref);
+          remove_child(parent_ref, parent, byte);
+          collapse(parent_ref);
+        }
+        drop_leaf(found);
+        return true;
+      }
+      inner_node *node = static_cast<inner_node *>(curr);
+      if (prefix_match(node, key, depth) != node->prefix_.size()) {
+        return false;
+      }
+      depth += node->prefix_.size();
+      if (depth == key.size()) {
+        leaf *found = node->value_;
+        if (found == nullptr) {
+          return false;
+        }
+        node->value_ = nullptr;
+        collapse(ref);
+        drop_leaf(found);
+        return true;
+      }
+      byte = static_cast<unsigned char>(key[depth]);
+      tree_node **child = find_child(node, byte);
+      if (child == nullptr) {
+        return false;
+      }
+      parent_ref = ref;
+      ref = child;
+      ++depth;
+    }
+    return false;
+  }
+
+  void drop_leaf(leaf *item) {
+    unlink(item);
+    delete item;
+    --size_;
+  }
+
+  // replaces an inner node that holds a single entry by that entry
+  void collapse(tree_node **ref) {
+    inner_node *node = static_cast<inner_node *>(*ref);
+    if (node->count_ == 0) {
+      // only the value is left, the leaf keeps its full key
+      *ref = node->value_;
+      delete_inner(node);
+    } else if (node->count_ == 1 && node->value_ == nullptr) {
+      tree_node *child = child_at_or_after(node, 0);
+      if (child->kind_ != leaf_kind) {
+        inner_node *below = static_cast<inner_node *>(child);
+        unsigned char byte = 0;
+        while (find_child(node, byte) == nullptr) {
+          ++byte;
+        }
+        below->prefix_.insert(below->prefix_.begin(), static_cast<char>(byte));
+        below->prefix_.insert(0, node->prefix_);
+      }
+      *ref = child;
+      delete_inner(node);
+    }
+  }
+};
+
+}  // namespace s21
@@ -1,15 +1,569 @@
 #ifndef S21_RB_TREE_HPP
 #define S21_RB_TREE_HPP
 
+#include <algorithm>         // std::stable_sort, std::inplace_merge, std::unique
 #include <functional>        // std::less
 #include <initializer_list>  // std::initializer_list
 #include <limits>            // std::numeric_limits
+#include <memory>            // std::allocator, std::allocator_traits
+#include <memory_resource>   // std::pmr::polymorphic_allocator
 #include <stdexcept>
+#include <thread>
+#include <utility>           // std::exchange, std::pair
 #include <vector>
 
+#include "s21_small_vector.hh"
+
 namespace s21 {
 
-template <typename Key, typename Compare = std::less<Key>>
+/*
+  @brief Stable sort of [first, last) on up to threads threads.
+The range is cut into one chunk per thread, the chunks are sorted
+concurrently and then merged pairwise, each round of merges again
+running in parallel. Small ranges are sorted on the calling thread.
+*/
+template <typename RandomIt, typename Less>
+void parallel_stable_sort(RandomIt first, RandomIt last, Less less, unsigned threads) {
+  constexpr std::size_t kMinChunk = 1 << 14;
+  std::size_t n = last - first;
+  std::size_t chunks = threads ? threads : 1;
+  if (chunks > n / kMinChunk) {
+    chunks = n / kMinChunk;
+  }
+  if (chunks <= 1) {
+    std::stable_sort(first, last, less);
+    return;
+  }
+  std::vector<RandomIt> bounds;
+  for (std::size_t i = 0; i <= chunks; ++i) {
+    bounds.push_back(first + n * i / chunks);
+  }
+  std::vector<std::thread> workers;
+  for (std::size_t i = 0; i + 1 < chunks; ++i) {
+    workers.emplace_back([&bounds, &less, i] { std::stable_sort(bounds[i], bounds[i + 1], less); });
+  }
+  std::stable_sort(bounds[chunks - 1], bounds[chunks], less);
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  // merge neighbours until one run is left, left before right keeps it stable
+  while (bounds.size() > 2) {
+    workers.clear();
+    std::vector<RandomIt> merged;
+    for (std::size_t i = 0; i + 2 < bounds.size(); i += 2) {
+      workers.emplace_back([&bounds, &less, i] {
+        std::inplace_merge(bounds[i], bounds[i + 1], bounds[i + 2], less);
+      });
+      merged.push_back(bounds[i]);
+    }
+    if (bounds.size() % 2 == 0) {
+      merged.push_back(bounds[bounds.size() - 2]);
+    }
+    merged.push_back(bounds.back());
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+    bounds.swap(merged);
+  }
+}
+
+// Colors of red-black tree nodes.
+enum class rb_tree_color : unsigned char { black, red };
+
+/*
+  The key-free part of a red-black tree: rotations, the insert and
+  delete fix-ups and in-order stepping, on any Node with parent_, left_,
+  right_ (Node pointers) and color_ (rb_tree_color) members.
+
+  The tree hangs from a header node end: end->left_ and end->right_ both
+  point to the root, whose parent_ is end, so end is also the
+  past-the-end position of an in-order walk. root is the tree's own copy
+  of the root pointer, kept in step with end. Nothing here compares keys
+  or allocates, so rb_tree (which owns its nodes) and intrusive_set
+  (whose nodes are hooks embedded in the elements) share it.
+*/
+template <typename Node>
+struct rb_tree_algorithms {
+  static constexpr rb_tree_color black = rb_tree_color::black;
+  static constexpr rb_tree_color red = rb_tree_color::red;
+
+  // Stores a child link. The release store publishes a new node's key
+  // together with the link, for rb_tree::optimistic_find() readers that
+  // walk the links with acquire loads while the tree is being modified.
+  static void set_link(Node*& link, Node* child) {
+    __atomic_store_n(&link, child, __ATOMIC_RELEASE);
+  }
+
+  static Node* leftmost(Node* ptr) {
+    while (ptr->left_) {
+      ptr = ptr->left_;
+    }
+    return ptr;
+  }
+
+  static Node* rightmost(Node* ptr) {
+    while (ptr->right_) {
+      ptr = ptr->right_;
+    }
+    return ptr;
+  }
+
+  // To find the successor of a node x with key x.key, we do the following.
+  // 1. If the right subtree of node x is non-empty, then the successor
+  //    of x is just the leftmost node in x's right subtree.
+  // 2. If the right subtree of node x is empty and x has a successor y,
+  //    then y is the lowest ancestor of whose left child is also an ancestor of x.
+  static Node* increment(Node* x) {
+    // If x is the end_ node, then result will be smallest (leftmost node)
+    if (x->right_ != 0) {
+      x = x->right_;
+      while (x->left_) {
+        x = x->left_;
+      }
+    } else {
+      Node* y = x->parent_;
+      while (x == y->right_) {
+        x = y;
+        y = y->parent_;
+      }
+      x = y;
+    }
+    return x;
+  }
+
+  //  см. инкремент
+  static Node* decrement(Node* x) {
+    // If x is the begin node (leftmost), then result will be end_ node.
+    // If x is the end_ node, then result will be maximum (rightmost) node.
+    if (x->left_ != 0) {
+      x = x->left_;
+      while (x->right_) {
+        x = x->right_;
+      }
+    } else {
+      Node* y = x->parent_;
+      while (x == y->left_) {
+        x = y;
+        y = y->parent_;
+      }
+      x = y;
+    }
+    return x;
+  }
+
+  // makes x, which is not in the tree, the root of an empty tree
+  static void link_root(Node* x, Node*& root, Node* end) {
+    root = x;
+    x->parent_ = end;
+    set_link(end->left_, x);
+    set_link(end->right_, x);
+  }
+
+  static void left_rotation(Node* x, Node*& root, Node* end) {
+    if (x->right_) {
+      Node* y = x->right_;
+      set_link(x->right_, y->left_);
+      if (y->left_ != nullptr) {
+        y->left_->parent_ = x;
+      }
+      set_link(y->left_, x);
+
+      y->parent_ = x->parent_;
+      if (x->parent_ == end) {
+        root = y;
+        set_link(end->left_, y);
+        set_link(end->right_, y);
+      } else if (x->parent_->left_ == x) {
+        set_link(x->parent_->left_, y);
+      } else {
+        set_link(x->parent_->right_, y);
+      }
+      x->parent_ = y;
+    }
+  }
+
+  static void right_rotation(Node* x, Node*& root, Node* end) {
+    if (x->left_) {
+      Node* y = x->left_;
+      set_link(x->left_, y->right_);
+      if (y->right_ != nullptr) {
+        y->right_->parent_ = x;
+      }
+      set_link(y->right_, x);
+
+      y->parent_ = x->parent_;
+      if (x->parent_ == end) {
+        root = y;
+        set_link(end->left_, y);
+        set_link(end->right_, y);
+      } else if (x->parent_->left_ == x) {
+        set_link(x->parent_->left_, y);
+      } else {
+        set_link(x->parent_->right_, y);
+      }
+      x->parent_ = y;
+    }
+  }
+
+  /// @brief Restores the red-black properties after the red node K was
+  /// linked in as a leaf by a plain binary tree insertion.
+  static void insert_fixup(Node* K, Node*& root, Node* end) {
+    // Case 1: T is empty
+    // If T is empty, we make K the root of the tree and color it black.
+    if (K == root) {
+      K->color_ = black;
+    }
+    // Case 2: P is black.
+    // If K's parent node P is black, it can not violate any properties.
+    // Therefore, in this case, we do not need to do anything.
+    else if (K->parent_->color_ == black) {
+    }
+    // Case 3: P is red.
+    // If the parent node P is red, this violates the property 4.
+    // P and K are now both red. The grandparent node G must be black node
+    // because the tree before insertion must be a valid red-black tree.
+    // To resolve this case, we need to check whether K's uncle U is red or black.
+    else {
+      while (K->parent_->color_ == red) {
+        Node* P = K->parent_;
+        Node* G = K->parent_->parent_;
+        Node* U;
+        // P is right child
+        if (G->right_ == P) {
+          U = G->left_;
+          // Case 3.2: P is red and U is black (or NULL)
+          // This is more complicated than case 3.1. If th uncle node U is black
+          // we need single or double tree rotations depending upon whether K is
+          // a left or right child of P.
+          if (U == nullptr or U->color_ == black) {
+            // Case 3.2.1: P is right child of G and K is right child of P.
+            // We first perform the left-rotation at G that makes G the new sibling S of K.
+            // Next, we change the color of S to red anp P to black.
+            if (K == P->right_) {
+              left_rotation(G, root, end);
+              switch_color(P);
+              switch_color(G);  // is sibling S after rotation;
+            }
+            // Case 3.2.2: P is right child of G and K is left child of P.
+            // In this case, we first do the right-rotation at P. This reduces it to the case
+            // 3.2.1. We next use the rules given in case 3.2.1 to fix the tree.
+            else {
+              right_rotation(P, root, end);
+              K = P;  // continue to fix the tree
+            }
+          }
+          // Case 3.1: P is red and U is red too.
+          // In this case, we flip the color of nodes P,U, and G. That means,
+          // P becomes black, U becomes black and G becomes red.
+          //
+          // One thing we need to be careful in this case when G is a root of T.
+          // If that is the case, we do not recolor G as it violates property 2.
+          else {
+            switch_color(P);
+            switch_color(U);
+            if (G != root) {
+              switch_color(G);
+              K = G;
+            }
+          }
+        }
+        // mirror cases
+        else {
+          U = G->right_;
+          // Case 3.2
+          if (U == nullptr or U->color_ == black) {
+            // Case 3.2.3: P is left child of G and K is left child of P.
+            // This is the mirror of case 3.2.1. Therefore the solution is
+            // symmetric to the solution of case 3.2.1
+            if (K == P->left_) {
+              right_rotation(G, root, end);
+              switch_color(P);
+              switch_color(G);  // is sibling S after rotation;
+            }
+            // Case 3.2.4: P is left child of G and K is right child op P.
+            // This is the mirror of case 3.2.2. Therefore the solution is
+            // symmetric to the solution of case 3.2.2
+            else {
+              left_rotation(P, root, end);
+              K = P;  // continue to fix the tree
+            }
+          }
+          // Case 3.1
+          else {
+            switch_color(P);
+            switch_color(U);
+            if (G != root) {
+              switch_color(G);
+              K = G;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /// @brief Unlinks K from the tree and rebalances it. K itself is
+  /// left alone, the caller frees or reuses it afterwards.
+  static void erase(Node* K, Node*& root, Node* end) {
+    // Let S and P are sibling and parent nodes of K.
+    // If K has 2 childs, it swaps places with max node in left subtree.
+    // Nodes are relinked rather than keys moved, so const keys (map) work
+    // and iterators to the other node stay valid.
+    if (K->left_ && K->right_) {
+      swap_with_predecessor(K, rightmost(K->left_), root, end);  // Now K has 1 or 0 child
+    }
+    // K1 is a red node with one child. If the red node does not have
+    // one child, then there is a black NIL element instead and the
+    // black height of the red node is 1. Hence, on the other side
+    // the black height must also be 1. But since a red node cannot
+    // have a red child, its other child must be black. Since the
+    // black height must be equal to 1, it can only be a black NIL
+    // element, since the height will be higher in the case of a regular
+    // black element.
+    // Thus, the K1 case does not occur.
+
+    // If K has 1 child (possible only if K is black)
+    // If a black element does not have one child, then there is a black
+    // NIL element with black height 1 instead. Therefore, there must be
+    // a red node without children on the other side. To remove such an
+    // element, just move the value of the red element to the black node,
+    // the black height will be preserved.
+    if (K->left_) {
+      K->left_->color_ = black;
+      K->left_->parent_ = K->parent_;
+      if (K == root) {
+        set_link(K->parent_->left_, K->left_);
+        set_link(K->parent_->right_, K->left_);
+        root = K->left_;
+
+      } else if (K == K->parent_->left_) {
+        set_link(K->parent_->left_, K->left_);
+      } else {
+        set_link(K->parent_->right_, K->left_);
+      }
+      return;
+    } else if (K->right_) {
+      K->right_->color_ = black;
+      K->right_->parent_ = K->parent_;
+      if (K == root) {
+        set_link(K->parent_->left_, K->right_);
+        set_link(K->parent_->right_, K->right_);
+        root = K->right_;
+      } else if (K == K->parent_->left_) {
+        set_link(K->parent_->left_, K->right_);
+      } else {
+        set_link(K->parent_->right_, K->right_);
+      }
+      return;
+    }
+
+    // K has 0 childs.
+    // If K color is red.
+    // Simply delete node, thus it is do not violate tree properties
+    if (K->color_ == red) {
+      unlink_leaf(K, root, end);
+    }
+    // If K color is black.
+    else {
+      fixDelete(K, root, end);
+    }
+  }
+
+  // clear pointers of parent to given node
+  // do not free nodeptr
+  static void unlink_leaf(Node* nodeptr, Node*& root, Node* end) {
+    if (nodeptr == root) {
+      set_link(end->left_, nullptr);
+      set_link(end->right_, nullptr);
+      root = nullptr;
+    }
+    if (nodeptr->parent_->left_ == nodeptr) {
+      set_link(nodeptr->parent_->left_, nullptr);
+    } else {
+      set_link(nodeptr->parent_->right_, nullptr);
+    }
+  }
+
+ private:
+  static void switch_color(Node* x) { x->color_ = x->color_ == black ? red : black; }
+
+  // fix the rb tree modified by the delete operation, unlinking the
+  // black leaf x on the way
+  static void fixDelete(Node* x, Node*& root, Node* end) {
+    // Let S and P are sibling and parent nodes of x.
+    Node *S, *P;
+    bool double_leaf = true;
+    if (x == root) {
+      unlink_leaf(x, root, end);
+      x = nullptr;
+    }
+    while (x != root && x->color_ == black) {
+      P = x->parent_;
+      if (x == P->left_) {
+        S = P->right_;
+        if (S->color_ == red) {
+          // Case 3.1: x's sibling S is red.
+          // In this case, we switch the colors of S and x's parent and perform the left rotation
+          // on x's parent. This reduces case 3.1 to case 3.2, 3.3, or 3.4.
+          S->color_ = black;
+          P->color_ = red;
+          left_rotation(P, root, end);
+          S = P->right_;
+        }
+        // Case 3.2: x's sibling S is black, and both of S's children are black.
+        // The color of x's parent can be red or black. We switch the color of S to
+        // red. If the color of x's parent is red, we change its color to black, and this
+        // becomes the terminal case. Otherwise, we make x's parent a new x and
+        // repeat the process from case 3.1.
+        if (((S->left_ && S->left_->color_ == black) || S->left_ == nullptr) &&
+            ((S->right_ && S->right_->color_ == black) || S->right_ == nullptr)) {
+          if(double_leaf){
+          unlink_leaf(x, root, end);
+          double_leaf = false;
+          }
+
+          S->color_ = red;
+          if (P->color_ == red) {
+            P->color_ = black;
+            break;
+          }
+          P->color_ = black;
+          x = P;
+          continue;
+        }
+        // Case 3.3: x's sibling is black, S's left child is red, and S's right child is
+        // black.
+        // We can switch the colors of S and its left child S->left_ and then perform a right
+        // rotation on s without violating any of the red-black properties. This transforms
+        // the tree into case 3.4.
+        else if ((S->left_ && S->left_->color_ == red) &&
+                 ((S->right_ && S->right_->color_ == black) || S->right_ == nullptr)) {
+          S->left_->color_ = black;
+          S->color_ = red;
+          right_rotation(S, root, end);
+          S = P->right_;
+        }
+        // Case 3.4: x's sibling S is black, and S's right child is red.
+        // This is a terminal case. We change the color of S's right child to black,
+        // x's parent to black, and perform the left rotation on x's parent node. This
+        // way we remove the extra black node on x.
+        if ((S->right_ && S->right_->color_ == red) || S->right_ == nullptr) {
+          S->color_ = x->parent_->color_;
+          x->parent_->color_ = black;
+          S->right_->color_ = black;
+          left_rotation(x->parent_, root, end);
+
+          if(double_leaf){
+          unlink_leaf(x, root, end);
+          double_leaf = false;
+          }
+          x = root;
+        }
+      } else {
+        S = P->left_;
+        if (S->color_ == red) {
+          // Mirror case 3.1
+          S->color_ = black;
+          P->color_ = red;
+          right_rotation(P, root, end);
+          S = P->left_;
+        }
+        // Mirror case 3.2
+        if (((S->right_ && S->right_->color_ == black) || S->right_ == nullptr) &&
+            ((S->left_ && S->left_->color_ == black) || S->left_ == nullptr)) {
+          if(double_leaf){
+          unlink_leaf(x, root, end);
+          double_leaf = false;
+          }
+
+          S->color_ = red;
+          if (P->color_ == red) {
+            P->color_ = black;
+            break;
+          }
+          P->color_ = black;
+          x = P;
+          continue;
+        }
+        // Mirror case 3.3
+        else if ((S->right_ && S->right_->color_ == red) &&
+                 ((S->left_ && S->left_->color_ == black) || S->left_ == nullptr)) {
+          S->right_->color_ = black;
+          S->color_ = red;
+          left_rotation(S, root, end);
+          S = P->left_;
+        }
+        // Mirror case 3.4
+        if (S->left_ && S->left_->color_ == red) {
+          S->color_ = x->parent_->color_;
+          x->parent_->color_ = black;
+          S->left_->color_ = black;
+          right_rotation(x->parent_, root, end);
+
+          if(double_leaf){
+          unlink_leaf(x, root, end);
+          double_leaf = false;
+          }
+          x = root;
+        }
+      }
+    }
+  }
+
+  // puts child in place of old under parent (parent may be end)
+  static void replace_child(Node* parent, Node* old, Node* child, Node*& root, Node* end) {
+    if (parent == end) {
+      root = child;
+      set_link(end->left_, child);
+      set_link(end->right_, child);
+    } else if (parent->left_ == old) {
+      set_link(parent->left_, child);
+    } else {
+      set_link(parent->right_, child);
+    }
+  }
+
+  // exchanges tree positions and colors of x and its in-order
+  // predecessor pred (x has two children, pred has no right child)
+  static void swap_with_predecessor(Node* x, Node* pred, Node*& root, Node* end) {
+    Node* x_parent = x->parent_;
+    Node* pred_parent = pred->parent_;
+    Node* pred_left = pred->left_;
+
+    replace_child(x_parent, x, pred, root, end);
+    pred->parent_ = x_parent;
+    set_link(pred->right_, x->right_);
+    pred->right_->parent_ = pred;
+    if (x->left_ == pred) {
+      set_link(pred->left_, x);
+      x->parent_ = pred;
+    } else {
+      set_link(pred->left_, x->left_);
+      pred->left_->parent_ = pred;
+      set_link(pred_parent->right_, x);
+      x->parent_ = pred_parent;
+    }
+    set_link(x->left_, pred_left);
+    if (pred_left != nullptr) {
+      pred_left->parent_ = x;
+    }
+    set_link(x->right_, nullptr);
+    std::swap(x->color_, pred->color_);
+  }
+};
+
+/*
+  Red-black tree of Key, ordered by Compare.
+
+  Nodes, including the end_ sentinel, are allocated through Allocator
+  rebound to the node type with std::allocator_traits, so a
+  std::pmr::polymorphic_allocator (s21::pmr::rb_tree) puts a whole tree
+  in one memory_resource, e.g. a monotonic_buffer_resource that is
+  dropped with it. Moving or swapping trees hands their nodes over, so
+  their allocators must compare equal unless they propagate; a move
+  assignment between unequal ones copies the elements instead.
+*/
+template <typename Key, typename Compare = std::less<Key>, typename Allocator = std::allocator<Key>>
 class rb_tree {
   using key_type = Key;
   using value_type = Key;
@@ -18,8 +572,9 @@ class rb_tree {
 
   using size_type = std::size_t;
 
-  enum rb_tree_color { black,
-                       red };
+  using rb_tree_color = s21::rb_tree_color;
+  static constexpr rb_tree_color black = rb_tree_color::black;
+  static constexpr rb_tree_color red = rb_tree_color::red;
 
   struct node {
     node *parent_, *left_, *right_;
@@ -34,16 +589,13 @@ class rb_tree {
 
     node(const value_type& key) : parent_(nullptr), left_(nullptr), right_(nullptr), key_(key), color_(rb_tree_color::red){};
     node(const value_type& key, rb_tree_color color) : parent_(nullptr), left_(nullptr), right_(nullptr), key_(key), color_(color){};
-
-    void switch_color() {
-      if (color_ == black) {
-        color_ = red;
-      } else {
-        color_ = black;
-      }
-    }
   };
 
+  using tree_algorithms = rb_tree_algorithms<node>;
+  using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator alloc_;
   node* headptr_;
   // Узел end_ будет одновременно началом (в смысле структуры)
   // и концом ( в смысле итераторов).
@@ -52,6 +604,17 @@ class rb_tree {
   std::size_t size_;
   Compare cmp_{};
 
+ public:
+  using allocator_type = Allocator;
+
+  // Receives every node unlinked by erase() or clear() together with
+  // the function that frees it, see set_retire_hook().
+  using retire_hook = void (*)(void* context, void* nodeptr, void (*destroy)(void*));
+
+ private:
+  retire_hook retire_ = nullptr;
+  void* retire_context_ = nullptr;
+
  public:
   class iterator {
     friend class rb_tree;
@@ -91,24 +654,24 @@ class rb_tree {
     }
 
     iterator operator++() {
-      ptr_ = node_increment(this->ptr_) ;
+      ptr_ = tree_algorithms::increment(this->ptr_) ;
       return *this;
     }
 
     iterator operator++(int) {
       iterator old(*this);
-      this->ptr_ = node_increment(this->ptr_);
+      this->ptr_ = tree_algorithms::increment(this->ptr_);
       return old;
     }
 
     iterator operator--() {
-      ptr_ = node_decrement(this->ptr_) ;
+      ptr_ = tree_algorithms::decrement(this->ptr_) ;
       return *this;
     }
 
     iterator operator--(int) {
       iterator old(*this);
-      this->ptr_ = node_decrement(this->ptr_);
+      this->ptr_ = tree_algorithms::decrement(this->ptr_);
       return old;
     }
 
@@ -126,27 +689,34 @@ class rb_tree {
   */
 
   // default ctor
-  rb_tree() : headptr_(nullptr), endptr_(new node()), size_(0) {
+  rb_tree() : rb_tree(allocator_type()) {}
+
+  // allocates its nodes with alloc
+  explicit rb_tree(const allocator_type& alloc)
+      : alloc_(alloc), headptr_(nullptr), endptr_(create_node()), size_(0) {
     endptr_->parent_ = endptr_;
   }
 
   // init-list ctor
   // duplicates are not allowed
-  rb_tree(std::initializer_list<value_type> init_list) : rb_tree() {
+  rb_tree(std::initializer_list<value_type> init_list,
+          const allocator_type& alloc = allocator_type())
+      : rb_tree(alloc) {
     for (value_type value : init_list) {
       insert(value);
     }
   }
 
   // copy ctor
-  rb_tree(const rb_tree& other) : rb_tree() {
+  rb_tree(const rb_tree& other)
+      : rb_tree(allocator_type(node_traits::select_on_container_copy_construction(other.alloc_))) {
     for(auto key: other){
       insert(key);
     }
   }
 
   // move ctor
-  rb_tree(rb_tree&& other) noexcept : rb_tree() {
+  rb_tree(rb_tree&& other) noexcept : rb_tree(allocator_type(other.alloc_)) {
     std::swap(endptr_, other.endptr_);
     std::swap(headptr_, other.headptr_);
     std::swap(size_, other.size_);
@@ -155,7 +725,7 @@ class rb_tree {
   // destructor
   ~rb_tree() {
     clear();
-    delete endptr_;
+    destroy_node(endptr_);
   }
 
   // copy assigment
@@ -170,18 +740,28 @@ class rb_tree {
   // move assigment
   rb_tree& operator=(rb_tree&& other) {
     clear();
+    if (!(alloc_ == other.alloc_)) {
+      // nodes of another resource cannot be adopted
+      for (auto key : other) {
+        multiinsert(key);
+      }
+      other.clear();
+      return *this;
+    }
     std::swap(endptr_, other.endptr_);
     std::swap(headptr_, other.headptr_);
     std::swap(size_, other.size_);
     return *this;
   }
 
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
   /*
       Iterators
   */
 
   iterator begin() const {
-    return iterator(leftmost(endptr_));
+    return iterator(tree_algorithms::leftmost(endptr_));
   }
 
   iterator end() const {
@@ -221,13 +801,13 @@ class rb_tree {
           nodeptr = nodeptr->right_;
         } else {
           to_delete = std::exchange(nodeptr, nodeptr->parent_);
-          delete_node(to_delete);
-          delete to_delete;
+          tree_algorithms::unlink_leaf(to_delete, headptr_, endptr_);
+          free_node(to_delete);
         }
       }
     }
-    endptr_->left_ = nullptr;
-    endptr_->right_ = nullptr;
+    tree_algorithms::set_link(endptr_->left_, nullptr);
+    tree_algorithms::set_link(endptr_->right_, nullptr);
     headptr_ = nullptr;
     size_ = 0;
   }
@@ -238,291 +818,54 @@ class rb_tree {
   /// element is in the container and bool denoting
   /// whether the insertion took place.
   std::pair<iterator, bool> insert(const value_type& value) {
-    node* x = new node(value);
-    bool successfull = btree_insert(x);
-    iterator it = end();
-    if (successfull) {
-      it = iterator(x);
-      node* K = x;
-      size_++;
-      // Case 1: T is empty
-      // If T is empty, we make K the root of the tree and color it black.
-      if (K == headptr_) {
-        K->color_ = black;
-      }
-      // Case 2: P is black.
-      // If K's parent node P is black, it can not violate any properties.
-      // Therefore, in this case, we do not need to do anything.
-      else if (K->parent_->color_ == black) {
-      }
-      // Case 3: P is red.
-      // If the parent node P is red, this violates the property 4.
-      // P and K are now both red. The grandparent node G must be black node
-      // because the tree before insertion must be a valid red-black tree.
-      // To resolve this case, we need to check whether K's uncle U is red or black.
-      else {
-        while (K->parent_->color_ == red) {
-          node* P = K->parent_;
-          node* G = K->parent_->parent_;
-          node* U;
-          // P is right child
-          if (G->right_ == P) {
-            U = G->left_;
-            // Case 3.2: P is red and U is black (or NULL)
-            // This is more complicated than case 3.1. If th uncle node U is black
-            // we need single or double tree rotations depending upon whether K is
-            // a left or right child of P.
-            if (U == nullptr or U->color_ == black) {
-              // Case 3.2.1: P is right child of G and K is right child of P.
-              // We first perform the left-rotation at G that makes G the new sibling S of K.
-              // Next, we change the color of S to red anp P to black.
-              if (K == P->right_) {
-                left_rotation(G);
-                P->switch_color();
-                G->switch_color();  // is sibling S after rotation;
-              }
-              // Case 3.2.2: P is right child of G and K is left child of P.
-              // In this case, we first do the right-rotation at P. This reduces it to the case
-              // 3.2.1. We next use the rules given in case 3.2.1 to fix the tree.
-              else {
-                right_rotation(P);
-                K = P;  // continue to fix the tree
-              }
-            }
-            // Case 3.1: P is red and U is red too.
-            // In this case, we flip the color of nodes P,U, and G. That means,
-            // P becomes black, U becomes black and G becomes red.
-            //
-            // One thing we need to be careful in this case when G is a root of T.
-            // If that is the case, we do not recolor G as it violates property 2.
-            else {
-              P->switch_color();
-              U->switch_color();
-              if (G != headptr_) {
-                G->switch_color();
-                K = G;
-              }
-            }
-          }
-          // mirror cases
-          else {
-            U = G->right_;
-            // Case 3.2
-            if (U == nullptr or U->color_ == black) {
-              // Case 3.2.3: P is left child of G and K is left child of P.
-              // This is the mirror of case 3.2.1. Therefore the solution is
-              // symmetric to the solution of case 3.2.1
-              if (K == P->right_) {
-                right_rotation(G);
-                P->switch_color();
-                G->switch_color();  // is sibling S after rotation;
-              }
-              // Case 3.2.4: P is left child of G and K is right child op P.
-              // This is the mirror of case 3.2.2. Therefore the solution is
-              // symmetric to the solution of case 3.2.2
-              else {
-                left_rotation(P);
-                K = P;  // continue to fix the tree
-              }
-            }
-            // Case 3.1
-            else {
-              P->switch_color();
-              U->switch_color();
-              if (G != headptr_) {
-                G->switch_color();
-                K=G;
-              }
-            }
-          }
-        }
-      }
-
-    } else {
-      delete x;
-      return std::pair<iterator, bool>(end(), successfull);
-    }
-    
-    return std::pair<iterator, bool>(it, successfull);
-  }
-
-  /// @brief Unlike insert, allows to insert duplicates.
-  /// @param value Value to insert.
-  /// @return Iterator to where the element is.
-  iterator multiinsert(const value_type& value) {
-    node* x = new node(value);
-    btree_multiinsert(x);
-    iterator it = iterator(x);
-    node* K = x;
-    size_++;
-    // Case 1: T is empty
-    // If T is empty, we make K the root of the tree and color it black.
-    if (K == headptr_) {
-      K->color_ = black;
+    node* x = create_node(value);
+    if (!btree_insert(x)) {
+      destroy_node(x);
+      return std::pair<iterator, bool>(end(), false);
     }
-    // Case 2: P is black.
-    // If K's parent node P is black, it can not violate any properties.
-    // Therefore, in this case, we do not need to do anything.
-    else if (K->parent_->color_ == black) {
-    }
-    // Case 3: P is red.
-    // If the parent node P is red, this violates the property 4.
-    // P and K are now both red. The grandparent node G must be black node
-    // because the tree before insertion must be a valid red-black tree.
-    // To resolve this case, we need to check whether K's uncle U is red or black.
-    else {
-      while (K->parent_->color_ == red) {
-        node* P = K->parent_;
-        node* G = K->parent_->parent_;
-        node* U;
-        // P is right child
-        if (G->right_ == P) {
-          U = G->left_;
-          // Case 3.2: P is red and U is black (or NULL)
-          // This is more complicated than case 3.1. If th uncle node U is black
-          // we need single or double tree rotations depending upon whether K is
-          // a left or right child of P.
-          if (U == nullptr or U->color_ == black) {
-            // Case 3.2.1: P is right child of G and K is right child of P.
-            // We first perform the left-rotation at G that makes G the new sibling S of K.
-            // Next, we change the color of S to red anp P to black.
-            if (K == P->right_) {
-              left_rotation(G);
-              P->switch_color();
-              G->switch_color();  // is sibling S after rotation;
-            }
-            // Case 3.2.2: P is right child of G and K is left child of P.
-            // In this case, we first do the right-rotation at P. This reduces it to the case
-            // 3.2.1. We next use the rules given in case 3.2.1 to fix the tree.
-            else {
-              right_rotation(P);
-              K = P;  // continue to fix the tree
-            }
-          }
-          // Case 3.1: P is red and U is red too.
-          // In this case, we flip the color of nodes P,U, and G. That means,
-          // P becomes black, U becomes black and G becomes red.
-          //
-          // One thing we need to be careful in this case when G is a root of T.
-          // If that is the case, we do not recolor G as it violates property 2.
-          else {
-            P->switch_color();
-            U->switch_color();
-            if (G != headptr_) {
-              G->switch_color();
-                K=G;
-            }
-          }
-        }
-        // mirror cases
-        else {
-          U = G->right_;
-          // Case 3.2
-          if (U == nullptr or U->color_ == black) {
-            // Case 3.2.3
-            if (K == P->left_) {
-              right_rotation(G);
-              P->switch_color();
-              G->switch_color();  // is sibling S after rotation;
-            }
-            // Case 3.2.4
-            else {
-              left_rotation(P);
-              K = P;  // continue to fix the tree
-            }
-          }
-          // Case 3.1
-          else {
-            P->switch_color();
-            U->switch_color();
-            if (G != headptr_) {
-              G->switch_color();
-                K=G;
-            }
-          }
-        }
-      }
-    }
-    return it;
+    size_++;
+    tree_algorithms::insert_fixup(x, headptr_, endptr_);
+    return std::pair<iterator, bool>(iterator(x), true);
+  }
+
+  /// @brief Unlike insert, allows to insert duplicates.
+  /// @param value Value to insert.
+  /// @return Iterator to where the element is.
+  iterator multiinsert(const value_type& value) {
+    node* x = create_node(value);
+    btree_multiinsert(x);
+    size_++;
+    tree_algorithms::insert_fixup(x, headptr_, endptr_);
+    return iterator(x);
   }
 
   void erase(const iterator it) {
-    // Let S and P are sibling and parent nodes of K.
     node* K = it.ptr_;
     if (K == endptr_) {
       return;
     }
     --size_;
-    // If K has 2 childs, it value swap with max node in left subtree
-    if (K->left_ && K->right_) {
-      node* Swappable = rightmost(K->left_);
-      K->key_ = std::move(Swappable->key_);
-      K = Swappable;  // Now K has 1 or 0 child
-    }
-    // K1 is a red node with one child. If the red node does not have
-    // one child, then there is a black NIL element instead and the
-    // black height of the red node is 1. Hence, on the other side
-    // the black height must also be 1. But since a red node cannot
-    // have a red child, its other child must be black. Since the
-    // black height must be equal to 1, it can only be a black NIL
-    // element, since the height will be higher in the case of a regular
-    // black element.
-    // Thus, the K1 case does not occur.
-
-    // If K has 1 child (possible only if K is black)
-    // If a black element does not have one child, then there is a black
-    // NIL element with black height 1 instead. Therefore, there must be
-    // a red node without children on the other side. To remove such an
-    // element, just move the value of the red element to the black node,
-    // the black height will be preserved.
-    if (K->left_) {
-      K->left_->color_ = black;
-      K->left_->parent_ = K->parent_;
-      if (K == headptr_) {
-        K->parent_->left_ = K->left_;
-        K->parent_->right_ = K->left_;
-        headptr_ = K->left_;
-
-      } else if (K == K->parent_->left_) {
-        K->parent_->left_ = K->left_;
-      } else {
-        K->parent_->right_ = K->left_;
-      }
-      delete K;
-      return;
-    } else if (K->right_) {
-      K->right_->color_ = black;
-      K->right_->parent_ = K->parent_;
-      if (K == headptr_) {
-        K->parent_->left_ = K->right_;
-        K->parent_->right_ = K->right_;
-        headptr_ = K->right_;
-      } else if (K == K->parent_->left_) {
-        K->parent_->left_ = K->right_;
-      } else {
-        K->parent_->right_ = K->right_;
-      }
-      delete K;
-      return;
-    }
+    tree_algorithms::erase(K, headptr_, endptr_);
+    free_node(K);
+  }
 
-    // K has 0 childs.
-    if (K->left_ == nullptr && K->right_ == nullptr) {
-      // If K color is red.
-      // Simply delete node, thus it is do not violate tree properties
-      if (K->color_ == red) {
-        delete_node(K);
-        delete K;
-      }
-      // If K color is black.
-      else {
-        fixDelete(K);
-      }
-    }
+  /// @brief Makes erase() and clear() hand unlinked nodes to hook
+  /// instead of freeing them, so concurrent optimistic readers can
+  /// finish walking them. hook must eventually call destroy(nodeptr).
+  /// destroy may run after the tree is gone, so the allocator must be
+  /// stateless.
+  void set_retire_hook(retire_hook hook, void* context) {
+    static_assert(node_traits::is_always_equal::value,
+                  "retired nodes are freed without the tree's allocator");
+    retire_ = hook;
+    retire_context_ = context;
   }
 
   //	swaps the contents
   void swap(rb_tree& other) {
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
     std::swap(headptr_, other.headptr_);
     std::swap(endptr_, other.endptr_);
     std::swap(size_, other.size_);
@@ -586,6 +929,33 @@ class rb_tree {
     return it;
   }
 
+  /*
+    @brief Lookup that may run concurrently with one writer thread.
+  Child links are read with acquire loads, pairing with the release
+  stores of rb_tree_algorithms::set_link() in the writer, so every node
+  reached has its key written. The walk gives up after a bounded number
+  of steps, so a tree that is being rebalanced
+  can make it return a wrong answer but never loop or crash, provided
+  that unlinked nodes are not freed under it (see set_retire_hook()).
+  The caller must validate the result, e.g. with a sequence counter.
+    @return Pointer to the element, nullptr if it was not found.
+  */
+  const value_type* optimistic_find(const key_type& key) const {
+    // a red-black tree with 2^64 nodes is at most 128 levels deep
+    constexpr int kMaxDepth = 128;
+    node* curr = __atomic_load_n(&endptr_->left_, __ATOMIC_ACQUIRE);
+    for (int depth = 0; curr && depth < kMaxDepth; ++depth) {
+      if (cmp_(key, curr->key_)) {
+        curr = __atomic_load_n(&curr->left_, __ATOMIC_ACQUIRE);
+      } else if (cmp_(curr->key_, key)) {
+        curr = __atomic_load_n(&curr->right_, __ATOMIC_ACQUIRE);
+      } else {
+        return &curr->key_;
+      }
+    }
+    return nullptr;
+  }
+
   /*
   @brief Returns the number of elements mathcing specific key.
   */
@@ -614,15 +984,7 @@ class rb_tree {
   greater than key, past-the-end iterator is returned as the second element.
   */
   std::pair<iterator, iterator> equal_range(const key_type& key) {
-    iterator start = begin(), end_iterator = end();
-    while (cmp_(*start, key) && start != end_iterator) {
-      start++;
-    }
-    iterator finish = start;
-    while (!cmp_(key, *finish) && finish != end_iterator) {
-      finish++;
-    }
-    return std::pair<iterator, iterator>(start, finish);
+    return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
   }
 
   /*
@@ -634,11 +996,15 @@ class rb_tree {
   past-the-end iterator is returned.
   */
   iterator lower_bound(const Key& key) {
-    iterator it = begin(), end_iterator = end();
-    while (cmp_(*it, key) && it != end_iterator) {
-      it++;
+    node* result = endptr_;
+    for (node* curr = headptr_; curr;) {
+      if (cmp_(curr->key_, key)) {
+        curr = curr->right_;
+      } else {
+        result = std::exchange(curr, curr->left_);
+      }
     }
-    return it;
+    return iterator(result);
   }
 
   /*
@@ -650,11 +1016,15 @@ class rb_tree {
   past-the-end iterator is returned.
   */
   iterator upper_bound(const Key& key) {
-    iterator it = lower_bound(key), end_iterator = end();
-    while (!cmp_(key, *it) && it != end_iterator) {
-      it++;
+    node* result = endptr_;
+    for (node* curr = headptr_; curr;) {
+      if (cmp_(key, curr->key_)) {
+        result = std::exchange(curr, curr->left_);
+      } else {
+        curr = curr->right_;
+      }
     }
-    return it;
+    return iterator(result);
   }
 
   /*
@@ -662,8 +1032,8 @@ class rb_tree {
   */
 
   template <typename... Args>
-  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
-    std::vector<std::pair<iterator, bool>> vec;
+  small_vector<std::pair<iterator, bool>, sizeof...(Args)> insert_many(Args&&... args) {
+    small_vector<std::pair<iterator, bool>, sizeof...(Args)> vec;
     (vec.emplace_back(insert(std::forward<Args>(args))), ...);
     return vec;
   }
@@ -671,114 +1041,166 @@ class rb_tree {
 
 
   template <typename... Args>
-  std::vector<std::pair<iterator, bool>> multiinsert_many(Args&&... args) {
-    std::vector<std::pair<iterator, bool>> vec;
+  small_vector<std::pair<iterator, bool>, sizeof...(Args)> multiinsert_many(Args&&... args) {
+    small_vector<std::pair<iterator, bool>, sizeof...(Args)> vec;
     (vec.emplace_back(std::pair<iterator, bool>{multiinsert(std::forward<Args>(args)), true}), ...);
     return vec;
   }
 
- private:
-  node* leftmost(node* ptr) const {
-    while (ptr->left_) {
-      ptr = ptr->left_;
-    }
-    return ptr;
-  }
+  /*
+      Bulk construction
+  */
 
-  node* rightmost(node* ptr) const {
-    while (ptr->right_) {
-      ptr = ptr->right_;
+  /*
+    @brief Replaces the content with the elements of [first, last), which
+  need not be sorted. The input is sorted on up to threads threads, of
+  every run of equivalent elements only the first one is kept (as with
+  repeated insert()), and the tree is then built bottom-up without a
+  single comparison or rotation, see build_sorted().
+  */
+  template <typename InputIt>
+  void build_parallel(InputIt first, InputIt last, unsigned threads) {
+    std::vector<value_type> values(first, last);
+    std::vector<const value_type*> order;
+    order.reserve(values.size());
+    for (const value_type& value : values) {
+      order.push_back(&value);
     }
-    return ptr;
+    parallel_stable_sort(
+        order.begin(), order.end(),
+        [this](const value_type* lhs, const value_type* rhs) { return cmp_(*lhs, *rhs); },
+        threads);
+    order.erase(std::unique(order.begin(), order.end(),
+                            [this](const value_type* lhs, const value_type* rhs) {
+                              return !cmp_(*lhs, *rhs);
+                            }),
+                order.end());
+    build_sorted(order.begin(), order.end(), threads,
+                 [](const value_type* value) -> const value_type& { return *value; });
   }
 
-  void left_rotation(node* x) {
-    if (x->right_) {
-      node* y = x->right_;
-      x->right_ = y->left_;
-      if (y->left_ != nullptr) {
-        y->left_->parent_ = x;
+  /*
+    @brief Replaces the content with the elements of [first, last), which
+  must already be sorted. Of every run of equivalent elements only the
+  first one is kept. Takes linear time, see build_sorted().
+  */
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last, unsigned threads) {
+    std::vector<const value_type*> unique;
+    for (; first != last; ++first) {
+      if (unique.empty() || cmp_(*unique.back(), *first)) {
+        unique.push_back(&*first);
       }
-      y->left_ = x;
+    }
+    build_sorted(unique.begin(), unique.end(), threads,
+                 [](const value_type* value) -> const value_type& { return *value; });
+  }
 
-      y->parent_ = x->parent_;
-      if (x->parent_ == endptr_) {
-        headptr_ = y;
-        endptr_->left_ = y;
-        endptr_->right_ = y;
-      } else if (x->parent_->left_ == x) {
-        x->parent_->left_ = y;
-      } else {
-        x->parent_->right_ = y;
-      }
-      x->parent_ = y;
+  /*
+    @brief Replaces the content with proj(*it) for every it in [first,
+  last), which must already be strictly increasing.
+    The middle element becomes the root and both halves are built the
+  same way, so the tree is as low as possible. Every level is black
+  except an incomplete last one, which is red, so all paths have the
+  same black height. Above a grain size the left half of a subtree is
+  built on a new thread while the right half is built on the current
+  one, until threads threads are busy.
+  */
+  template <typename RandomIt, typename Proj>
+  void build_sorted(RandomIt first, RandomIt last, unsigned threads, Proj proj) {
+    clear();
+    size_type count = last - first;
+    if (count == 0) {
+      return;
+    }
+    int red_depth = 0;  // floor(log2(count)), the depth of the last level
+    while ((size_type{2} << red_depth) <= count) {
+      ++red_depth;
     }
+    // an allocator with state (a memory_resource) is not assumed to be
+    // thread-safe, so such trees are built on the calling thread
+    if (!threads || !node_traits::is_always_equal::value) {
+      threads = 1;
+    }
+    // the new nodes are linked with plain stores, none is reachable
+    // until the root is published below
+    headptr_ = build_subtree(first, count, 0, red_depth, threads, proj);
+    headptr_->parent_ = endptr_;
+    tree_algorithms::set_link(endptr_->left_, headptr_);
+    tree_algorithms::set_link(endptr_->right_, headptr_);
+    size_ = count;
   }
 
-  void right_rotation(node* x) {
-    if (x->left_) {
-      node* y = x->left_;
-      x->left_ = y->right_;
-      if (y->right_ != nullptr) {
-        y->right_->parent_ = x;
-      }
-      y->right_ = x;
+  /*
+      Parallel traversal
+  */
 
-      y->parent_ = x->parent_;
-      if (x->parent_ == endptr_) {
-        headptr_ = y;
-        endptr_->left_ = y;
-        endptr_->right_ = y;
-      } else if (x->parent_->left_ == x) {
-        x->parent_->left_ = y;
-      } else {
-        x->parent_->right_ = y;
+  /*
+    @brief Cuts [begin(), end()) into consecutive ranges, at least parts
+  of them when the tree is large enough. The boundaries are the nodes of
+  the top levels of the tree, so every range is one such node followed by
+  a whole subtree below them: ranges can be walked concurrently and their
+  results combined in order.
+  */
+  std::vector<std::pair<iterator, iterator>> split_ranges(size_type parts) const {
+    int depth = 0;
+    while ((size_type{1} << depth) < parts && depth < 32) {
+      ++depth;
+    }
+    std::vector<node*> cuts;
+    collect_cuts(headptr_, depth, cuts);
+    std::vector<std::pair<iterator, iterator>> ranges;
+    iterator from = begin();
+    for (node* cut : cuts) {
+      if (iterator(cut) != from) {
+        ranges.emplace_back(from, iterator(cut));
       }
-      x->parent_ = y;
+      from = iterator(cut);
     }
+    if (from != end()) {
+      ranges.emplace_back(from, end());
+    }
+    return ranges;
   }
 
-  // To find the successor of a node x with key x.key, we do the following.
-  // 1. If the right subtree of node x is non-empty, then the successor
-  //    of x is just the leftmost node in x's right subtree.
-  // 2. If the right subtree of node x is empty and x has a successor y,
-  //    then y is the lowest ancestor of whose left child is also an ancestor of x.
-  static node* node_increment(node* x) {
-    // If x is the end_ node, then result will be smallest (leftmost node)
-    if (x->right_ != 0) {
-      x = x->right_;
-      while (x->left_) {
-        x = x->left_;
-      }
+ private:
+  template <typename RandomIt, typename Proj>
+  node* build_subtree(RandomIt first, size_type count, int depth, int red_depth,
+                      unsigned threads, Proj& proj) {
+    constexpr size_type kParallelGrain = 1 << 14;
+    if (count == 0) {
+      return nullptr;
+    }
+    size_type mid = count / 2;
+    node* x = create_node(proj(first[mid]), depth == red_depth && depth > 0 ? red : black);
+    if (threads > 1 && count >= kParallelGrain) {
+      std::thread left([&] {
+        x->left_ = build_subtree(first, mid, depth + 1, red_depth, threads / 2, proj);
+      });
+      x->right_ = build_subtree(first + mid + 1, count - mid - 1, depth + 1, red_depth,
+                                threads - threads / 2, proj);
+      left.join();
     } else {
-      node* y = x->parent_;
-      while (x == y->right_) {
-        x = y;
-        y = y->parent_;
-      }
-      x = y;
+      x->left_ = build_subtree(first, mid, depth + 1, red_depth, 1, proj);
+      x->right_ = build_subtree(first + mid + 1, count - mid - 1, depth + 1, red_depth, 1, proj);
+    }
+    if (x->left_) {
+      x->left_->parent_ = x;
+    }
+    if (x->right_) {
+      x->right_->parent_ = x;
     }
     return x;
   }
 
-  //  см. инкремент
-  static node* node_decrement(node* x) {
-    // If x is the begin node (leftmost), then result will be end_ node.
-    // If x is the end_ node, then result will be maximum (rightmost) node.
-    if (x->left != 0) {
-      x = x->left;
-      while (x->right) {
-        x = x->right;
-      }
-    } else {
-      node* y = x->parent_;
-      while (x == y->left_) {
-        x = y;
-        y = y->parent_;
-      }
-      x = y;
+  // in-order list of the nodes less than depth levels below x
+  void collect_cuts(node* x, int depth, std::vector<node*>& cuts) const {
+    if (!x || depth == 0) {
+      return;
     }
-    return x;
+    collect_cuts(x->left_, depth - 1, cuts);
+    cuts.push_back(x);
+    collect_cuts(x->right_, depth - 1, cuts);
   }
 
   // binary tree insertion that violated red-black tree properties
@@ -799,16 +1221,13 @@ class rb_tree {
 
       // if insert key less parent node
       if (cmp_(ptr->key_, parent->key_)) {
-        parent->left_ = ptr;
+        tree_algorithms::set_link(parent->left_, ptr);
       } else {
-        parent->right_ = ptr;
+        tree_algorithms::set_link(parent->right_, ptr);
       }
       ptr->parent_ = parent;
     } else {
-      headptr_ = ptr;
-      headptr_->parent_ = endptr_;
-      endptr_->left_ = headptr_;
-      endptr_->right_ = headptr_;
+      tree_algorithms::link_root(ptr, headptr_, endptr_);
     }
     return true;
   }
@@ -830,165 +1249,59 @@ class rb_tree {
 
       // if insert key less or equal parent node
       if (cmp_(ptr->key_, parent->key_)) {
-        parent->left_ = ptr;
+        tree_algorithms::set_link(parent->left_, ptr);
       } else {
-        parent->right_ = ptr;
+        tree_algorithms::set_link(parent->right_, ptr);
       }
       ptr->parent_ = parent;
 
     } else {
-      headptr_ = ptr;
-      headptr_->parent_ = endptr_;
-      endptr_->left_ = headptr_;
-      endptr_->right_ = headptr_;
+      tree_algorithms::link_root(ptr, headptr_, endptr_);
     }
   }
 
-  // fix the rb tree modified by the delete operation
-  void fixDelete(node* x) {
-    // Let S and P are sibling and parent nodes of x.
-    node *S, *P;
-    bool double_leaf = true;
-    if (x == headptr_) {
-      delete_node(x);
-      delete x;
-      headptr_ = nullptr;
-      x = nullptr;
+  template <typename... Args>
+  node* create_node(Args&&... args) {
+    node* nodeptr = node_traits::allocate(alloc_, 1);
+    try {
+      node_traits::construct(alloc_, nodeptr, std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(alloc_, nodeptr, 1);
+      throw;
     }
-    while (x != headptr_ && x->color_ == black) {
-      P = x->parent_;
-      if (x == P->left_) {
-        S = P->right_;
-        if (S->color_ == red) {
-          // Case 3.1: x's sibling S is red.
-          // In this case, we switch the colors of S and x's parent and perform the left rotation
-          // on x's parent. This reduces case 3.1 to case 3.2, 3.3, or 3.4.
-          S->color_ = black;
-          P->color_ = red;
-          left_rotation(P);
-          S = P->right_;
-        }
-        // Case 3.2: x's sibling S is black, and both of S's children are black.
-        // The color of x's parent can be red or black. We switch the color of S to
-        // red. If the color of x's parent is red, we change its color to black, and this
-        // becomes the terminal case. Otherwise, we make x's parent a new x and
-        // repeat the process from case 3.1.
-        if (((S->left_ && S->left_->color_ == black) || S->left_ == nullptr) &&
-            ((S->right_ && S->right_->color_ == black) || S->right_ == nullptr)) {
-          if(double_leaf){
-          delete_node(x);
-          delete x;
-          double_leaf = false;
-          }
-
-          S->color_ = red;
-          if (P->color_ == red) {
-            P->color_ = black;
-            break;
-          }
-          P->color_ = black;
-          x = P;
-          continue;
-        }
-        // Case 3.3: x's sibling is black, S's left child is red, and S's right child is
-        // black.
-        // We can switch the colors of S and its left child S->left_ and then perform a right
-        // rotation on s without violating any of the red-black properties. This transforms
-        // the tree into case 3.4.
-        else if ((S->left_ && S->left_->color_ == red) &&
-                 ((S->right_ && S->right_->color_ == black) || S->right_ == nullptr)) {
-          S->left_->color_ = black;
-          S->color_ = red;
-          right_rotation(S);
-          S = P->right_;
-        }
-        // Case 3.4: x's sibling S is black, and S's right child is red.
-        // This is a terminal case. We change the color of S's right child to black,
-        // x's parent to black, and perform the left rotation on x's parent node. This
-        // way we remove the extra black node on x.
-        if ((S->right_ && S->right_->color_ == red) || S->right_ == nullptr) {
-          S->color_ = x->parent_->color_;
-          x->parent_->color_ = black;
-          S->right_->color_ = black;
-          left_rotation(x->parent_);
+    return nodeptr;
+  }
 
-          if(double_leaf){
-          delete_node(x);
-          delete x;
-          double_leaf = false;
-          }
-          x = headptr_;
-        }
-      } else {
-        S = P->left_;
-        if (S->color_ == red) {
-          // Mirror case 3.1
-          S->color_ = black;
-          P->color_ = red;
-          right_rotation(P);
-          S = P->left_;
-        }
-        // Mirror case 3.2
-        if (((S->right_ && S->right_->color_ == black) || S->right_ == nullptr) &&
-            ((S->left_ && S->left_->color_ == black) || S->left_ == nullptr)) {
-          if(double_leaf){
-          delete_node(x);
-          delete x;
-          double_leaf = false;
-          }
+  void destroy_node(node* nodeptr) {
+    node_traits::destroy(alloc_, nodeptr);
+    node_traits::deallocate(alloc_, nodeptr, 1);
+  }
 
-          S->color_ = red;
-          if (P->color_ == red) {
-            P->color_ = black;
-            break;
-          }
-          P->color_ = black;
-          x = P;
-          continue;
-        }
-        // Mirror case 3.3
-        else if ((S->right_ && S->right_->color_ == red) &&
-                 ((S->left_ && S->left_->color_ == black) || S->left_ == nullptr)) {
-          S->right_->color_ = black;
-          S->color_ = red;
-          left_rotation(S);
-          S = P->left_;
-        }
-        // Mirror case 3.4
-        if ((S->left_ && S->left_->color_ == black) || S->left_ == nullptr) {
-          S->color_ = x->parent_->color_;
-          x->parent_->color_ = black;
-          S->left_->color_ = black;
-          right_rotation(x->parent_);
+  // the destroy function handed to the retire hook, see set_retire_hook()
+  static void destroy_retired(void* nodeptr) {
+    node_allocator alloc;
+    node_traits::destroy(alloc, static_cast<node*>(nodeptr));
+    node_traits::deallocate(alloc, static_cast<node*>(nodeptr), 1);
+  }
 
-          if(double_leaf){
-          delete_node(x);
-          delete x;
-          double_leaf = false;
-          }
-          x = headptr_;
-        }
+  // frees an unlinked node or passes it to the retire hook
+  void free_node(node* nodeptr) {
+    if constexpr (node_traits::is_always_equal::value) {
+      if (retire_) {
+        retire_(retire_context_, nodeptr, destroy_retired);
+        return;
       }
     }
+    destroy_node(nodeptr);
   }
+};
 
-  // clear pointers of parent to given node
-  // do not free nodeptr
-  void delete_node(node* nodeptr) {
-    if (nodeptr == headptr_) {
-      endptr_->left_ = nullptr;
-      endptr_->right_ = nullptr;
-      headptr_ = nullptr;
-    }
-    if (nodeptr->parent_->left_ == nodeptr) {
-      nodeptr->parent_->left_ = nullptr;
-    } else {
-      nodeptr->parent_->right_ = nullptr;
-    }
-  }
+namespace pmr {
 
+template <typename Key, typename Compare = std::less<Key>>
+using rb_tree = s21::rb_tree<Key, Compare, std::pmr::polymorphic_allocator<Key>>;
 
-};
+}  // namespace pmr
 
 }  // namespace s21
 
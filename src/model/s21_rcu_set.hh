@@ -0,0 +1,138 @@
+#pragma once
+
+#include <atomic>
+#include <functional>  // std::less
+#include <initializer_list>
+
+#include "s21_epoch.hh"
+#include "s21_persistent_rb_tree.hh"
+
+namespace s21 {
+
+/*
+  Ordered set for one writer thread and any number of reader threads,
+  in the read-copy-update style.
+
+  The writer keeps a private persistent_rb_tree. Every update copies only
+  the root-to-leaf path it changes, then publishes the new version with a
+  release store of one pointer. Readers pin an epoch, load that pointer
+  with acquire and walk an immutable tree. A lookup never retries, locks
+  or allocates, so it is wait-free and always exact; it sees either the
+  version before an update or the one after it.
+
+  A replaced version is retired to an epoch_domain and freed only once
+  every reader that could still be walking it has unpinned. Freeing a
+  version releases just the nodes no newer version shares.
+
+  All modifiers must be called from the same thread (or under an external
+  writer lock).
+*/
+template <typename Key, typename Compare = std::less<Key>>
+class rcu_set {
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+
+ public:
+  using tree_type = persistent_rb_tree<Key, Compare>;
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  rcu_set() : published_(new tree_type()) {}
+
+  // init-list ctor
+  rcu_set(std::initializer_list<value_type> init_list) : rcu_set() {
+    update([&init_list](tree_type &tree) {
+      for (const value_type &value : init_list) {
+        tree.insert(value);
+      }
+    });
+  }
+
+  rcu_set(const rcu_set &) = delete;
+  rcu_set &operator=(const rcu_set &) = delete;
+
+  // destructor, no reader may be running
+  ~rcu_set() { delete published_.load(std::memory_order_relaxed); }
+
+  /*
+      Capacity (any thread)
+  */
+
+  bool empty() const { return size() == 0; }
+
+  size_type size() const {
+    epoch_domain::guard guard = epoch_.pin_guard();
+    return published_.load(std::memory_order_acquire)->size();
+  }
+
+  /*
+      Modifiers (writer thread only)
+  */
+
+  void clear() {
+    update([](tree_type &tree) { tree.clear(); });
+  }
+
+  // @return true if the insertion took place
+  bool insert(const value_type &value) {
+    if (working_.contains(value)) {
+      return false;
+    }
+    update([&value](tree_type &tree) { tree.insert(value); });
+    return true;
+  }
+
+  // @return the number of elements removed (0 or 1)
+  size_type erase(const key_type &key) {
+    if (!working_.contains(key)) {
+      return 0;
+    }
+    update([&key](tree_type &tree) { tree.erase(key); });
+    return 1;
+  }
+
+  /*
+  @brief Applies fn(tree_type&) to the writer's tree and publishes the
+  result as one new version, so readers see all of a batch or none of it.
+  */
+  template <typename Fn>
+  void update(Fn fn) {
+    fn(working_);
+    tree_type *old = published_.exchange(new tree_type(working_),
+                                         std::memory_order_acq_rel);
+    epoch_.retire(old, destroy_version);
+  }
+
+  /*
+      Lookup (any thread)
+  */
+
+  // wait-free: one pin, one acquire load and a walk down the tree
+  bool contains(const key_type &key) const {
+    epoch_domain::guard guard = epoch_.pin_guard();
+    return published_.load(std::memory_order_acquire)->contains(key);
+  }
+
+  /// @brief The latest published version, shares every node with it.
+  /// It can be iterated for as long as the caller likes.
+  tree_type snapshot() const {
+    epoch_domain::guard guard = epoch_.pin_guard();
+    return *published_.load(std::memory_order_acquire);
+  }
+
+ private:
+  static void destroy_version(void *version) {
+    delete static_cast<tree_type *>(version);
+  }
+
+  // declared first: retired versions are freed when it is destroyed
+  mutable epoch_domain epoch_;
+  alignas(64) std::atomic<tree_type *> published_;
+  tree_type working_;
+};
+
+}  // namespace s21
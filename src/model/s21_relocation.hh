@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>  // std::size_t, std::max_align_t
+#include <cstdlib>  // std::malloc, std::realloc, std::free
+#include <cstring>  // std::memcpy
+#include <new>      // placement new, std::bad_alloc, std::align_val_t
+#include <type_traits>
+#include <utility>  // std::move_if_noexcept
+
+namespace s21 {
+
+/*
+  Whether an object of type T can be moved to another address by copying
+  its bytes and forgetting the original, without running a constructor
+  or destructor. True for types that are trivially movable and trivially
+  destructible; specialize it for other types where it holds (most types
+  that only own heap memory, such as a class around a single pointer).
+*/
+template <typename T>
+struct is_trivially_relocatable
+    : std::integral_constant<bool, std::is_trivially_move_constructible<T>::value &&
+                                       std::is_trivially_destructible<T>::value> {};
+
+/*
+  Heap blocks of T shared by s21::vector and s21::small_vector, so both
+  grow and move their elements by the same rules. Blocks come from
+  std::malloc, or from aligned operator new when T is over-aligned.
+  Trivially relocatable elements are moved by std::realloc (which can
+  often extend the block in place) or by std::memcpy when T is
+  over-aligned; other types are move-constructed one by one (copied if
+  their move constructor may throw).
+*/
+template <typename T>
+struct relocation {
+  using size_type = std::size_t;
+
+  static constexpr bool kRelocatable = is_trivially_relocatable<T>::value;
+  static constexpr bool kOverAligned = alignof(T) > alignof(std::max_align_t);
+
+  // at least count, otherwise capacity times Growth (a std::ratio), or
+  // min_capacity when there is no capacity yet; never above max_size
+  template <typename Growth>
+  static size_type grown_capacity(size_type capacity, size_type count, size_type min_capacity,
+                                  size_type max_size) {
+    size_type grown = capacity ? capacity / Growth::den * Growth::num +
+                                     capacity % Growth::den * Growth::num / Growth::den
+                               : min_capacity;
+    if (grown < capacity || grown > max_size) {
+      grown = max_size;
+    }
+    return grown < count ? count : grown;
+  }
+
+  static T *allocate(size_type count) {
+    if constexpr (kOverAligned) {
+      return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+    } else {
+      void *block = std::malloc(count * sizeof(T));
+      if (!block) {
+        throw std::bad_alloc();
+      }
+      return static_cast<T *>(block);
+    }
+  }
+
+  static void deallocate(T *block) {
+    if constexpr (kOverAligned) {
+      ::operator delete(block, std::align_val_t(alignof(T)));
+    } else {
+      std::free(block);
+    }
+  }
+
+  // moves count elements from one buffer to another, destroying the
+  // originals; if a move throws, from is left as it was
+  static void relocate(T *from, size_type count, T *to) {
+    if constexpr (kRelocatable) {
+      if (count) {
+        std::memcpy(static_cast<void *>(to), static_cast<const void *>(from), count * sizeof(T));
+      }
+    } else {
+      size_type moved = 0;
+      try {
+        for (; moved < count; ++moved) {
+          new (to + moved) T(std::move_if_noexcept(from[moved]));
+        }
+      } catch (...) {
+        while (moved) {
+          to[--moved].~T();
+        }
+        throw;
+      }
+      for (size_type i = 0; i < count; ++i) {
+        from[i].~T();
+      }
+    }
+  }
+
+  // moves count elements from any buffer into a new block for capacity
+  // elements; the source buffer is not freed
+  static T *relocate_to_new(T *from, size_type count, size_type capacity) {
+    T *fresh = allocate(capacity);
+    try {
+      relocate(from, count, fresh);
+    } catch (...) {
+      deallocate(fresh);
+      throw;
+    }
+    return fresh;
+  }
+
+  // moves count elements of a heap block (or nullptr) into a block for
+  // capacity elements and returns it; the old block is freed
+  static T *reallocate(T *block, size_type count, size_type capacity) {
+    if constexpr (kRelocatable && !kOverAligned) {
+      void *grown = std::realloc(static_cast<void *>(block), capacity * sizeof(T));
+      if (!grown) {
+        throw std::bad_alloc();
+      }
+      return static_cast<T *>(grown);
+    } else {
+      T *fresh = relocate_to_new(block, count, capacity);
+      deallocate(block);
+      return fresh;
+    }
+  }
+};
+
+}  // namespace s21
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <new>      // operator new, std::align_val_t
+#include <utility>  // std::exchange, std::swap
+
+namespace s21 {
+
+/*
+  Uninitialized storage for a ring of power-of-two capacity.
+
+  Positions are free-running counters: slot(i) maps any i onto the ring
+  with one mask, so a position can simply be incremented forever (and
+  wrap around at the end of size_t) without ever being reduced. The ring
+  does not know which slots hold objects; constructing and destroying
+  them is up to the owner.
+*/
+template <typename T>
+class ring_buffer {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  /*
+      Member functions
+  */
+
+  // default ctor, no storage
+  ring_buffer() : data_(nullptr), mask_(0) {}
+
+  // storage for at least capacity objects
+  explicit ring_buffer(size_type capacity)
+      : data_(nullptr), mask_(round_up(capacity) - 1) {
+    data_ = static_cast<T *>(::operator new(sizeof(T) * (mask_ + 1),
+                                            std::align_val_t(alignof(T))));
+  }
+
+  ring_buffer(const ring_buffer &) = delete;
+  ring_buffer &operator=(const ring_buffer &) = delete;
+
+  // move ctor
+  ring_buffer(ring_buffer &&other) noexcept
+      : data_(std::exchange(other.data_, nullptr)),
+        mask_(std::exchange(other.mask_, 0)) {}
+
+  // move assigment
+  ring_buffer &operator=(ring_buffer &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  // destructor, releases the storage only
+  ~ring_buffer() {
+    if (data_) {
+      ::operator delete(data_, std::align_val_t(alignof(T)));
+    }
+  }
+
+  /*
+      Capacity
+  */
+
+  size_type capacity() const { return data_ ? mask_ + 1 : 0; }
+
+  // smallest power of two not less than capacity, at least 1
+  static constexpr size_type round_up(size_type capacity) {
+    size_type result = 1;
+    while (result < capacity) {
+      result <<= 1;
+    }
+    return result;
+  }
+
+  /*
+      Element access
+  */
+
+  T *slot(size_type position) const { return data_ + (position & mask_); }
+
+  /*
+      Modifiers
+  */
+
+  void swap(ring_buffer &other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(mask_, other.mask_);
+  }
+
+ private:
+  T *data_;
+  size_type mask_;
+};
+
+}  // namespace s21
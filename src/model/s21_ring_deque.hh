@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <initializer_list>
+#include <new>      // placement new
+#include <utility>  // std::exchange, std::forward, std::move, std::move_if_noexcept, std::swap
+
+#include "s21_ring_buffer.hh"
+
+namespace s21 {
+
+/*
+  Sequence that grows at the back and shrinks at the front, stored in
+  one contiguous ring.
+
+  The elements occupy the positions [head_, head_ + size_) of a
+  ring_buffer, so push_back() and pop_front() only move an index and
+  never shift or allocate until the ring is full. Then the ring doubles
+  and the elements are moved over in order, which keeps push_back()
+  amortized O(1). Unlike deque, growing moves the elements, so
+  references do not survive a push that grows the ring; in exchange the
+  whole queue is one block that is walked without any indirection.
+*/
+template <typename T>
+class ring_deque {
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+ public:
+  static constexpr size_type kMinCapacity = 8;
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  ring_deque() : head_(0), size_(0) {}
+
+  // init-list ctor
+  ring_deque(std::initializer_list<value_type> const &items) : ring_deque() {
+    reserve(items.size());
+    for (const value_type &value : items) {
+      push_back(value);
+    }
+  }
+
+  // copy ctor
+  ring_deque(const ring_deque &other) : ring_deque() {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; ++i) {
+      push_back(*other.ring_.slot(other.head_ + i));
+    }
+  }
+
+  // move ctor
+  ring_deque(ring_deque &&other) noexcept
+      : ring_(std::move(other.ring_)),
+        head_(std::exchange(other.head_, 0)),
+        size_(std::exchange(other.size_, 0)) {}
+
+  // destructor
+  ~ring_deque() { clear(); }
+
+  // copy assigment
+  ring_deque &operator=(const ring_deque &other) {
+    if (this != &other) {
+      ring_deque copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  // move assigment
+  ring_deque &operator=(ring_deque &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  /*
+      Element access
+  */
+
+  reference front() { return *ring_.slot(head_); }
+
+  const_reference front() const { return *ring_.slot(head_); }
+
+  reference back() { return *ring_.slot(head_ + size_ - 1); }
+
+  const_reference back() const { return *ring_.slot(head_ + size_ - 1); }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type capacity() const { return ring_.capacity(); }
+
+  // makes room for count elements without further allocation
+  void reserve(size_type count) {
+    if (count > ring_.capacity()) {
+      regrow(count);
+    }
+  }
+
+  /*
+      Modifiers
+  */
+
+  void clear() {
+    for (; size_; --size_) {
+      ring_.slot(head_++)->~value_type();
+    }
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == ring_.capacity()) {
+      // the value is built before growing, args may refer into the ring
+      value_type value(std::forward<Args>(args)...);
+      regrow(size_ + 1);
+      return construct_back(std::move(value));
+    }
+    return construct_back(std::forward<Args>(args)...);
+  }
+
+  void pop_front() {
+    ring_.slot(head_)->~value_type();
+    ++head_;
+    --size_;
+  }
+
+  void swap(ring_deque &other) noexcept {
+    ring_.swap(other.ring_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  template <typename... Args>
+  reference construct_back(Args &&...args) {
+    value_type *place = ring_.slot(head_ + size_);
+    new (place) value_type(std::forward<Args>(args)...);
+    ++size_;
+    return *place;
+  }
+
+  // moves the elements, in order, to the front of a ring of at least
+  // max(count, 2 * capacity) slots
+  void regrow(size_type count) {
+    size_type capacity = ring_.capacity() ? 2 * ring_.capacity() : kMinCapacity;
+    ring_buffer<value_type> grown(capacity < count ? count : capacity);
+    size_type moved = 0;
+    try {
+      for (; moved < size_; ++moved) {
+        new (grown.slot(moved)) value_type(std::move_if_noexcept(*ring_.slot(head_ + moved)));
+      }
+    } catch (...) {
+      while (moved) {
+        grown.slot(--moved)->~value_type();
+      }
+      throw;
+    }
+    for (size_type i = 0; i < size_; ++i) {
+      ring_.slot(head_ + i)->~value_type();
+    }
+    ring_.swap(grown);
+    head_ = 0;
+  }
+
+  ring_buffer<value_type> ring_;
+  size_type head_;  // position of front(), free-running
+  size_type size_;
+};
+
+}  // namespace s21
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>     // std::uint64_t
+#include <functional>  // std::less
+#include <initializer_list>
+#include <optional>
+#include <stdexcept>    // std::out_of_range
+#include <thread>       // std::this_thread::yield
+#include <type_traits>  // std::is_trivially_copyable
+#include <utility>      // std::pair
+
+#include "s21_epoch.hh"
+#include "s21_rb_tree.hh"
+
+namespace s21 {
+
+/*
+  Ordered map for one writer thread and any number of reader threads.
+
+  Readers never lock and never write shared memory: find() and contains()
+  read the sequence counter, walk the tree optimistically and accept the
+  result only if the counter is even and unchanged afterwards. The writer
+  makes the counter odd for the whole of each mutation, including every
+  rotation done by the rebalancing, and even again when it is done.
+
+  Nodes unlinked by the writer are retired to an epoch_domain instead of
+  being freed, so a reader that raced with an erase still walks valid
+  memory; pinning only touches the reader's own cache line. Because a
+  reader may copy a value while it is being written, Key and T must be
+  trivially copyable.
+
+  All modifiers must be called from the same thread (or under an external
+  writer lock).
+*/
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class seqlock_map {
+  static_assert(std::is_trivially_copyable<Key>::value &&
+                    std::is_trivially_copyable<T>::value,
+                "seqlock_map readers copy racing values, so key and "
+                "mapped types must be trivially copyable");
+
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  // map elements are compared by key value
+  struct value_compare {
+    bool operator()(const_reference lhs, const_reference rhs) const {
+      return Compare{}(lhs.first, rhs.first);
+    }
+  };
+  using tree_type = rb_tree<value_type, value_compare>;
+
+ public:
+  /*
+      Member functions
+  */
+
+  // default ctor
+  seqlock_map() : version_(0), size_(0) {
+    tree_.set_retire_hook(retire, &epoch_);
+  }
+
+  // init-list ctor
+  seqlock_map(const std::initializer_list<value_type> &items) : seqlock_map() {
+    for (const value_type &value : items) {
+      insert(value);
+    }
+  }
+
+  seqlock_map(const seqlock_map &) = delete;
+  seqlock_map &operator=(const seqlock_map &) = delete;
+
+  // destructor, no reader may be running
+  ~seqlock_map() = default;
+
+  /*
+      Element access
+  */
+
+  // copy of the mapped value, throws std::out_of_range if there is none
+  mapped_type at(const key_type &key) const {
+    std::optional<mapped_type> value = find(key);
+    if (!value) {
+      throw std::out_of_range("No such element exists");
+    }
+    return *value;
+  }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size() == 0; }
+
+  size_type size() const { return size_.load(std::memory_order_acquire); }
+
+  size_type max_size() const { return tree_.max_size(); }
+
+  /*
+      Modifiers (writer thread only)
+  */
+
+  void clear() {
+    write([this] { tree_.clear(); });
+  }
+
+  // @return true if the insertion took place
+  bool insert(const value_type &value) {
+    if (tree_.contains(value)) {
+      return false;
+    }
+    write([this, &value] { tree_.insert(value); });
+    return true;
+  }
+
+  // @return true if the insertion took place
+  bool insert(const key_type &key, const mapped_type &obj) {
+    return insert(value_type{key, obj});
+  }
+
+  // @return true if the insertion took place and false if the assignment took place
+  bool insert_or_assign(const key_type &key, const mapped_type &obj) {
+    auto it = tree_.find(value_type{key, mapped_type{}});
+    if (it == tree_.end()) {
+      return insert(key, obj);
+    }
+    write([&it, &obj] { (*it).second = obj; });
+    return false;
+  }
+
+  // @return the number of elements removed (0 or 1)
+  size_type erase(const key_type &key) {
+    auto it = tree_.find(value_type{key, mapped_type{}});
+    if (it == tree_.end()) {
+      return 0;
+    }
+    write([this, &it] { tree_.erase(it); });
+    return 1;
+  }
+
+  /*
+      Lookup (any thread)
+  */
+
+  // a copy of the mapped value, or nothing if the key is absent
+  std::optional<mapped_type> find(const key_type &key) const {
+    epoch_domain::guard guard = epoch_.pin_guard();
+    const value_type probe{key, mapped_type{}};
+    for (;;) {
+      std::uint64_t version = read_begin();
+      const value_type *found = tree_.optimistic_find(probe);
+      std::optional<mapped_type> value;
+      if (found) {
+        value = found->second;
+      }
+      if (read_validate(version)) {
+        return value;
+      }
+    }
+  }
+
+  bool contains(const key_type &key) const {
+    epoch_domain::guard guard = epoch_.pin_guard();
+    const value_type probe{key, mapped_type{}};
+    for (;;) {
+      std::uint64_t version = read_begin();
+      bool found = tree_.optimistic_find(probe) != nullptr;
+      if (read_validate(version)) {
+        return found;
+      }
+    }
+  }
+
+  // even value that changes with every completed modification
+  std::uint64_t version() const {
+    return version_.load(std::memory_order_acquire) & ~std::uint64_t{1};
+  }
+
+ private:
+  static void retire(void *context, void *nodeptr, void (*destroy)(void *)) {
+    static_cast<epoch_domain *>(context)->retire(nodeptr, destroy);
+  }
+
+  // runs one mutation with the counter odd
+  template <typename Fn>
+  void write(Fn fn) {
+    std::uint64_t version = version_.load(std::memory_order_relaxed);
+    version_.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    fn();
+    size_.store(tree_.size(), std::memory_order_relaxed);
+    version_.store(version + 2, std::memory_order_release);
+  }
+
+  // waits out a writer and returns the even counter
+  std::uint64_t read_begin() const {
+    std::uint64_t version = version_.load(std::memory_order_acquire);
+    while (version & 1) {
+      std::this_thread::yield();
+      version = version_.load(std::memory_order_acquire);
+    }
+    return version;
+  }
+
+  bool read_validate(std::uint64_t version) const {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return version_.load(std::memory_order_relaxed) == version;
+  }
+
+  // declared first: the tree retires its last nodes while it is destroyed
+  mutable epoch_domain epoch_;
+  alignas(64) std::atomic<std::uint64_t> version_;
+  std::atomic<size_type> size_;
+  tree_type tree_;
+};
+
+}  // namespace s21
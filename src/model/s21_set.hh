@@ -1,23 +1,29 @@
 #pragma once
 
+#include <memory>           // std::allocator
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+
 #include "s21_rb_tree.hh"
 
 namespace s21 {
 
 template <
     typename Key,
-    typename Compare = std::less<Key>>
+    typename Compare = std::less<Key>,
+    typename Allocator = std::allocator<Key>>
 class set {
   using key_type = Key;
   using value_type = Key;
   using reference = value_type&;
   using const_reverence = const value_type&;
-  using iterator = typename rb_tree<Key, Compare>::iterator;
+  using iterator = typename rb_tree<Key, Compare, Allocator>::iterator;
   using size_type = std::size_t;
 
-  using tree_type = rb_tree<Key, Compare>;
+  using tree_type = rb_tree<Key, Compare, Allocator>;
 
  public:
+  using allocator_type = Allocator;
+
   /*
       Member functions
   */
@@ -25,8 +31,13 @@ class set {
   // default ctor
   set() = default;
 
+  // allocates its nodes with alloc
+  explicit set(const allocator_type& alloc) : tree_(alloc) {}
+
   // init-list ctor
-  set(std::initializer_list<value_type> const& items) {
+  set(std::initializer_list<value_type> const& items,
+      const allocator_type& alloc = allocator_type())
+      : tree_(alloc) {
     for (value_type value : items) {
       tree_.insert(value);
     }
@@ -53,6 +64,35 @@ class set {
     return *this;
   }
 
+  /*
+  @brief Builds a set from an unsorted range: the keys are sorted in
+  parallel, duplicates are dropped and the tree is built in parallel,
+  with no per-element descent or fix-up. The nodes come from alloc.
+  */
+  template <typename InputIt>
+  static set build_parallel(InputIt first, InputIt last,
+                            unsigned threads = std::thread::hardware_concurrency(),
+                            const allocator_type& alloc = allocator_type()) {
+    set result(alloc);
+    result.tree_.build_parallel(first, last, threads);
+    return result;
+  }
+
+  // Builds a set from a sorted range in linear time, duplicates are dropped.
+  // The nodes come from alloc.
+  template <typename ForwardIt>
+  static set from_sorted(ForwardIt first, ForwardIt last,
+                         unsigned threads = std::thread::hardware_concurrency(),
+                         const allocator_type& alloc = allocator_type()) {
+    set result(alloc);
+    result.tree_.assign_sorted(first, last, threads);
+    return result;
+  }
+
+  allocator_type get_allocator() const {
+    return tree_.get_allocator();
+  }
+
   /*
       Iterators
   */
@@ -120,16 +160,42 @@ class set {
     return tree_.find(key);
   }
 
+  // first element not less than key
+  iterator lower_bound(const key_type& key) {
+    return tree_.lower_bound(key);
+  }
+
+  // first element greater than key
+  iterator upper_bound(const key_type& key) {
+    return tree_.upper_bound(key);
+  }
+
   /*
       Insert many
   */
 
   template <typename... Args>
-  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+  small_vector<std::pair<iterator, bool>, sizeof...(Args)> insert_many(Args&&... args) {
     return tree_.insert_many(args...);
   }
 
+  /*
+      Parallel traversal
+  */
+
+  // consecutive ranges covering the container, see rb_tree::split_ranges()
+  std::vector<std::pair<iterator, iterator>> split_ranges(size_type parts) const {
+    return tree_.split_ranges(parts);
+  }
+
  private:
   tree_type tree_;
 };
+
+namespace pmr {
+
+template <typename Key, typename Compare = std::less<Key>>
+using set = s21::set<Key, Compare, std::pmr::polymorphic_allocator<Key>>;
+
+}  // namespace pmr
 }  // namespace s21
\ No newline at end of file
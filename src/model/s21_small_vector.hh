@@ -0,0 +1,332 @@
+#pragma once
+
+#include <algorithm>  // std::move, std::rotate
+#include <cstddef>    // std::size_t
+#include <cstdint>    // PTRDIFF_MAX
+#include <initializer_list>
+#include <new>        // placement new
+#include <ratio>      // std::ratio
+#include <stdexcept>  // std::out_of_range, std::length_error
+#include <type_traits>
+#include <utility>  // std::forward, std::move
+
+#include "s21_relocation.hh"
+
+namespace s21 {
+
+/*
+  Vector that keeps up to N elements inside the object itself.
+
+  Only when the N+1-th element arrives are the elements moved to the
+  heap, which then grows by doubling as in s21::vector (and with the same
+  rules for relocating elements, see s21::relocation). Short
+  temporary lists, such as the results of insert_many(), therefore never
+  allocate. shrink_to_fit() moves the elements back inside once they fit
+  again.
+*/
+template <typename T, std::size_t N>
+class small_vector {
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = std::size_t;
+  using storage = relocation<value_type>;
+
+ public:
+  static constexpr size_type inline_capacity = N;
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  small_vector() : data_(inline_data()), size_(0), capacity_(N) {}
+
+  // parameterized ctor, count value-initialized elements
+  explicit small_vector(size_type count) : small_vector() { resize(count); }
+
+  // init-list ctor
+  small_vector(std::initializer_list<value_type> const &items) : small_vector() {
+    reserve(items.size());
+    for (const value_type &value : items) {
+      unchecked_push_back(value);
+    }
+  }
+
+  // copy ctor
+  small_vector(const small_vector &v) : small_vector() {
+    reserve(v.size_);
+    for (const value_type &value : v) {
+      unchecked_push_back(value);
+    }
+  }
+
+  // move ctor
+  small_vector(small_vector &&v) noexcept(std::is_nothrow_move_constructible<T>::value)
+      : small_vector() {
+    steal(v);
+  }
+
+  // destructor
+  ~small_vector() {
+    clear();
+    release();
+  }
+
+  // copy assigment
+  small_vector &operator=(const small_vector &other) {
+    if (this != &other) {
+      small_vector copy(other);
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  // move assigment
+  small_vector &operator=(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value) {
+    if (this != &other) {
+      clear();
+      release();
+      steal(other);
+    }
+    return *this;
+  }
+
+  /*
+      Element access
+  */
+
+  reference at(size_type pos) {
+    check_index(pos);
+    return data_[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    check_index(pos);
+    return data_[pos];
+  }
+
+  reference operator[](size_type pos) { return data_[pos]; }
+
+  const_reference operator[](size_type pos) const { return data_[pos]; }
+
+  reference front() { return data_[0]; }
+
+  const_reference front() const { return data_[0]; }
+
+  reference back() { return data_[size_ - 1]; }
+
+  const_reference back() const { return data_[size_ - 1]; }
+
+  T *data() { return data_; }
+
+  const T *data() const { return data_; }
+
+  /*
+      Iterators
+  */
+
+  iterator begin() { return data_; }
+
+  iterator end() { return data_ + size_; }
+
+  const_iterator begin() const { return data_; }
+
+  const_iterator end() const { return data_ + size_; }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    return static_cast<size_type>(PTRDIFF_MAX) / sizeof(value_type);
+  }
+
+  size_type capacity() const { return capacity_; }
+
+  // whether the elements are stored inside the object
+  bool is_inline() const { return data_ == inline_data(); }
+
+  // makes room for count elements without further allocation
+  void reserve(size_type count) {
+    if (count > capacity_) {
+      reallocate(count);
+    }
+  }
+
+  // releases the unused heap capacity, moving back inside if possible
+  void shrink_to_fit() {
+    if (!is_inline() && size_ < capacity_) {
+      reallocate(size_);
+    }
+  }
+
+  /*
+      Modifiers
+  */
+
+  void clear() {
+    if (!std::is_trivially_destructible<value_type>::value) {
+      for (size_type i = 0; i < size_; ++i) {
+        data_[i].~value_type();
+      }
+    }
+    size_ = 0;
+  }
+
+  // inserts value before pos, returns an iterator to it
+  iterator insert(iterator pos, const_reference value) {
+    size_type index = pos - data_;
+    emplace_back(value);
+    std::rotate(data_ + index, data_ + size_ - 1, data_ + size_);
+    return data_ + index;
+  }
+
+  // removes the element at pos
+  void erase(iterator pos) {
+    std::move(pos + 1, end(), pos);
+    pop_back();
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      // built first, args may refer into the vector
+      value_type value(std::forward<Args>(args)...);
+      reallocate(grown_capacity(size_ + 1));
+      new (data_ + size_) value_type(std::move(value));
+    } else {
+      new (data_ + size_) value_type(std::forward<Args>(args)...);
+    }
+    return data_[size_++];
+  }
+
+  // push_back() without the capacity check, the vector must not be full
+  void unchecked_push_back(const_reference value) {
+    new (data_ + size_) value_type(value);
+    ++size_;
+  }
+
+  void unchecked_push_back(value_type &&value) {
+    new (data_ + size_) value_type(std::move(value));
+    ++size_;
+  }
+
+  void pop_back() { data_[--size_].~value_type(); }
+
+  // count elements, the new ones value-initialized
+  void resize(size_type count) {
+    reserve(count);
+    while (size_ > count) {
+      pop_back();
+    }
+    for (; size_ < count; ++size_) {
+      new (data_ + size_) value_type();
+    }
+  }
+
+  void swap(small_vector &other) {
+    small_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  /*
+      Insert many
+  */
+
+  // inserts the arguments, in order, before pos, returns an iterator to
+  // the first of them
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    size_type index = pos - data_;
+    size_type old_size = size_;
+    (emplace_back(std::forward<Args>(args)), ...);
+    std::rotate(data_ + index, data_ + old_size, data_ + size_);
+    return data_ + index;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  T *inline_data() { return reinterpret_cast<T *>(inline_); }
+
+  const T *inline_data() const { return reinterpret_cast<const T *>(inline_); }
+
+  void check_index(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("No such element exists");
+    }
+  }
+
+  size_type grown_capacity(size_type count) const {
+    return storage::template grown_capacity<std::ratio<2>>(capacity_, count, 1, max_size());
+  }
+
+  // frees the heap block, if any, and points back at the inline storage
+  void release() {
+    if (!is_inline()) {
+      storage::deallocate(data_);
+      data_ = inline_data();
+      capacity_ = N;
+    }
+  }
+
+  // moves the elements to the heap with room for capacity elements, or
+  // back inside when capacity is at most N
+  void reallocate(size_type capacity) {
+    if (capacity > max_size()) {
+      throw std::length_error("small_vector: capacity exceeds max_size()");
+    }
+    if (capacity <= N) {
+      T *heap = data_;
+      storage::relocate(heap, size_, inline_data());
+      storage::deallocate(heap);
+      data_ = inline_data();
+      capacity_ = N;
+      return;
+    }
+    if (is_inline()) {
+      data_ = storage::relocate_to_new(data_, size_, capacity);
+    } else {
+      data_ = storage::reallocate(data_, size_, capacity);
+    }
+    capacity_ = capacity;
+  }
+
+  // takes the elements of other, this being empty and inline
+  void steal(small_vector &other) {
+    if (other.is_inline()) {
+      storage::relocate(other.data_, other.size_, inline_data());
+      size_ = other.size_;
+    } else {
+      data_ = other.data_;
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      other.data_ = other.inline_data();
+      other.capacity_ = N;
+    }
+    other.size_ = 0;
+  }
+
+  T *data_;
+  size_type size_;
+  size_type capacity_;
+  alignas(T) unsigned char inline_[(N ? N : 1) * sizeof(T)];
+};
+
+}  // namespace s21
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>  // std::size_t
+#include <new>      // placement new
+#include <utility>  // std::forward, std::move
+
+#include "s21_ring_buffer.hh"
+
+namespace s21 {
+
+/*
+  Bounded lock-free queue for exactly one producer thread and one
+  consumer thread.
+
+  The producer owns tail_ and the consumer owns head_, both free-running
+  positions in a ring_buffer of Capacity slots. Each side publishes its
+  index with a release store and reads the other side's with acquire, so
+  an element is fully constructed before the consumer can see it and
+  fully destroyed before the producer can reuse its slot.
+
+  The two indices live on separate cache lines, and each side keeps a
+  private copy of the other's index that it refreshes only when the ring
+  looks full (or empty), so in steady state neither side reads a line
+  the other one writes. The batch calls move many elements per index
+  update.
+*/
+template <typename T, std::size_t Capacity>
+class alignas(64) spsc_queue {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "spsc_queue capacity must be a power of two");
+
+  using value_type = T;
+  using size_type = std::size_t;
+
+ public:
+  /*
+      Member functions
+  */
+
+  // default ctor
+  spsc_queue() : ring_(Capacity) {}
+
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+
+  // destructor, no producer or consumer may be running
+  ~spsc_queue() {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+      ring_.slot(i)->~value_type();
+    }
+  }
+
+  /*
+      Capacity
+  */
+
+  static constexpr size_type capacity() { return Capacity; }
+
+  // exact when called by the producer or the consumer while the other
+  // side is idle, a recent value otherwise
+  size_type size() const {
+    return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+  }
+
+  bool empty() const { return size() == 0; }
+
+  /*
+      Producer
+  */
+
+  // @return false if the queue is full
+  bool try_push(const value_type &value) { return try_emplace(value); }
+
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_cache_ == Capacity) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      if (tail - head_cache_ == Capacity) {
+        return false;
+      }
+    }
+    new (ring_.slot(tail)) value_type(std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*
+  @brief Copies as many elements of [first, last) as fit, publishing
+  them with a single index update.
+  @return the iterator past the last element pushed.
+  */
+  template <typename InputIt>
+  InputIt push_batch(InputIt first, InputIt last) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    head_cache_ = head_.load(std::memory_order_acquire);
+    size_type end = head_cache_ + Capacity;
+    size_type position = tail;
+    for (; first != last && position != end; ++first, ++position) {
+      new (ring_.slot(position)) value_type(*first);
+    }
+    tail_.store(position, std::memory_order_release);
+    return first;
+  }
+
+  /*
+      Consumer
+  */
+
+  // @return false if the queue is empty
+  bool try_pop(value_type &value) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (head == tail_cache_) {
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+      if (head == tail_cache_) {
+        return false;
+      }
+    }
+    value_type *slot = ring_.slot(head);
+    value = std::move(*slot);
+    slot->~value_type();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*
+  @brief Moves up to max_count elements to out, freeing their slots with
+  a single index update.
+  @return the number of elements popped.
+  */
+  template <typename OutputIt>
+  size_type pop_batch(OutputIt out, size_type max_count) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    tail_cache_ = tail_.load(std::memory_order_acquire);
+    size_type count = tail_cache_ - head;
+    if (count > max_count) {
+      count = max_count;
+    }
+    for (size_type i = 0; i < count; ++i, ++out) {
+      value_type *slot = ring_.slot(head + i);
+      *out = std::move(*slot);
+      slot->~value_type();
+    }
+    head_.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+ private:
+  ring_buffer<value_type> ring_;
+
+  // consumer's line: its index and its view of the producer's
+  alignas(64) std::atomic<size_type> head_{0};
+  size_type tail_cache_ = 0;
+
+  // producer's line: its index and its view of the consumer's
+  alignas(64) std::atomic<size_type> tail_{0};
+  size_type head_cache_ = 0;
+};
+
+}  // namespace s21
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <initializer_list>
+#include <stdexcept>    // std::out_of_range
+#include <type_traits>  // std::void_t, std::true_type, std::false_type
+#include <utility>      // std::declval, std::forward, std::move
+
+#include "s21_chunked_storage.hh"
+#include "s21_deque.hh"
+
+namespace s21 {
+
+/*
+  LIFO adaptor over a Container with back(), push_back(), emplace_back(),
+  pop_back(), size() and empty(), such as deque (the default),
+  chunked_storage, s21::vector or s21::list.
+
+  With deque or chunked_storage a push never moves the elements already
+  on the stack, so there are no reallocate-and-copy spikes however deep
+  the stack gets, and references to elements stay valid until they are
+  popped. deque allocates page-sized blocks of the same size throughout;
+  chunked_storage doubles its chunks, for fewer allocations on very deep
+  stacks. reserve() is forwarded to containers that have one.
+*/
+template <typename T, typename Container = deque<T>>
+class stack {
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  template <typename C, typename = void>
+  struct has_reserve : std::false_type {};
+
+  template <typename C>
+  struct has_reserve<C, std::void_t<decltype(std::declval<C &>().reserve(size_type()))>>
+      : std::true_type {};
+
+ public:
+  using container_type = Container;
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  stack() = default;
+
+  // init-list ctor, the last item on top
+  stack(std::initializer_list<value_type> const &items) {
+    reserve(items.size());
+    for (const value_type &value : items) {
+      c_.push_back(value);
+    }
+  }
+
+  // copy ctor
+  stack(const stack &s) : c_(s.c_) {}
+
+  // move ctor
+  stack(stack &&s) : c_(std::move(s.c_)) {}
+
+  // destructor
+  ~stack() = default;
+
+  // copy assigment
+  stack &operator=(const stack &other) {
+    c_ = other.c_;
+    return *this;
+  }
+
+  // move assigment
+  stack &operator=(stack &&other) {
+    c_ = std::move(other.c_);
+    return *this;
+  }
+
+  /*
+      Element access
+  */
+
+  reference top() {
+    check_not_empty();
+    return c_.back();
+  }
+
+  const_reference top() const {
+    check_not_empty();
+    return c_.back();
+  }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return c_.empty(); }
+
+  size_type size() const { return c_.size(); }
+
+  // makes room for count elements, if the container can
+  void reserve(size_type count) {
+    if constexpr (has_reserve<container_type>::value) {
+      c_.reserve(count);
+    }
+  }
+
+  /*
+      Modifiers
+  */
+
+  void push(const_reference value) { c_.push_back(value); }
+
+  void push(value_type &&value) { c_.push_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    return c_.emplace_back(std::forward<Args>(args)...);
+  }
+
+  void pop() {
+    check_not_empty();
+    c_.pop_back();
+  }
+
+  void swap(stack &other) { c_.swap(other.c_); }
+
+  /*
+      Insert many
+  */
+
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    (c_.push_back(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  void check_not_empty() const {
+    if (c_.empty()) {
+      throw std::out_of_range("Stack is empty");
+    }
+  }
+
+  container_type c_;
+};
+
+}  // namespace s21
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <exception>   // std::exception_ptr
+#include <functional>  // std::function
+#include <memory>      // std::unique_ptr
+#include <mutex>
+#include <thread>
+#include <utility>  // std::forward
+#include <vector>
+
+#include "s21_mpmc_queue.hh"
+#include "s21_ws_deque.hh"
+
+namespace s21 {
+
+/*
+  Fixed-size work-stealing thread pool with fork/join.
+
+  Every worker owns a ws_deque of task pointers: it pushes and pops its
+  own work at the bottom (most recent first, still warm in cache) and,
+  when that is empty, steals from the top of another worker's deque (the
+  oldest and usually largest pieces of work). Threads outside the pool
+  cannot push to a deque, so their tasks go through a shared mpmc_queue
+  that workers poll before stealing.
+
+  fork_join() and run() block until their tasks have finished, and the
+  waiting thread executes queued tasks meanwhile instead of sleeping, so
+  tasks may fork and join recursively without exhausting the pool.
+  Tasks are not allocated: the pool only ever holds pointers to task
+  objects that live in the frame of the waiting call.
+*/
+class thread_pool {
+ public:
+  using size_type = std::size_t;
+  using task_type = std::function<void()>;
+
+  static constexpr size_type kInjectCapacity = 1 << 12;
+
+  /*
+      Member functions
+  */
+
+  // starts threads workers, at least one
+  explicit thread_pool(unsigned threads = std::thread::hardware_concurrency())
+      : inject_(kInjectCapacity) {
+    size_type count = threads ? threads : 1;
+    for (size_type i = 0; i < count; ++i) {
+      deques_.emplace_back(new ws_deque<task_type *>);
+    }
+    for (size_type i = 0; i < count; ++i) {
+      workers_.emplace_back([this, i] { work(i); });
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  // destructor, waits for the workers to exit
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    wakeup_.notify_all();
+    for (std::thread &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  /*
+      Capacity
+  */
+
+  // number of worker threads
+  size_type size() const { return workers_.size(); }
+
+  /*
+      Scheduling
+  */
+
+  /*
+  @brief Runs first() on the calling thread while second() may be stolen
+  by another worker, and returns once both have finished. If either
+  throws, the exception is rethrown here after both have finished (the
+  one of first() if both threw).
+  */
+  template <typename First, typename Second>
+  void fork_join(First &&first, Second &&second) {
+    std::atomic<bool> done(false);
+    std::exception_ptr error;
+    task_type forked([&second, &done, &error] {
+      try {
+        second();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      done.store(true, std::memory_order_release);
+    });
+    push(&forked);
+    try {
+      first();
+    } catch (...) {
+      help_until(done);
+      throw;
+    }
+    help_until(done);
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  /*
+  @brief Runs every task of tasks on the pool and returns once all of
+  them have finished. If tasks throw, the first exception is rethrown
+  here after the rest of the batch has completed.
+  */
+  void run(std::vector<task_type> &tasks) {
+    std::atomic<size_type> remaining(tasks.size());
+    std::atomic<bool> done(tasks.empty());
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    std::vector<task_type> wrappers;
+    wrappers.reserve(tasks.size());
+    for (size_type i = 0; i < tasks.size(); ++i) {
+      wrappers.emplace_back([&tasks, &remaining, &done, &error, &error_mutex, i] {
+        try {
+          tasks[i]();
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(error_mutex);
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          done.store(true, std::memory_order_release);
+        }
+      });
+    }
+    for (task_type &wrapper : wrappers) {
+      push(&wrapper);
+    }
+    help_until(done);
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+ private:
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  // index of the calling worker of this pool, npos for other threads
+  size_type current_index() const {
+    return current_pool() == this ? current_worker() : npos;
+  }
+
+  static const thread_pool *&current_pool() {
+    static thread_local const thread_pool *pool = nullptr;
+    return pool;
+  }
+
+  static size_type &current_worker() {
+    static thread_local size_type index = npos;
+    return index;
+  }
+
+  void push(task_type *task) {
+    size_type self = current_index();
+    if (self != npos) {
+      deques_[self]->push(task);
+    } else if (!inject_.try_push(task)) {
+      (*task)();  // the shared queue is full, so run it right here
+      return;
+    }
+    pending_.fetch_add(1, std::memory_order_seq_cst);
+    if (sleepers_.load(std::memory_order_seq_cst) != 0) {
+      {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+      }
+      wakeup_.notify_one();
+    }
+  }
+
+  // own deque first, then the shared queue, then the other deques
+  bool take(size_type self, task_type *&task) {
+    if (self != npos && deques_[self]->pop(task)) {
+      return taken();
+    }
+    if (inject_.try_pop(task)) {
+      return taken();
+    }
+    size_type start = self == npos ? 0 : self + 1;
+    for (size_type i = 0; i < deques_.size(); ++i) {
+      if (deques_[(start + i) % deques_.size()]->steal(task)) {
+        return taken();
+      }
+    }
+    return false;
+  }
+
+  bool taken() {
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // executes queued tasks until done is set
+  void help_until(const std::atomic<bool> &done) {
+    size_type self = current_index();
+    while (!done.load(std::memory_order_acquire)) {
+      task_type *task;
+      if (take(self, task)) {
+        (*task)();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void work(size_type index) {
+    current_pool() = this;
+    current_worker() = index;
+    for (;;) {
+      task_type *task;
+      if (take(index, task)) {
+        (*task)();
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      sleepers_.fetch_add(1, std::memory_order_seq_cst);
+      wakeup_.wait(lock, [this] {
+        return stop_ || pending_.load(std::memory_order_seq_cst) > 0;
+      });
+      sleepers_.fetch_sub(1, std::memory_order_relaxed);
+      if (stop_) {
+        return;
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<ws_deque<task_type *>>> deques_;
+  mpmc_queue<task_type *> inject_;
+  std::vector<std::thread> workers_;
+  // tasks pushed but not yet taken, may dip below zero for a moment
+  std::atomic<std::ptrdiff_t> pending_{0};
+  std::atomic<size_type> sleepers_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wakeup_;
+  bool stop_ = false;
+};
+
+}  // namespace s21
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <utility>  // std::move, std::pair, std::swap
+#include <vector>
+
+namespace s21 {
+
+/*
+  Tournament (loser) tree over k sorted sequences.
+
+  The leaves are the heads of the sequences and every inner node keeps
+  the loser of the match played there, so after the winner is consumed
+  only the matches on its own leaf-to-root path are replayed: producing
+  each element costs log2(k) comparisons instead of the k of a linear
+  scan. An exhausted sequence loses every match.
+*/
+template <typename It, typename Less>
+class tournament_tree {
+  using size_type = std::size_t;
+
+ public:
+  // sources are pairs of [current, end) iterators
+  tournament_tree(std::vector<std::pair<It, It>> sources, Less less)
+      : sources_(std::move(sources)), less_(less) {
+    leaves_ = 1;
+    while (leaves_ < sources_.size()) {
+      leaves_ *= 2;
+    }
+    losers_.assign(leaves_, 0);
+    winner_ = leaves_ == 1 ? 0 : play(1);
+  }
+
+  bool empty() const { return exhausted(winner_); }
+
+  // the smallest head, ties go to the earlier sequence
+  It top() const { return sources_[winner_].first; }
+
+  void pop() {
+    ++sources_[winner_].first;
+    for (size_type node = (winner_ + leaves_) / 2; node > 0; node /= 2) {
+      if (beats(losers_[node], winner_)) {
+        std::swap(losers_[node], winner_);
+      }
+    }
+  }
+
+ private:
+  bool exhausted(size_type source) const {
+    return source >= sources_.size() || sources_[source].first == sources_[source].second;
+  }
+
+  bool beats(size_type lhs, size_type rhs) const {
+    if (exhausted(lhs)) {
+      return false;
+    }
+    if (exhausted(rhs)) {
+      return true;
+    }
+    It a = sources_[lhs].first;
+    It b = sources_[rhs].first;
+    return less_(*a, *b) || (!less_(*b, *a) && lhs < rhs);
+  }
+
+  // winner of the subtree at node, filling in the losers below it
+  size_type play(size_type node) {
+    if (node >= leaves_) {
+      return node - leaves_;
+    }
+    size_type left = play(2 * node);
+    size_type right = play(2 * node + 1);
+    if (beats(right, left)) {
+      losers_[node] = left;
+      return right;
+    }
+    losers_[node] = right;
+    return left;
+  }
+
+  std::vector<std::pair<It, It>> sources_;
+  Less less_;
+  size_type leaves_;
+  std::vector<size_type> losers_;  // losers_[0] is unused
+  size_type winner_;
+};
+
+}  // namespace s21
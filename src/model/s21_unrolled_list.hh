@@ -0,0 +1,491 @@
+#pragma once
+
+#include <cstddef>           // std::size_t, std::ptrdiff_t
+#include <cstring>           // std::memmove
+#include <initializer_list>  // std::initializer_list
+#include <iterator>          // std::bidirectional_iterator_tag
+#include <limits>            // std::numeric_limits
+#include <new>               // placement new
+#include <stdexcept>         // std::out_of_range
+#include <type_traits>       // std::is_trivially_copyable
+#include <utility>           // std::forward, std::move
+
+namespace s21 {
+
+/*
+  Doubly linked list of blocks, each an array of up to K elements, around
+  a sentinel block.
+
+  A scan walks K contiguous elements per pointer hop, so it runs close to
+  array speed, while an insert or erase only shifts the elements of its
+  own block: O(K), independent of size(). A full block is split in half
+  to make room, unless the element goes to its front and the previous
+  block has room, or goes to an end of the list, where a new block is
+  started instead so that push_back() and push_front() fill every block.
+  Erasing keeps every block but the last at least K / 2 full: a block
+  that drops below that absorbs its successor when the two fit in one
+  block and otherwise takes elements from its front, and a last block
+  that fits into its predecessor is folded into it. So even after mass
+  erasure a scan still gets K / 2 elements or more per hop. (push_front()
+  on a full first block opens a new one, which stays short until more
+  pushes at the front fill it.)
+
+  Inserting or erasing invalidates the iterators and references into the
+  blocks it touches only.
+*/
+template <typename T, std::size_t K = (sizeof(T) <= 32 ? 512 / sizeof(T) : 16)>
+class unrolled_list {
+  static_assert(K >= 2, "an unrolled_list block needs room for two elements");
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  struct block_base {
+    block_base *prev_;
+    block_base *next_;
+    size_type count_;
+  };
+
+  struct block : block_base {
+    alignas(T) unsigned char storage_[K * sizeof(T)];
+  };
+
+  template <typename Value>
+  class unrolled_list_iterator {
+    friend class unrolled_list;
+
+   public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = Value &;
+    using pointer = Value *;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    unrolled_list_iterator() : block_(nullptr), index_(0) {}
+
+    unrolled_list_iterator(block_base *b, size_type index) : block_(b), index_(index) {}
+
+    // iterator to const_iterator
+    template <typename Other>
+    unrolled_list_iterator(const unrolled_list_iterator<Other> &other)
+        : block_(other.block_), index_(other.index_) {}
+
+    reference operator*() const { return data(block_)[index_]; }
+
+    pointer operator->() const { return data(block_) + index_; }
+
+    unrolled_list_iterator &operator++() {
+      if (++index_ == block_->count_) {
+        block_ = block_->next_;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    unrolled_list_iterator operator++(int) {
+      unrolled_list_iterator old(*this);
+      ++*this;
+      return old;
+    }
+
+    unrolled_list_iterator &operator--() {
+      if (index_ == 0) {
+        block_ = block_->prev_;
+        index_ = block_->count_;
+      }
+      --index_;
+      return *this;
+    }
+
+    unrolled_list_iterator operator--(int) {
+      unrolled_list_iterator old(*this);
+      --*this;
+      return old;
+    }
+
+    template <typename Other>
+    bool operator==(const unrolled_list_iterator<Other> &other) const {
+      return block_ == other.block_ && index_ == other.index_;
+    }
+
+    template <typename Other>
+    bool operator!=(const unrolled_list_iterator<Other> &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    template <typename>
+    friend class unrolled_list_iterator;
+
+    block_base *block_;
+    size_type index_;  // 0 at end(), below block_->count_ elsewhere
+  };
+
+ public:
+  using iterator = unrolled_list_iterator<T>;
+  using const_iterator = unrolled_list_iterator<const T>;
+
+  static constexpr size_type kBlockSize = K;
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  unrolled_list() : size_(0), blocks_(0) {
+    head_.prev_ = head_.next_ = &head_;
+    head_.count_ = 0;
+  }
+
+  // parameterized ctor, n value-initialized elements
+  explicit unrolled_list(size_type n) : unrolled_list() {
+    for (size_type i = 0; i < n; ++i) {
+      emplace_back();
+    }
+  }
+
+  // init-list ctor
+  unrolled_list(std::initializer_list<value_type> const &items) : unrolled_list() {
+    for (const value_type &value : items) {
+      push_back(value);
+    }
+  }
+
+  // copy ctor, packs the elements into full blocks
+  unrolled_list(const unrolled_list &l) : unrolled_list() {
+    for (const value_type &value : l) {
+      push_back(value);
+    }
+  }
+
+  // move ctor
+  unrolled_list(unrolled_list &&l) : unrolled_list() { take_blocks(l); }
+
+  // destructor
+  ~unrolled_list() { clear(); }
+
+  // copy assigment
+  unrolled_list &operator=(const unrolled_list &other) {
+    if (this != &other) {
+      unrolled_list copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  // move assigment
+  unrolled_list &operator=(unrolled_list &&other) {
+    swap(other);
+    return *this;
+  }
+
+  /*
+      Element access
+  */
+
+  reference front() {
+    check_not_empty();
+    return data(head_.next_)[0];
+  }
+
+  reference back() {
+    check_not_empty();
+    return data(head_.prev_)[head_.prev_->count_ - 1];
+  }
+
+  const_reference front() const {
+    check_not_empty();
+    return data(head_.next_)[0];
+  }
+
+  const_reference back() const {
+    check_not_empty();
+    return data(head_.prev_)[head_.prev_->count_ - 1];
+  }
+
+  /*
+      Iterators
+  */
+
+  iterator begin() { return iterator(head_.next_, 0); }
+
+  iterator end() { return iterator(&head_, 0); }
+
+  const_iterator begin() const { return const_iterator(head_.next_, 0); }
+
+  const_iterator end() const { return const_iterator(const_cast<block_base *>(&head_), 0); }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(block) * K;
+  }
+
+  // the elements the allocated blocks can hold
+  size_type capacity() const { return blocks_ * K; }
+
+  /*
+      Modifiers
+  */
+
+  void clear() {
+    block_base *current = head_.next_;
+    while (current != &head_) {
+      block_base *next = current->next_;
+      destroy(data(current), current->count_);
+      delete static_cast<block *>(current);
+      current = next;
+    }
+    head_.prev_ = head_.next_ = &head_;
+    size_ = 0;
+    blocks_ = 0;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) { return emplace(pos, value); }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    // built aside first: args may refer to an element about to move
+    value_type value(std::forward<Args>(args)...);
+    iterator at = make_room(pos.block_, pos.index_);
+    new (data(at.block_) + at.index_) value_type(std::move(value));
+    ++at.block_->count_;
+    ++size_;
+    return at;
+  }
+
+  // @return an iterator to the element after the erased one
+  iterator erase(const_iterator pos) {
+    block_base *b = pos.block_;
+    size_type index = pos.index_;
+    T *elements = data(b);
+    elements[index].~value_type();
+    relocate(elements + index, elements + index + 1, b->count_ - index - 1);
+    --b->count_;
+    --size_;
+    if (b->count_ == 0) {
+      block_base *next = b->next_;
+      free_block(b);
+      return iterator(next, 0);
+    }
+    if (b->count_ < K / 2) {
+      if (b->next_ != &head_) {
+        refill(b);
+      } else if (b->prev_ != &head_ && b->prev_->count_ + b->count_ <= K) {
+        index += b->prev_->count_;
+        b = b->prev_;
+        absorb_next(b);
+      }
+    }
+    return index < b->count_ ? iterator(b, index) : iterator(b->next_, 0);
+  }
+
+  void push_back(const_reference value) { emplace(end(), value); }
+
+  void push_back(value_type &&value) { emplace(end(), std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  void pop_back() {
+    check_not_empty();
+    erase(const_iterator(head_.prev_, head_.prev_->count_ - 1));
+  }
+
+  void push_front(const_reference value) { emplace(begin(), value); }
+
+  void push_front(value_type &&value) { emplace(begin(), std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+  }
+
+  void pop_front() {
+    check_not_empty();
+    erase(begin());
+  }
+
+  void swap(unrolled_list &other) {
+    unrolled_list tmp;
+    tmp.take_blocks(other);
+    other.take_blocks(*this);
+    take_blocks(tmp);
+  }
+
+  /*
+      Insert many
+  */
+
+  // inserts the arguments, in order, before pos, returns an iterator to
+  // the last of them (pos if there are none)
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    iterator last(pos.block_, pos.index_);
+    ((last = emplace(pos, std::forward<Args>(args)), pos = std::next(last)), ...);
+    return last;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace(end(), std::forward<Args>(args)), ...);
+  }
+
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    insert_many(begin(), std::forward<Args>(args)...);
+  }
+
+ private:
+  static T *data(block_base *b) {
+    return reinterpret_cast<T *>(static_cast<block *>(b)->storage_);
+  }
+
+  void check_not_empty() const {
+    if (size_ == 0) {
+      throw std::out_of_range("List is empty");
+    }
+  }
+
+  static void destroy(T *first, size_type count) {
+    for (size_type i = 0; i < count; ++i) {
+      first[i].~value_type();
+    }
+  }
+
+  // moves count elements from src to the uninitialized dst, the ranges
+  // may overlap
+  static void relocate(T *dst, T *src, size_type count) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+      if (count) {
+        std::memmove(static_cast<void *>(dst), static_cast<void *>(src), count * sizeof(T));
+      }
+    } else if (dst < src) {
+      for (size_type i = 0; i < count; ++i) {
+        new (dst + i) value_type(std::move(src[i]));
+        src[i].~value_type();
+      }
+    } else {
+      for (size_type i = count; i > 0; --i) {
+        new (dst + i - 1) value_type(std::move(src[i - 1]));
+        src[i - 1].~value_type();
+      }
+    }
+  }
+
+  // a new empty block linked in before pos
+  block_base *new_block_before(block_base *pos) {
+    block_base *b = new block;
+    b->count_ = 0;
+    b->prev_ = pos->prev_;
+    b->next_ = pos;
+    pos->prev_->next_ = b;
+    pos->prev_ = b;
+    ++blocks_;
+    return b;
+  }
+
+  void free_block(block_base *b) {
+    b->prev_->next_ = b->next_;
+    b->next_->prev_ = b->prev_;
+    delete static_cast<block *>(b);
+    --blocks_;
+  }
+
+  /*
+  @brief Opens an uninitialized slot for a new element at index of
+  block b, or at the end of the list when b is the sentinel, and returns
+  its position. The caller constructs the element and counts it.
+  */
+  iterator make_room(block_base *b, size_type index) {
+    if (b == &head_) {
+      b = head_.prev_;
+      index = b->count_;
+      if (b == &head_ || b->count_ == K) {
+        return iterator(new_block_before(&head_), 0);
+      }
+    }
+    if (b->count_ == K) {
+      if (index == 0 && b->prev_ == &head_) {
+        return iterator(new_block_before(b), 0);
+      }
+      if (index == 0 && b->prev_->count_ < K) {
+        return iterator(b->prev_, b->prev_->count_);
+      }
+      // split, the upper half moves to a new block after b
+      block_base *upper = new_block_before(b->next_);
+      size_type keep = (K + 1) / 2;
+      relocate(data(upper), data(b) + keep, K - keep);
+      upper->count_ = K - keep;
+      b->count_ = keep;
+      if (index > keep) {
+        b = upper;
+        index -= keep;
+      }
+    }
+    T *elements = data(b);
+    relocate(elements + index + 1, elements + index, b->count_ - index);
+    return iterator(b, index);
+  }
+
+  // moves the elements of the block after b to the end of b and frees it
+  void absorb_next(block_base *b) {
+    block_base *next = b->next_;
+    relocate(data(b) + b->count_, data(next), next->count_);
+    b->count_ += next->count_;
+    free_block(next);
+  }
+
+  // brings b, which is below K / 2 and not the last block, back to at
+  // least K / 2: absorbs the next block if both fit in one, otherwise
+  // moves elements from its front until the two are balanced
+  void refill(block_base *b) {
+    block_base *next = b->next_;
+    if (b->count_ + next->count_ <= K) {
+      absorb_next(b);
+      return;
+    }
+    size_type moved = (next->count_ - b->count_) / 2;
+    T *front = data(next);
+    relocate(data(b) + b->count_, front, moved);
+    relocate(front, front + moved, next->count_ - moved);
+    b->count_ += moved;
+    next->count_ -= moved;
+  }
+
+  // adopts the blocks of other, this being empty
+  void take_blocks(unrolled_list &other) {
+    if (other.empty()) {
+      return;
+    }
+    head_.next_ = other.head_.next_;
+    head_.prev_ = other.head_.prev_;
+    head_.next_->prev_ = &head_;
+    head_.prev_->next_ = &head_;
+    size_ = other.size_;
+    blocks_ = other.blocks_;
+    other.head_.prev_ = other.head_.next_ = &other.head_;
+    other.size_ = 0;
+    other.blocks_ = 0;
+  }
+
+  block_base head_;  // sentinel, count_ stays 0
+  size_type size_;
+  size_type blocks_;
+};
+
+}  // namespace s21
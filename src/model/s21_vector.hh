@@ -0,0 +1,305 @@
+#pragma once
+
+#include <algorithm>  // std::move, std::rotate
+#include <cstddef>    // std::size_t
+#include <cstdint>    // PTRDIFF_MAX
+#include <initializer_list>
+#include <new>        // placement new
+#include <ratio>      // std::ratio, std::ratio_equal
+#include <stdexcept>  // std::out_of_range, std::length_error
+#include <type_traits>
+#include <utility>  // std::exchange, std::forward, std::move, std::swap
+
+#include "s21_relocation.hh"
+
+namespace s21 {
+
+/*
+  Dynamic array.
+
+  Growth multiplies the capacity by Growth, which must be std::ratio<2>
+  (fewer reallocations) or std::ratio<3, 2> (less unused memory, and
+  freed blocks can eventually be reused by the vector itself). Elements
+  are moved by the rules of s21::relocation: trivially relocatable
+  types by std::realloc, which can often extend the block in place,
+  other types one by one.
+*/
+template <typename T, typename Growth = std::ratio<2>>
+class vector {
+  static_assert(std::ratio_equal<Growth, std::ratio<2>>::value ||
+                    std::ratio_equal<Growth, std::ratio<3, 2>>::value,
+                "vector growth factor must be 2 or 3/2");
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = std::size_t;
+  using storage = relocation<value_type>;
+
+ public:
+  using growth_factor = Growth;
+
+  static constexpr size_type kMinCapacity = 4;
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  vector() : data_(nullptr), size_(0), capacity_(0) {}
+
+  // parameterized ctor, count value-initialized elements
+  explicit vector(size_type count) : vector() {
+    reserve(count);
+    for (; size_ < count; ++size_) {
+      new (data_ + size_) value_type();
+    }
+  }
+
+  // init-list ctor
+  vector(std::initializer_list<value_type> const &items) : vector() {
+    reserve(items.size());
+    for (const value_type &value : items) {
+      unchecked_push_back(value);
+    }
+  }
+
+  // copy ctor
+  vector(const vector &v) : vector() {
+    reserve(v.size_);
+    for (const value_type &value : v) {
+      unchecked_push_back(value);
+    }
+  }
+
+  // move ctor
+  vector(vector &&v) noexcept
+      : data_(std::exchange(v.data_, nullptr)),
+        size_(std::exchange(v.size_, 0)),
+        capacity_(std::exchange(v.capacity_, 0)) {}
+
+  // destructor
+  ~vector() {
+    clear();
+    storage::deallocate(data_);
+  }
+
+  // copy assigment
+  vector &operator=(const vector &other) {
+    if (this != &other) {
+      vector copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  // move assigment
+  vector &operator=(vector &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  /*
+      Element access
+  */
+
+  reference at(size_type pos) {
+    check_index(pos);
+    return data_[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    check_index(pos);
+    return data_[pos];
+  }
+
+  reference operator[](size_type pos) { return data_[pos]; }
+
+  const_reference operator[](size_type pos) const { return data_[pos]; }
+
+  reference front() { return data_[0]; }
+
+  const_reference front() const { return data_[0]; }
+
+  reference back() { return data_[size_ - 1]; }
+
+  const_reference back() const { return data_[size_ - 1]; }
+
+  T *data() { return data_; }
+
+  const T *data() const { return data_; }
+
+  /*
+      Iterators
+  */
+
+  iterator begin() { return data_; }
+
+  iterator end() { return data_ + size_; }
+
+  const_iterator begin() const { return data_; }
+
+  const_iterator end() const { return data_ + size_; }
+
+  /*
+      Capacity
+  */
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    return static_cast<size_type>(PTRDIFF_MAX) / sizeof(value_type);
+  }
+
+  size_type capacity() const { return capacity_; }
+
+  // makes room for count elements without further allocation
+  void reserve(size_type count) {
+    if (count > capacity_) {
+      reallocate(count);
+    }
+  }
+
+  // releases the unused capacity
+  void shrink_to_fit() {
+    if (size_ == 0) {
+      storage::deallocate(std::exchange(data_, nullptr));
+      capacity_ = 0;
+    } else if (size_ < capacity_) {
+      reallocate(size_);
+    }
+  }
+
+  /*
+      Modifiers
+  */
+
+  void clear() {
+    if (!std::is_trivially_destructible<value_type>::value) {
+      for (size_type i = 0; i < size_; ++i) {
+        data_[i].~value_type();
+      }
+    }
+    size_ = 0;
+  }
+
+  // inserts value before pos, returns an iterator to it
+  iterator insert(iterator pos, const_reference value) {
+    size_type index = pos - data_;
+    emplace_back(value);
+    std::rotate(data_ + index, data_ + size_ - 1, data_ + size_);
+    return data_ + index;
+  }
+
+  // removes the element at pos
+  void erase(iterator pos) {
+    std::move(pos + 1, end(), pos);
+    pop_back();
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      return emplace_back_grow(std::forward<Args>(args)...);
+    }
+    new (data_ + size_) value_type(std::forward<Args>(args)...);
+    return data_[size_++];
+  }
+
+  /*
+  @brief push_back() without the capacity check, for loops that reserve()
+  their final size up front. The vector must not be full.
+  */
+  void unchecked_push_back(const_reference value) {
+    new (data_ + size_) value_type(value);
+    ++size_;
+  }
+
+  void unchecked_push_back(value_type &&value) {
+    new (data_ + size_) value_type(std::move(value));
+    ++size_;
+  }
+
+  void pop_back() { data_[--size_].~value_type(); }
+
+  // count elements, the new ones value-initialized
+  void resize(size_type count) {
+    reserve(count);
+    while (size_ > count) {
+      pop_back();
+    }
+    for (; size_ < count; ++size_) {
+      new (data_ + size_) value_type();
+    }
+  }
+
+  void swap(vector &other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+  /*
+      Insert many
+  */
+
+  // inserts the arguments, in order, before pos, returns an iterator to
+  // the first of them
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    size_type index = pos - data_;
+    size_type old_size = size_;
+    (emplace_back(std::forward<Args>(args)), ...);
+    std::rotate(data_ + index, data_ + old_size, data_ + size_);
+    return data_ + index;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  void check_index(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("No such element exists");
+    }
+  }
+
+  // at least count, otherwise capacity() times the growth factor
+  size_type grown_capacity(size_type count) const {
+    return storage::template grown_capacity<Growth>(capacity_, count, kMinCapacity, max_size());
+  }
+
+  // the value is built before growing, args may refer into the vector
+  template <typename... Args>
+  reference emplace_back_grow(Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    reallocate(grown_capacity(size_ + 1));
+    new (data_ + size_) value_type(std::move(value));
+    return data_[size_++];
+  }
+
+  // moves the elements to storage for exactly capacity elements
+  void reallocate(size_type capacity) {
+    if (capacity > max_size()) {
+      throw std::length_error("vector: capacity exceeds max_size()");
+    }
+    data_ = storage::reallocate(data_, size_, capacity);
+    capacity_ = capacity;
+  }
+
+  T *data_;
+  size_type size_;
+  size_type capacity_;
+};
+
+}  // namespace s21
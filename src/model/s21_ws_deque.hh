@@ -0,0 +1,162 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::int64_t
+#include <memory>       // std::unique_ptr
+#include <type_traits>  // std::is_trivially_copyable
+#include <vector>
+
+namespace s21 {
+
+/*
+  Lock-free work-stealing deque (Chase and Lev, with the C11 memory
+  orders of Le, Pop, Cohen and Zappa Nardelli).
+
+  One owner thread pushes and pops at the bottom, like a stack, which
+  costs no atomic read-modify-write unless the deque is down to its last
+  element. Any number of thieves steal from the top with one CAS each, so
+  they take the oldest elements and rarely meet the owner.
+
+  The circular array grows when full. Thieves may still read a replaced
+  array, so replaced arrays are kept until the deque is destroyed (each
+  is half the size of the next, so this at most doubles the memory).
+  Elements are copied by racing readers and must be trivially copyable,
+  typically pointers to tasks.
+*/
+template <typename T>
+class alignas(64) ws_deque {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "ws_deque elements are read by racing thieves, so they must "
+                "be trivially copyable");
+
+  using value_type = T;
+  using size_type = std::size_t;
+  using index_type = std::int64_t;
+
+  struct array {
+    explicit array(index_type capacity)
+        : capacity_(capacity), slots_(new std::atomic<T>[capacity]) {}
+
+    T get(index_type index) const {
+      return slots_[index & (capacity_ - 1)].load(std::memory_order_relaxed);
+    }
+
+    void put(index_type index, T value) {
+      slots_[index & (capacity_ - 1)].store(value, std::memory_order_relaxed);
+    }
+
+    index_type capacity_;
+    std::unique_ptr<std::atomic<T>[]> slots_;
+  };
+
+ public:
+  static constexpr index_type kInitialCapacity = 64;
+
+  /*
+      Member functions
+  */
+
+  // default ctor
+  ws_deque() : top_(0), bottom_(0) {
+    arrays_.emplace_back(new array(kInitialCapacity));
+    array_.store(arrays_.back().get(), std::memory_order_relaxed);
+  }
+
+  ws_deque(const ws_deque &) = delete;
+  ws_deque &operator=(const ws_deque &) = delete;
+
+  // destructor
+  ~ws_deque() = default;
+
+  /*
+      Capacity
+  */
+
+  // a recent value while other threads are running
+  size_type size() const {
+    index_type bottom = bottom_.load(std::memory_order_relaxed);
+    index_type top = top_.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  /*
+      Owner
+  */
+
+  void push(T value) {
+    index_type bottom = bottom_.load(std::memory_order_relaxed);
+    index_type top = top_.load(std::memory_order_acquire);
+    array *a = array_.load(std::memory_order_relaxed);
+    if (bottom - top > a->capacity_ - 1) {
+      a = grow(a, top, bottom);
+    }
+    a->put(bottom, value);
+    bottom_.store(bottom + 1, std::memory_order_release);
+  }
+
+  // takes the newest element, false if there is none
+  bool pop(T &value) {
+    index_type bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    array *a = array_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    index_type top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return false;
+    }
+    value = a->get(bottom);
+    if (top == bottom) {
+      // the last element, race the thieves for it
+      bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return won;
+    }
+    return true;
+  }
+
+  /*
+      Thieves
+  */
+
+  // takes the oldest element, false if there is none or another thread
+  // took it first
+  bool steal(T &value) {
+    index_type top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    index_type bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) {
+      return false;
+    }
+    array *a = array_.load(std::memory_order_acquire);
+    T candidate = a->get(top);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    value = candidate;
+    return true;
+  }
+
+ private:
+  array *grow(array *old, index_type top, index_type bottom) {
+    arrays_.emplace_back(new array(old->capacity_ * 2));
+    array *grown = arrays_.back().get();
+    for (index_type i = top; i < bottom; ++i) {
+      grown->put(i, old->get(i));
+    }
+    array_.store(grown, std::memory_order_release);
+    return grown;
+  }
+
+  alignas(64) std::atomic<index_type> top_;
+  alignas(64) std::atomic<index_type> bottom_;
+  std::atomic<array *> array_;
+  std::vector<std::unique_ptr<array>> arrays_;  // owner only
+};
+
+}  // namespace s21
@@ -1,8 +1,17 @@
 #ifndef SRC_S21_CONTAINERS_H_
 #define SRC_S21_CONTAINERS_H_
 
+#include "model/s21_array.hh"
+#include "model/s21_deque.hh"
+#include "model/s21_list.hh"
 #include "model/s21_map.hh"
+#include "model/s21_priority_queue.hh"
+#include "model/s21_queue.hh"
 #include "model/s21_rb_tree.hh"
 #include "model/s21_set.hh"
+#include "model/s21_small_vector.hh"
+#include "model/s21_stack.hh"
+#include "model/s21_unrolled_list.hh"
+#include "model/s21_vector.hh"
 
 #endif  // SRC_S21_CONTAINERS_H_
\ No newline at end of file
@@ -1,6 +1,21 @@
 #ifndef SRC_S21_CONTAINERSPLUS_H_
 #define SRC_S21_CONTAINERSPLUS_H_
 
+#include "model/s21_buffered_map.hh"
+#include "model/s21_concurrent_map.hh"
+#include "model/s21_concurrent_skiplist_map.hh"
+#include "model/s21_int_set.hh"
+#include "model/s21_intrusive_set.hh"
+#include "model/s21_merge_all.hh"
+#include "model/s21_mpmc_queue.hh"
 #include "model/s21_multiset.hh"
+#include "model/s21_parallel.hh"
+#include "model/s21_persistent_rb_tree.hh"
+#include "model/s21_radix_map.hh"
+#include "model/s21_rcu_set.hh"
+#include "model/s21_seqlock_map.hh"
+#include "model/s21_spsc_queue.hh"
+#include "model/s21_thread_pool.hh"
+#include "model/s21_ws_deque.hh"
 
 #endif  // SRC_S21_CONTAINERSPLUS_H_
\ No newline at end of file
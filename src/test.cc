@@ -1,11 +1,24 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
 #include <deque>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <map>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <queue>
 #include <set>
+#include <stack>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "s21_containers.h"
@@ -782,6 +795,25 @@ TEST(Map, InsertMany) {
     map_eq(a, c);
   }
 }
+TEST(Map, BuildParallel) {
+  std::vector<std::pair<int, int>> input;
+  unsigned state = 5;
+  for (int i = 0; i < 100000; i++) {
+    state = state * 1103515245U + 12345U;
+    input.emplace_back((state >> 8) % 50000, i);
+  }
+  for (unsigned threads : {1U, 4U}) {
+    s21::map<int, int> a =
+        s21::map<int, int>::build_parallel(input.begin(), input.end(), threads);
+    // like insert(), the first pair of every key wins
+    std::map<int, int> c;
+    for (const auto& value : input) {
+      c.insert(value);
+    }
+    map_eq(a, c);
+  }
+}
+
 
 template <typename T>
 void multiset_eq(s21::multiset<T>& a, std::multiset<T>& b) {
@@ -1794,6 +1826,89 @@ TEST(Multiset, InsertMany) {
   }
 }
 
+TEST(Multiset, CountedDuplicates) {
+  s21::multiset<int> a;
+  std::multiset<int> b;
+  for (int i = 0; i < 100000; i++) {
+    a.insert(i % 3 == 0 ? 7 : i % 5);
+    b.insert(i % 3 == 0 ? 7 : i % 5);
+  }
+  EXPECT_EQ(a.unique_size(), 6U);
+  for (int key = 0; key < 8; key++) {
+    EXPECT_EQ(a.count(key), b.count(key));
+  }
+  multiset_eq(a, b);
+  a.erase(a.find(7));
+  b.erase(b.find(7));
+  EXPECT_EQ(a.count(7), b.count(7));
+  multiset_eq(a, b);
+}
+
+TEST(Multiset, InsertCount) {
+  s21::multiset<int> a{2};
+  std::multiset<int> b{2, 1, 1, 1, 2, 2};
+  auto it = a.insert(1, 3);
+  EXPECT_EQ(*it, 1);
+  EXPECT_EQ(*++it, 2);
+  a.insert(2, 2);
+  EXPECT_EQ(a.count(2), 3U);
+  EXPECT_EQ(a.unique_size(), 2U);
+  multiset_eq(a, b);
+}
+
+TEST(Multiset, InsertZeroAndEraseEnd) {
+  s21::multiset<int> a{2, 2};
+  EXPECT_EQ(a.insert(5, 0), a.end());
+  EXPECT_FALSE(a.contains(5));
+  EXPECT_EQ(a.unique_size(), 1U);
+  auto it = a.insert(2, 0);
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(a.count(2), 2U);
+  a.erase(a.end());
+  EXPECT_EQ(a.size(), 2U);
+  std::multiset<int> b{2, 2};
+  multiset_eq(a, b);
+}
+
+TEST(Multiset, FromSortedCountsSkipsZero) {
+  std::vector<std::pair<int, std::size_t>> counted{{1, 0}, {2, 2}, {3, 0}, {4, 1}, {5, 0}};
+  auto a = s21::multiset<int>::from_sorted_counts(counted.begin(), counted.end());
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_EQ(a.unique_size(), 2U);
+  EXPECT_FALSE(a.contains(3));
+  std::multiset<int> b{2, 2, 4};
+  multiset_eq(a, b);
+  std::vector<std::pair<int, std::size_t>> none{{7, 0}};
+  EXPECT_TRUE(s21::multiset<int>::from_sorted_counts(none.begin(), none.end()).empty());
+}
+TEST(Multiset, IteratorDecrement) {
+  s21::multiset<int> a{3, 1, 3, 2, 3};
+  std::vector<int> expected{3, 3, 3, 2, 1};
+  auto it = a.end();
+  for (int value : expected) {
+    --it;
+    EXPECT_EQ(*it, value);
+  }
+  EXPECT_EQ(it, a.begin());
+}
+TEST(Multiset, BuildParallel) {
+  std::vector<int> input;
+  unsigned state = 9;
+  for (int i = 0; i < 100000; i++) {
+    state = state * 1103515245U + 12345U;
+    input.push_back((state >> 8) % 5000);
+  }
+  for (unsigned threads : {1U, 4U}) {
+    s21::multiset<int> a =
+        s21::multiset<int>::build_parallel(input.begin(), input.end(), threads);
+    std::multiset<int> c(input.begin(), input.end());
+    multiset_eq(a, c);
+    EXPECT_EQ(a.unique_size(), std::set<int>(input.begin(), input.end()).size());
+    EXPECT_EQ(a.count(42), c.count(42));
+  }
+}
+
+
 template <typename T>
 void set_eq(s21::set<T>& a, std::set<T>& b) {
   EXPECT_EQ(a.empty(), b.empty());
@@ -2725,6 +2840,61 @@ TEST(Set, InsertMany) {
   }
 }
 
+TEST(Set, MirrorBalancing) {
+  // Descending inserts keep hitting insert case 3.2.3 (left-left chain).
+  {
+    s21::set<int> a;
+    std::set<int> c;
+    for (int i = 1000; i > 0; i--) {
+      a.insert(i);
+      c.insert(i);
+    }
+    set_eq(a, c);
+  }
+  // Erasing the black right leaf 3 leaves sibling 1 with a red left child 0,
+  // which is delete mirror case 3.4.
+  {
+    s21::set<int> a{2, 1, 3, 0};
+    std::set<int> c{2, 1, 3, 0};
+    a.erase(a.find(3));
+    c.erase(3);
+    set_eq(a, c);
+  }
+  // Draining from the right end keeps the deficit on the right side.
+  {
+    s21::set<int> a;
+    std::set<int> c;
+    for (int i = 0; i < 1000; i++) {
+      a.insert(i);
+      c.insert(i);
+    }
+    for (int i = 999; i >= 0; i--) {
+      a.erase(a.find(i));
+      c.erase(i);
+      if (i % 100 == 0) set_eq(a, c);
+    }
+  }
+  // Mixed inserts and erases reach every balancing case. A tree left
+  // unbalanced by a wrong rotation breaks a later erase.
+  {
+    s21::set<int> a;
+    std::set<int> c;
+    unsigned state = 7;
+    for (int i = 0; i < 200000; i++) {
+      state = state * 1103515245U + 12345U;
+      int key = (state >> 8) % 2000;
+      if ((state >> 4) & 1) {
+        a.insert(key);
+        c.insert(key);
+      } else {
+        auto it = a.find(key);
+        if (it != a.end()) a.erase(it);
+        c.erase(key);
+      }
+    }
+    set_eq(a, c);
+  }
+}
 TEST(Set, Functional) {
   {
     s21::set<int> a{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
@@ -2742,6 +2912,3426 @@ TEST(Set, Functional) {
     set_eq(a, c);
   }
 }
+TEST(Set, BuildParallel) {
+  std::vector<int> input;
+  unsigned state = 3;
+  for (int i = 0; i < 100000; i++) {
+    state = state * 1103515245U + 12345U;
+    input.push_back((state >> 8) % 50000);
+  }
+  for (unsigned threads : {1U, 4U}) {
+    s21::set<int> a = s21::set<int>::build_parallel(input.begin(), input.end(), threads);
+    std::set<int> c(input.begin(), input.end());
+    set_eq(a, c);
+    a.insert(-1);
+    c.insert(-1);
+    a.erase(a.find(*c.rbegin()));
+    c.erase(*c.rbegin());
+    set_eq(a, c);
+  }
+  std::vector<int> empty;
+  s21::set<int> a = s21::set<int>::build_parallel(empty.begin(), empty.end());
+  EXPECT_TRUE(a.empty());
+}
+
+
+template <typename T>
+void int_set_eq(s21::int_set<T>& a, std::set<T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  auto ait = a.begin();
+  auto bit = b.begin();
+  while (bit != b.end()) {
+    EXPECT_EQ(*ait, *bit);
+    ait++;
+    bit++;
+  }
+  EXPECT_EQ(ait, a.end());
+}
+
+TEST(IntSet, DefaultConstructor) {
+  s21::int_set<unsigned> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.max_size(), 4294967296ULL);
+  EXPECT_EQ(a.begin(), a.end());
+}
+
+TEST(IntSet, InitializerListConstructor) {
+  {
+    s21::int_set<unsigned> a{};
+    std::set<unsigned> b{};
+    int_set_eq(a, b);
+  }
+  {
+    s21::int_set<unsigned> a{5, 4, 3, 2, 1};
+    std::set<unsigned> b{5, 4, 3, 2, 1};
+    int_set_eq(a, b);
+  }
+  {
+    s21::int_set<unsigned> a{3, 3, 2, 2, 1, 1};
+    std::set<unsigned> b{3, 3, 2, 2, 1, 1};
+    int_set_eq(a, b);
+  }
+  {
+    s21::int_set<unsigned> a{0, 63, 64, 4095, 4096, 262143, 262144, 1000000};
+    std::set<unsigned> b{0, 63, 64, 4095, 4096, 262143, 262144, 1000000};
+    int_set_eq(a, b);
+  }
+}
+
+TEST(IntSet, CopyMove) {
+  s21::int_set<unsigned> a{1, 100, 10000};
+  std::set<unsigned> c{1, 100, 10000};
+  s21::int_set<unsigned> b(a);
+  a.clear();
+  int_set_eq(b, c);
+  s21::int_set<unsigned> d(std::move(b));
+  int_set_eq(d, c);
+  s21::int_set<unsigned> e;
+  e = d;
+  int_set_eq(e, c);
+  s21::int_set<unsigned> f;
+  f = std::move(e);
+  int_set_eq(f, c);
+}
+
+TEST(IntSet, Insert) {
+  s21::int_set<unsigned> a;
+  std::set<unsigned> b;
+  unsigned key = 7;
+  for (int i = 0; i < 2000; i++) {
+    key = (key * 1103515245U + 12345U) % 300000U;
+    auto ares = a.insert(key);
+    auto bres = b.insert(key);
+    EXPECT_EQ(ares.second, bres.second);
+    EXPECT_EQ(*ares.first, *bres.first);
+  }
+  int_set_eq(a, b);
+}
+
+TEST(IntSet, Erase) {
+  s21::int_set<unsigned> a{1, 2, 64, 65, 4096, 70000};
+  std::set<unsigned> b{1, 2, 64, 65, 4096, 70000};
+  int size = a.size();
+  for (int i = 0; i < size; i++) {
+    a.erase(a.begin());
+    b.erase(b.begin());
+    int_set_eq(a, b);
+  }
+  a.insert_many(3, 5, 7);
+  EXPECT_EQ(a.erase(5U), 1U);
+  EXPECT_EQ(a.erase(5U), 0U);
+  EXPECT_EQ(a.erase(1000000U), 0U);
+  EXPECT_FALSE(a.contains(5));
+  EXPECT_EQ(a.size(), 2U);
+}
+
+TEST(IntSet, Swap) {
+  s21::int_set<unsigned> a{1, 2, 3};
+  s21::int_set<unsigned> b{100000};
+  std::set<unsigned> c{1, 2, 3};
+  std::set<unsigned> d{100000};
+  a.swap(b);
+  int_set_eq(a, d);
+  int_set_eq(b, c);
+}
+
+TEST(IntSet, Merge) {
+  {
+    s21::int_set<unsigned> a{1, 2, 3};
+    s21::int_set<unsigned> b{3, 4, 500000};
+    std::set<unsigned> c{1, 2, 3, 4, 500000};
+    a.merge(b);
+    int_set_eq(a, c);
+  }
+  {
+    s21::int_set<unsigned> a{1, 2, 300000};
+    s21::int_set<unsigned> b{7};
+    std::set<unsigned> c{1, 2, 7, 300000};
+    a.merge(b);
+    int_set_eq(a, c);
+  }
+}
+
+TEST(IntSet, ContainsFind) {
+  s21::int_set<unsigned> a{10, 20, 30, 100000};
+  for (unsigned key : {0U, 10U, 15U, 20U, 30U, 99999U, 100000U, 5000000U}) {
+    bool expected = key == 10 || key == 20 || key == 30 || key == 100000;
+    EXPECT_EQ(a.contains(key), expected);
+    EXPECT_EQ(a.count(key), expected ? 1U : 0U);
+    if (expected) {
+      EXPECT_EQ(*a.find(key), key);
+    } else {
+      EXPECT_EQ(a.find(key), a.end());
+    }
+  }
+}
+
+TEST(IntSet, Bounds) {
+  std::vector<unsigned> keys{0, 1, 63, 64, 65, 4095, 4096, 4097, 300000};
+  s21::int_set<unsigned> a{1, 64, 4097, 200000};
+  std::set<unsigned> b{1, 64, 4097, 200000};
+  for (unsigned key : keys) {
+    auto alower = a.lower_bound(key);
+    auto blower = b.lower_bound(key);
+    if (blower == b.end()) {
+      EXPECT_EQ(alower, a.end());
+    } else {
+      EXPECT_EQ(*alower, *blower);
+    }
+    auto aupper = a.upper_bound(key);
+    auto bupper = b.upper_bound(key);
+    if (bupper == b.end()) {
+      EXPECT_EQ(aupper, a.end());
+    } else {
+      EXPECT_EQ(*aupper, *bupper);
+    }
+  }
+}
+
+TEST(IntSet, ReverseIteration) {
+  s21::int_set<unsigned> a{3, 70, 5000, 262145};
+  std::set<unsigned> b{3, 70, 5000, 262145};
+  auto ait = a.end();
+  auto bit = b.end();
+  while (bit != b.begin()) {
+    --ait;
+    --bit;
+    EXPECT_EQ(*ait, *bit);
+  }
+  EXPECT_EQ(ait, a.begin());
+}
+
+TEST(IntSet, InsertMany) {
+  s21::int_set<unsigned> a{1};
+  std::set<unsigned> c{1, 2, 3, 70000};
+  auto res = a.insert_many(1U, 2U, 3U, 70000U);
+  EXPECT_EQ(res.size(), 4U);
+  EXPECT_FALSE(res[0].second);
+  EXPECT_TRUE(res[3].second);
+  int_set_eq(a, c);
+}
+
+template <typename T>
+void radix_map_eq(s21::radix_map<T>& a, std::map<std::string, T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  auto ait = a.begin();
+  auto bit = b.begin();
+  while (bit != b.end()) {
+    EXPECT_EQ(*ait, *bit);
+    ait++;
+    bit++;
+  }
+  EXPECT_EQ(ait, a.end());
+}
+
+TEST(RadixMap, DefaultConstructor) {
+  s21::radix_map<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+}
+
+TEST(RadixMap, InitializerListConstructor) {
+  {
+    s21::radix_map<int> a{{"b", 2}, {"a", 1}, {"c", 3}};
+    std::map<std::string, int> b{{"b", 2}, {"a", 1}, {"c", 3}};
+    radix_map_eq(a, b);
+  }
+  {
+    s21::radix_map<int> a{{"abc", 1}, {"ab", 2}, {"a", 3}, {"", 4}, {"abd", 5}};
+    std::map<std::string, int> b{{"abc", 1}, {"ab", 2}, {"a", 3}, {"", 4}, {"abd", 5}};
+    radix_map_eq(a, b);
+  }
+  {
+    s21::radix_map<int> a{{"x", 1}, {"x", 2}, {"x", 3}};
+    std::map<std::string, int> b{{"x", 1}, {"x", 2}, {"x", 3}};
+    radix_map_eq(a, b);
+  }
+}
+
+TEST(RadixMap, CopyMove) {
+  s21::radix_map<int> a{{"/api/v1/users", 1}, {"/api/v1/orders", 2}, {"/api/v2", 3}};
+  std::map<std::string, int> c{{"/api/v1/users", 1}, {"/api/v1/orders", 2}, {"/api/v2", 3}};
+  s21::radix_map<int> b(a);
+  a.clear();
+  radix_map_eq(b, c);
+  s21::radix_map<int> d(std::move(b));
+  radix_map_eq(d, c);
+  s21::radix_map<int> e;
+  e = d;
+  radix_map_eq(e, c);
+  s21::radix_map<int> f{{"z", 0}};
+  f = std::move(e);
+  radix_map_eq(f, c);
+}
+
+TEST(RadixMap, At) {
+  s21::radix_map<int> a{{"/users", 1}, {"/users/", 2}, {"/user", 3}};
+  EXPECT_EQ(a.at("/users"), 1);
+  EXPECT_EQ(a.at("/users/"), 2);
+  EXPECT_EQ(a.at("/user"), 3);
+  a.at("/user") = 30;
+  EXPECT_EQ(a.at("/user"), 30);
+  EXPECT_ANY_THROW(a.at("/use"));
+  EXPECT_ANY_THROW(a.at("/users/x"));
+  EXPECT_ANY_THROW(a.at(""));
+}
+
+TEST(RadixMap, OperatorSquaredBrackets) {
+  s21::radix_map<int> a;
+  std::map<std::string, int> b;
+  for (const char* key : {"/a", "/a/b", "/a", "/", "/a/c", "/a/b"}) {
+    a[key]++;
+    b[key]++;
+  }
+  radix_map_eq(a, b);
+}
+
+TEST(RadixMap, Insert) {
+  s21::radix_map<int> a;
+  std::map<std::string, int> b;
+  unsigned state = 1;
+  for (int i = 0; i < 3000; i++) {
+    state = state * 1103515245U + 12345U;
+    std::string key = "/route/" + std::to_string(state % 700) + "/" + std::to_string(state % 7);
+    auto ares = a.insert(key, i);
+    auto bres = b.insert({key, i});
+    EXPECT_EQ(ares.second, bres.second);
+    EXPECT_EQ(*ares.first, *bres.first);
+  }
+  radix_map_eq(a, b);
+}
+
+TEST(RadixMap, InsertOrAssign) {
+  s21::radix_map<int> a{{"k", 1}};
+  auto res = a.insert_or_assign("k", 2);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ((*res.first).second, 2);
+  res = a.insert_or_assign("kk", 3);
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(a.size(), 2U);
+  EXPECT_EQ(a.at("kk"), 3);
+}
+
+TEST(RadixMap, WideNodes) {
+  s21::radix_map<int> a;
+  std::map<std::string, int> b;
+  for (int i = 255; i >= 0; i--) {
+    std::string key = "p";
+    key += static_cast<char>(i);
+    a.insert(key, i);
+    b.insert({key, i});
+  }
+  radix_map_eq(a, b);
+  for (int i = 0; i < 256; i += 3) {
+    std::string key = "p";
+    key += static_cast<char>(i);
+    EXPECT_EQ(a.erase(key), 1U);
+    b.erase(key);
+  }
+  radix_map_eq(a, b);
+}
+
+TEST(RadixMap, Erase) {
+  std::vector<std::string> keys{"", "a", "ab", "abc", "abd", "b", "ba", "/x/y/z", "/x/y", "/x"};
+  s21::radix_map<int> a;
+  std::map<std::string, int> b;
+  for (size_t i = 0; i < keys.size(); i++) {
+    a.insert(keys[i], i);
+    b.insert({keys[i], i});
+  }
+  int size = a.size();
+  for (int i = 0; i < size; i++) {
+    a.erase(a.begin());
+    b.erase(b.begin());
+    radix_map_eq(a, b);
+  }
+  for (size_t i = 0; i < keys.size(); i++) {
+    a.insert(keys[i], i);
+    b.insert({keys[i], i});
+  }
+  for (size_t i = keys.size(); i > 0; i--) {
+    EXPECT_EQ(a.erase(keys[i - 1]), 1U);
+    EXPECT_EQ(a.erase(keys[i - 1]), 0U);
+    b.erase(keys[i - 1]);
+    radix_map_eq(a, b);
+  }
+}
+
+TEST(RadixMap, Iterators) {
+  s21::radix_map<int> a{{"b", 2}, {"a", 1}, {"ba", 3}};
+  auto it = a.end();
+  --it;
+  EXPECT_EQ((*it).first, "ba");
+  it--;
+  EXPECT_EQ(it->first, "b");
+  --it;
+  EXPECT_EQ(it, a.begin());
+  auto inserted = a.insert("aa", 4).first;
+  EXPECT_EQ((*++it).first, "aa");
+  EXPECT_EQ(it, inserted);
+}
+
+TEST(RadixMap, SwapMerge) {
+  s21::radix_map<int> a{{"1", 1}, {"2", 2}};
+  s21::radix_map<int> b{{"3", 3}};
+  std::map<std::string, int> c{{"1", 1}, {"2", 2}};
+  std::map<std::string, int> d{{"3", 3}};
+  a.swap(b);
+  radix_map_eq(a, d);
+  radix_map_eq(b, c);
+  a.merge(b);
+  std::map<std::string, int> e{{"1", 1}, {"2", 2}, {"3", 3}};
+  radix_map_eq(a, e);
+}
+
+TEST(RadixMap, ContainsFind) {
+  s21::radix_map<int> a{{"/api", 1}, {"/api/v1", 2}};
+  EXPECT_TRUE(a.contains("/api"));
+  EXPECT_TRUE(a.contains("/api/v1"));
+  EXPECT_FALSE(a.contains("/ap"));
+  EXPECT_FALSE(a.contains("/api/"));
+  EXPECT_FALSE(a.contains("/api/v2"));
+  EXPECT_EQ(a.find("/api/v1")->second, 2);
+  EXPECT_EQ(a.find("/api/v"), a.end());
+}
+
+TEST(RadixMap, InsertMany) {
+  s21::radix_map<int> a{{"a", 1}};
+  std::map<std::string, int> c{{"a", 1}, {"b", 2}, {"c", 3}};
+  auto res = a.insert_many(std::pair<const std::string, int>{"a", 5},
+                           std::pair<const std::string, int>{"b", 2},
+                           std::pair<const std::string, int>{"c", 3});
+  EXPECT_EQ(res.size(), 3U);
+  EXPECT_FALSE(res[0].second);
+  EXPECT_TRUE(res[2].second);
+  radix_map_eq(a, c);
+}
+
+template <typename K, typename T>
+void skiplist_map_eq(s21::concurrent_skiplist_map<K, T>& a, std::map<K, T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  auto ait = a.begin();
+  auto bit = b.begin();
+  while (bit != b.end()) {
+    EXPECT_EQ(*ait, *bit);
+    ait++;
+    bit++;
+  }
+  EXPECT_EQ(ait, a.end());
+}
+
+TEST(ConcurrentSkiplistMap, DefaultConstructor) {
+  s21::concurrent_skiplist_map<int, int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+}
+
+TEST(ConcurrentSkiplistMap, InitializerListConstructor) {
+  s21::concurrent_skiplist_map<int, int> a{{3, 3}, {1, 1}, {2, 2}, {1, 10}};
+  std::map<int, int> b{{3, 3}, {1, 1}, {2, 2}, {1, 10}};
+  skiplist_map_eq(a, b);
+}
+
+TEST(ConcurrentSkiplistMap, Insert) {
+  s21::concurrent_skiplist_map<int, int> a;
+  std::map<int, int> b;
+  unsigned state = 1;
+  for (int i = 0; i < 2000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = state % 500;
+    auto ares = a.insert(key, i);
+    auto bres = b.insert({key, i});
+    EXPECT_EQ(ares.second, bres.second);
+    EXPECT_EQ(*ares.first, *bres.first);
+  }
+  skiplist_map_eq(a, b);
+}
+
+TEST(ConcurrentSkiplistMap, Erase) {
+  s21::concurrent_skiplist_map<int, int> a{{1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}};
+  std::map<int, int> b{{1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}};
+  EXPECT_EQ(a.erase(3), 1U);
+  EXPECT_EQ(a.erase(3), 0U);
+  b.erase(3);
+  skiplist_map_eq(a, b);
+  a.erase(a.begin());
+  b.erase(b.begin());
+  skiplist_map_eq(a, b);
+  a.erase(a.find(5));
+  b.erase(5);
+  skiplist_map_eq(a, b);
+  a.insert(3, 30);
+  b.insert({3, 30});
+  skiplist_map_eq(a, b);
+}
+
+TEST(ConcurrentSkiplistMap, Lookup) {
+  s21::concurrent_skiplist_map<int, int> a{{1, 10}, {2, 20}};
+  EXPECT_TRUE(a.contains(1));
+  EXPECT_FALSE(a.contains(3));
+  EXPECT_EQ(a.count(2), 1U);
+  EXPECT_EQ(a.at(2), 20);
+  EXPECT_ANY_THROW(a.at(3));
+  EXPECT_EQ(a.find(1)->second, 10);
+  EXPECT_EQ(a.find(3), a.end());
+}
+
+TEST(ConcurrentSkiplistMap, Clear) {
+  s21::concurrent_skiplist_map<int, int> a{{1, 10}, {2, 20}};
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.begin(), a.end());
+  a.insert(7, 7);
+  EXPECT_EQ(a.size(), 1U);
+}
+
+TEST(ConcurrentSkiplistMap, InsertMany) {
+  s21::concurrent_skiplist_map<int, int> a{{1, 1}};
+  std::map<int, int> c{{1, 1}, {2, 2}, {3, 3}};
+  auto res = a.insert_many(std::pair<const int, int>{1, 5}, std::pair<const int, int>{2, 2},
+                           std::pair<const int, int>{3, 3});
+  EXPECT_EQ(res.size(), 3U);
+  EXPECT_FALSE(res[0].second);
+  EXPECT_TRUE(res[1].second);
+  skiplist_map_eq(a, c);
+}
+
+TEST(ConcurrentSkiplistMap, ConcurrentDisjointInserts) {
+  s21::concurrent_skiplist_map<int, int> a;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&a, t] {
+      for (int i = t; i < 4000; i += 4) {
+        a.insert(i, i * 2);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(a.size(), 4000U);
+  int expected = 0;
+  for (auto it = a.begin(); it != a.end(); ++it) {
+    EXPECT_EQ(it->first, expected);
+    EXPECT_EQ(it->second, expected * 2);
+    expected++;
+  }
+}
+
+TEST(ConcurrentSkiplistMap, ConcurrentMixed) {
+  s21::concurrent_skiplist_map<int, int> a;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&a, t] {
+      unsigned state = t + 1;
+      for (int i = 0; i < 20000; i++) {
+        state = state * 1103515245U + 12345U;
+        int key = (state >> 8) % 256;
+        switch ((state >> 4) % 3) {
+          case 0:
+            a.insert(key, -key);
+            break;
+          case 1:
+            a.erase(key);
+            break;
+          default: {
+            auto it = a.find(key);
+            if (it != a.end()) {
+              EXPECT_EQ(it->second, -key);
+            }
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  size_t count = 0;
+  int prev = -1;
+  for (auto it = a.begin(); it != a.end(); ++it) {
+    EXPECT_LT(prev, it->first);
+    prev = it->first;
+    count++;
+  }
+  EXPECT_EQ(count, a.size());
+}
+
+template <typename T>
+void persistent_tree_eq(const s21::persistent_rb_tree<T>& a, const std::set<T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  auto ait = a.begin();
+  auto bit = b.begin();
+  while (bit != b.end()) {
+    EXPECT_EQ(*ait, *bit);
+    ait++;
+    bit++;
+  }
+  EXPECT_EQ(ait, a.end());
+}
+
+TEST(PersistentRbTree, DefaultConstructor) {
+  s21::persistent_rb_tree<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+}
+
+TEST(PersistentRbTree, InitializerListConstructor) {
+  s21::persistent_rb_tree<int> a{5, 1, 4, 1, 3};
+  std::set<int> b{5, 1, 4, 1, 3};
+  persistent_tree_eq(a, b);
+}
+
+TEST(PersistentRbTree, CopyMove) {
+  s21::persistent_rb_tree<int> a{1, 2, 3};
+  std::set<int> c{1, 2, 3};
+  s21::persistent_rb_tree<int> b(a);
+  a.clear();
+  persistent_tree_eq(b, c);
+  s21::persistent_rb_tree<int> d(std::move(b));
+  persistent_tree_eq(d, c);
+  s21::persistent_rb_tree<int> e{7};
+  e = d;
+  persistent_tree_eq(e, c);
+  s21::persistent_rb_tree<int> f;
+  f = std::move(e);
+  persistent_tree_eq(f, c);
+}
+
+TEST(PersistentRbTree, InsertErase) {
+  s21::persistent_rb_tree<int> a;
+  std::set<int> b;
+  unsigned state = 1;
+  for (int i = 0; i < 20000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 1000;
+    if ((state >> 4) % 2) {
+      auto ares = a.insert(key);
+      EXPECT_EQ(ares.second, b.insert(key).second);
+      EXPECT_EQ(*ares.first, key);
+    } else {
+      EXPECT_EQ(a.erase(key), b.erase(key));
+    }
+  }
+  persistent_tree_eq(a, b);
+  while (!a.empty()) {
+    a.erase(a.begin());
+    b.erase(b.begin());
+  }
+  persistent_tree_eq(a, b);
+}
+
+TEST(PersistentRbTree, Snapshot) {
+  s21::persistent_rb_tree<int> a;
+  std::set<int> b;
+  std::vector<s21::persistent_rb_tree<int>> snapshots;
+  std::vector<std::set<int>> expected;
+  unsigned state = 7;
+  for (int i = 0; i < 5000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 300;
+    if ((state >> 4) % 3) {
+      a.insert(key);
+      b.insert(key);
+    } else {
+      a.erase(key);
+      b.erase(key);
+    }
+    if (i % 500 == 0) {
+      snapshots.push_back(a.snapshot());
+      expected.push_back(b);
+    }
+  }
+  a.clear();
+  for (size_t i = 0; i < snapshots.size(); i++) {
+    persistent_tree_eq(snapshots[i], expected[i]);
+  }
+}
+
+TEST(PersistentRbTree, Iterators) {
+  s21::persistent_rb_tree<int> a{2, 1, 3};
+  auto it = a.end();
+  --it;
+  EXPECT_EQ(*it, 3);
+  it--;
+  EXPECT_EQ(*it, 2);
+  --it;
+  EXPECT_EQ(it, a.begin());
+  EXPECT_EQ(*++it, 2);
+}
+
+TEST(PersistentRbTree, Lookup) {
+  s21::persistent_rb_tree<int> a{10, 20, 30};
+  EXPECT_TRUE(a.contains(20));
+  EXPECT_FALSE(a.contains(25));
+  EXPECT_EQ(a.count(30), 1U);
+  EXPECT_EQ(*a.find(10), 10);
+  EXPECT_EQ(a.find(11), a.end());
+  EXPECT_EQ(*a.lower_bound(20), 20);
+  EXPECT_EQ(*a.lower_bound(21), 30);
+  EXPECT_EQ(*a.upper_bound(20), 30);
+  EXPECT_EQ(a.upper_bound(30), a.end());
+  auto range = a.equal_range(20);
+  EXPECT_EQ(*range.first, 20);
+  EXPECT_EQ(*range.second, 30);
+}
+
+TEST(PersistentRbTree, SwapMerge) {
+  s21::persistent_rb_tree<int> a{1, 2};
+  s21::persistent_rb_tree<int> b{3};
+  a.swap(b);
+  persistent_tree_eq(a, std::set<int>{3});
+  persistent_tree_eq(b, std::set<int>{1, 2});
+  a.merge(b);
+  persistent_tree_eq(a, std::set<int>{1, 2, 3});
+}
+
+TEST(PersistentRbTree, InsertMany) {
+  s21::persistent_rb_tree<int> a{1};
+  auto res = a.insert_many(1, 2, 3);
+  EXPECT_EQ(res.size(), 3U);
+  EXPECT_FALSE(res[0].second);
+  EXPECT_TRUE(res[2].second);
+  persistent_tree_eq(a, std::set<int>{1, 2, 3});
+}
+
+TEST(PersistentRbTree, ConcurrentSnapshotReaders) {
+  s21::persistent_rb_tree<int> a;
+  for (int i = 0; i < 1000; i++) {
+    a.insert(i);
+  }
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; t++) {
+    readers.emplace_back([snapshot = a.snapshot()] {
+      int expected = 0;
+      for (int key : snapshot) {
+        EXPECT_EQ(key, expected++);
+      }
+      EXPECT_EQ(expected, 1000);
+    });
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    a.erase(i);
+    a.insert(i + 1000);
+  }
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(a.size(), 1000U);
+  EXPECT_EQ(*a.begin(), 1);
+}
+
+template <typename K, typename T, std::size_t Shards>
+void concurrent_map_eq(const s21::concurrent_map<K, T, Shards>& a, std::map<K, T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  auto bit = b.begin();
+  a.for_each([&](const std::pair<const K, T>& value) {
+    ASSERT_NE(bit, b.end());
+    EXPECT_EQ(value, *bit);
+    bit++;
+  });
+  EXPECT_EQ(bit, b.end());
+}
+
+TEST(ConcurrentMap, DefaultConstructor) {
+  s21::concurrent_map<int, int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.shard_count(), 16U);
+}
+
+TEST(ConcurrentMap, InitializerListConstructor) {
+  s21::concurrent_map<int, int, 4> a{{3, 30}, {1, 10}, {2, 20}, {1, 100}};
+  std::map<int, int> b{{3, 30}, {1, 10}, {2, 20}, {1, 100}};
+  concurrent_map_eq(a, b);
+}
+
+TEST(ConcurrentMap, InsertErase) {
+  s21::concurrent_map<int, int, 8> a;
+  std::map<int, int> b;
+  unsigned state = 1;
+  for (int i = 0; i < 5000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 700;
+    if ((state >> 4) % 3) {
+      EXPECT_EQ(a.insert(key, i), b.insert({key, i}).second);
+    } else {
+      EXPECT_EQ(a.erase(key), b.erase(key));
+    }
+  }
+  concurrent_map_eq(a, b);
+  a.clear();
+  b.clear();
+  concurrent_map_eq(a, b);
+}
+
+TEST(ConcurrentMap, InsertOrAssign) {
+  s21::concurrent_map<int, int> a{{1, 1}};
+  EXPECT_FALSE(a.insert_or_assign(1, 5));
+  EXPECT_TRUE(a.insert_or_assign(2, 7));
+  EXPECT_EQ(a.at(1), 5);
+  EXPECT_EQ(a.at(2), 7);
+}
+
+TEST(ConcurrentMap, Lookup) {
+  s21::concurrent_map<int, int> a{{1, 10}, {2, 20}};
+  EXPECT_TRUE(a.contains(1));
+  EXPECT_FALSE(a.contains(3));
+  EXPECT_EQ(a.find(2).value(), 20);
+  EXPECT_FALSE(a.find(3).has_value());
+  EXPECT_EQ(a.at(1), 10);
+  EXPECT_ANY_THROW(a.at(3));
+}
+
+TEST(ConcurrentMap, Upsert) {
+  s21::concurrent_map<int, int> a;
+  EXPECT_TRUE(a.upsert(4, [](int& value) { value += 2; }));
+  EXPECT_FALSE(a.upsert(4, [](int& value) { value *= 10; }));
+  EXPECT_EQ(a.at(4), 20);
+}
+
+TEST(ConcurrentMap, Snapshot) {
+  s21::concurrent_map<int, int, 3> a{{5, 5}, {1, 1}, {3, 3}};
+  auto b = a.snapshot();
+  EXPECT_EQ(b.size(), 3U);
+  int expected = 1;
+  for (auto value : b) {
+    EXPECT_EQ(value.first, expected);
+    expected += 2;
+  }
+}
+
+TEST(ConcurrentMap, StridedKeysSpread) {
+  using map_type = s21::concurrent_map<int, int, 16>;
+  for (int stride : {1, 16, 64, 4096}) {
+    std::vector<int> per_shard(map_type::shard_count());
+    for (int i = 0; i < 1600; i++) {
+      std::size_t index = map_type::shard_index(i * stride);
+      ASSERT_LT(index, map_type::shard_count());
+      per_shard[index]++;
+    }
+    // no shard is empty, none takes more than twice its share
+    for (int count : per_shard) {
+      EXPECT_GT(count, 0);
+      EXPECT_LT(count, 200);
+    }
+  }
+  EXPECT_LT((s21::concurrent_map<int, int, 3>::shard_index(12345)), 3U);
+}
+
+TEST(ConcurrentMap, ConcurrentUpsert) {
+  s21::concurrent_map<int, long> a;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&a] {
+      for (int i = 0; i < 10000; i++) {
+        a.upsert(i % 100, [](long& value) { value++; });
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(a.size(), 100U);
+  int expected = 0;
+  a.for_each([&expected](const std::pair<const int, long>& value) {
+    EXPECT_EQ(value.first, expected++);
+    EXPECT_EQ(value.second, 400);
+  });
+}
+
+TEST(ConcurrentMap, ConcurrentMixed) {
+  s21::concurrent_map<int, int, 4> a;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&a, t] {
+      unsigned state = t + 1;
+      for (int i = 0; i < 20000; i++) {
+        state = state * 1103515245U + 12345U;
+        int key = (state >> 8) % 256;
+        switch ((state >> 4) % 3) {
+          case 0:
+            a.insert_or_assign(key, -key);
+            break;
+          case 1:
+            a.erase(key);
+            break;
+          default: {
+            auto value = a.find(key);
+            if (value) {
+              EXPECT_EQ(*value, -key);
+            }
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  int prev = -1;
+  size_t count = 0;
+  a.for_each([&](const std::pair<const int, int>& value) {
+    EXPECT_LT(prev, value.first);
+    prev = value.first;
+    count++;
+  });
+  EXPECT_EQ(count, a.size());
+}
+
+TEST(SeqlockMap, DefaultConstructor) {
+  s21::seqlock_map<int, int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.version(), 0U);
+}
+
+TEST(SeqlockMap, InitializerListConstructor) {
+  s21::seqlock_map<int, int> a{{3, 30}, {1, 10}, {2, 20}, {1, 100}};
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_EQ(a.at(1), 10);
+  EXPECT_EQ(a.at(3), 30);
+}
+
+TEST(SeqlockMap, InsertErase) {
+  s21::seqlock_map<int, int> a;
+  std::map<int, int> b;
+  unsigned state = 1;
+  for (int i = 0; i < 5000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 700;
+    if ((state >> 4) % 3) {
+      EXPECT_EQ(a.insert(key, i), b.insert({key, i}).second);
+    } else {
+      EXPECT_EQ(a.erase(key), b.erase(key));
+    }
+  }
+  EXPECT_EQ(a.size(), b.size());
+  for (int key = 0; key < 700; key++) {
+    auto it = b.find(key);
+    EXPECT_EQ(a.contains(key), it != b.end());
+    if (it != b.end()) {
+      EXPECT_EQ(a.find(key).value(), it->second);
+    }
+  }
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  EXPECT_FALSE(a.contains(0));
+}
+
+TEST(SeqlockMap, InsertOrAssign) {
+  s21::seqlock_map<int, double> a{{1, 1.5}};
+  EXPECT_FALSE(a.insert_or_assign(1, 2.5));
+  EXPECT_TRUE(a.insert_or_assign(2, 3.5));
+  EXPECT_EQ(a.at(1), 2.5);
+  EXPECT_EQ(a.at(2), 3.5);
+  EXPECT_ANY_THROW(a.at(3));
+}
+
+TEST(SeqlockMap, Version) {
+  s21::seqlock_map<int, int> a;
+  auto version = a.version();
+  a.insert(1, 1);
+  EXPECT_GT(a.version(), version);
+  version = a.version();
+  a.insert(1, 2);
+  a.erase(5);
+  EXPECT_EQ(a.version(), version);
+  EXPECT_EQ(a.version() % 2, 0U);
+}
+
+TEST(SeqlockMap, ConcurrentReaders) {
+  // even keys are always present, odd keys come and go
+  s21::seqlock_map<int, int> a;
+  for (int key = 0; key < 512; key += 2) {
+    a.insert(key, key * 3);
+  }
+  std::atomic<bool> done{false};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 3; t++) {
+    readers.emplace_back([&a, &done, t] {
+      unsigned state = t + 1;
+      while (!done.load()) {
+        state = state * 1103515245U + 12345U;
+        int key = (state >> 8) % 512;
+        auto value = a.find(key);
+        if (key % 2 == 0) {
+          ASSERT_TRUE(value.has_value());
+        }
+        if (value) {
+          EXPECT_EQ(*value, key * 3);
+        }
+      }
+    });
+  }
+  for (int round = 0; round < 20; round++) {
+    for (int key = 1; key < 512; key += 2) {
+      a.insert(key, key * 3);
+    }
+    for (int key = 1; key < 512; key += 2) {
+      a.erase(key);
+    }
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(a.size(), 256U);
+}
+
+TEST(RcuSet, DefaultConstructor) {
+  s21::rcu_set<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_FALSE(a.contains(0));
+}
+
+TEST(RcuSet, InitializerListConstructor) {
+  s21::rcu_set<int> a{3, 1, 2, 1};
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_TRUE(a.contains(1));
+  EXPECT_TRUE(a.contains(3));
+  EXPECT_FALSE(a.contains(4));
+}
+
+TEST(RcuSet, InsertErase) {
+  s21::rcu_set<int> a;
+  std::set<int> b;
+  unsigned state = 1;
+  for (int i = 0; i < 5000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 700;
+    if ((state >> 4) % 3) {
+      EXPECT_EQ(a.insert(key), b.insert(key).second);
+    } else {
+      EXPECT_EQ(a.erase(key), b.erase(key));
+    }
+  }
+  EXPECT_EQ(a.size(), b.size());
+  for (int key = 0; key < 700; key++) {
+    EXPECT_EQ(a.contains(key), b.count(key) == 1);
+  }
+  a.clear();
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(RcuSet, UpdateAndSnapshot) {
+  s21::rcu_set<int> a{1, 2};
+  auto before = a.snapshot();
+  a.update([](s21::rcu_set<int>::tree_type& tree) {
+    tree.erase(1);
+    tree.insert(5);
+    tree.insert(7);
+  });
+  std::vector<int> old_keys;
+  for (int key : before) {
+    old_keys.push_back(key);
+  }
+  std::vector<int> new_keys;
+  for (int key : a.snapshot()) {
+    new_keys.push_back(key);
+  }
+  EXPECT_EQ(old_keys, (std::vector<int>{1, 2}));
+  EXPECT_EQ(new_keys, (std::vector<int>{2, 5, 7}));
+}
+
+TEST(RcuSet, ConcurrentReaders) {
+  // even keys are always present, odd keys come and go
+  s21::rcu_set<int> a;
+  a.update([](s21::rcu_set<int>::tree_type& tree) {
+    for (int key = 0; key < 512; key += 2) {
+      tree.insert(key);
+    }
+  });
+  std::atomic<bool> done{false};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 3; t++) {
+    readers.emplace_back([&a, &done, t] {
+      unsigned state = t + 1;
+      while (!done.load()) {
+        state = state * 1103515245U + 12345U;
+        int key = (state >> 8) % 256 * 2;
+        ASSERT_TRUE(a.contains(key));
+      }
+    });
+  }
+  for (int round = 0; round < 20; round++) {
+    for (int key = 1; key < 512; key += 2) {
+      a.insert(key);
+    }
+    for (int key = 1; key < 512; key += 2) {
+      a.erase(key);
+    }
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(a.size(), 256U);
+}
+
+TEST(ThreadPool, RunsEveryTask) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(pool.size(), 4U);
+  std::vector<int> results(1000, 0);
+  std::vector<s21::thread_pool::task_type> tasks;
+  for (int i = 0; i < 1000; i++) {
+    tasks.emplace_back([&results, i] { results[i] = i * 2; });
+  }
+  pool.run(tasks);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(results[i], i * 2);
+  }
+}
+
+TEST(ThreadPool, NestedRun) {
+  s21::thread_pool pool(2);
+  std::atomic<int> leaves(0);
+  std::vector<s21::thread_pool::task_type> outer;
+  for (int i = 0; i < 8; i++) {
+    outer.emplace_back([&pool, &leaves] {
+      std::vector<s21::thread_pool::task_type> inner;
+      for (int j = 0; j < 8; j++) {
+        inner.emplace_back([&leaves] { leaves++; });
+      }
+      pool.run(inner);
+    });
+  }
+  pool.run(outer);
+  EXPECT_EQ(leaves.load(), 64);
+}
+
+TEST(ThreadPool, RethrowsException) {
+  s21::thread_pool pool(2);
+  std::atomic<int> finished(0);
+  std::vector<s21::thread_pool::task_type> tasks;
+  for (int i = 0; i < 16; i++) {
+    tasks.emplace_back([&finished, i] {
+      if (i == 5) {
+        throw std::runtime_error("task failed");
+      }
+      finished++;
+    });
+  }
+  EXPECT_THROW(pool.run(tasks), std::runtime_error);
+  EXPECT_EQ(finished.load(), 15);
+  std::vector<s21::thread_pool::task_type> empty;
+  pool.run(empty);
+}
+
+static long fork_join_sum(s21::thread_pool& pool, long first, long last) {
+  if (last - first <= 1000) {
+    long sum = 0;
+    for (long i = first; i < last; i++) {
+      sum += i;
+    }
+    return sum;
+  }
+  long middle = first + (last - first) / 2;
+  long left = 0;
+  long right = 0;
+  pool.fork_join([&] { left = fork_join_sum(pool, first, middle); },
+                 [&] { right = fork_join_sum(pool, middle, last); });
+  return left + right;
+}
+
+TEST(ThreadPool, ForkJoin) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(fork_join_sum(pool, 0, 1000000), 999999L * 1000000 / 2);
+  std::vector<s21::thread_pool::task_type> tasks;
+  std::vector<long> sums(4);
+  for (int i = 0; i < 4; i++) {
+    tasks.emplace_back([&pool, &sums, i] { sums[i] = fork_join_sum(pool, 0, 100000 * (i + 1)); });
+  }
+  pool.run(tasks);
+  for (long i = 0; i < 4; i++) {
+    long n = 100000 * (i + 1);
+    EXPECT_EQ(sums[i], n * (n - 1) / 2);
+  }
+}
+
+TEST(ThreadPool, ForkJoinException) {
+  s21::thread_pool pool(2);
+  bool first_ran = false;
+  EXPECT_THROW(pool.fork_join([&first_ran] { first_ran = true; },
+                              [] { throw std::runtime_error("second failed"); }),
+               std::runtime_error);
+  EXPECT_TRUE(first_ran);
+  bool second_ran = false;
+  EXPECT_THROW(pool.fork_join([] { throw std::logic_error("first failed"); },
+                              [&second_ran] { second_ran = true; }),
+               std::logic_error);
+  EXPECT_TRUE(second_ran);
+}
+
+TEST(Parallel, SplitRanges) {
+  s21::set<int> a;
+  for (int i = 0; i < 1000; i++) {
+    a.insert(i);
+  }
+  auto ranges = a.split_ranges(16);
+  EXPECT_GE(ranges.size(), 16U);
+  EXPECT_EQ(ranges.front().first, a.begin());
+  EXPECT_EQ(ranges.back().second, a.end());
+  int expected = 0;
+  for (size_t i = 0; i < ranges.size(); i++) {
+    if (i > 0) {
+      EXPECT_EQ(ranges[i - 1].second, ranges[i].first);
+    }
+    for (auto it = ranges[i].first; it != ranges[i].second; ++it) {
+      EXPECT_EQ(*it, expected++);
+    }
+  }
+  EXPECT_EQ(expected, 1000);
+  s21::set<int> empty;
+  EXPECT_TRUE(empty.split_ranges(4).empty());
+}
+
+TEST(Parallel, ForEachMap) {
+  s21::thread_pool pool(4);
+  s21::map<int, int> a;
+  for (int i = 0; i < 10000; i++) {
+    a.insert(i, i);
+  }
+  s21::parallel_for_each(a, [](std::pair<const int, int>& value) { value.second *= 3; }, pool);
+  for (int i = 0; i < 10000; i++) {
+    EXPECT_EQ(a.at(i), i * 3);
+  }
+}
+
+TEST(Parallel, ReduceSet) {
+  s21::thread_pool pool(4);
+  s21::set<long> a;
+  long expected = 0;
+  for (long i = 0; i < 20000; i += 3) {
+    a.insert(i);
+    expected += i;
+  }
+  EXPECT_EQ(s21::parallel_reduce(a, 0L, [](long lhs, long rhs) { return lhs + rhs; }, pool),
+            expected);
+  s21::set<long> empty;
+  EXPECT_EQ(s21::parallel_reduce(empty, 7L, [](long lhs, long rhs) { return lhs + rhs; }, pool),
+            7L);
+}
+
+TEST(Parallel, ReduceKeepsOrder) {
+  s21::thread_pool pool(3);
+  s21::multiset<char> a;
+  std::multiset<char> b;
+  for (int i = 0; i < 3000; i++) {
+    char c = static_cast<char>('a' + (i * 7) % 26);
+    a.insert(c);
+    b.insert(c);
+  }
+  std::string concatenated = s21::parallel_reduce(
+      a, std::string(), [](std::string lhs, char rhs) { return lhs + rhs; },
+      [](std::string lhs, const std::string& rhs) { return lhs + rhs; }, pool);
+  EXPECT_EQ(concatenated, std::string(b.begin(), b.end()));
+}
+
+TEST(MergeAll, Sets) {
+  std::vector<s21::set<int>> parts(7);
+  std::set<int> expected;
+  unsigned state = 11;
+  for (int i = 0; i < 200000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 100000;
+    parts[i % parts.size()].insert(key);
+    expected.insert(key);
+  }
+  for (unsigned threads : {1U, 4U}) {
+    s21::set<int> merged = s21::merge_all(parts, threads);
+    EXPECT_EQ(merged.size(), expected.size());
+    auto it = merged.begin();
+    for (int key : expected) {
+      EXPECT_EQ(*it, key);
+      ++it;
+    }
+    EXPECT_EQ(it, merged.end());
+  }
+}
+
+TEST(MergeAll, Multisets) {
+  std::vector<s21::multiset<int>> parts(5);
+  std::multiset<int> expected;
+  unsigned state = 13;
+  for (int i = 0; i < 150000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 3000;
+    parts[(state >> 4) % parts.size()].insert(key);
+    expected.insert(key);
+  }
+  for (unsigned threads : {1U, 3U}) {
+    s21::multiset<int> merged = s21::merge_all(parts, threads);
+    EXPECT_EQ(merged.size(), expected.size());
+    EXPECT_EQ(merged.count(42), expected.count(42));
+    auto it = merged.begin();
+    for (int key : expected) {
+      EXPECT_EQ(*it, key);
+      ++it;
+    }
+    EXPECT_EQ(it, merged.end());
+  }
+}
+
+TEST(MergeAll, MultisetCounts) {
+  // a million copies per key: merged as runs, never copy by copy
+  std::vector<s21::multiset<int>> parts(3);
+  parts[0].insert(1, 1000000);
+  parts[0].insert(5, 2);
+  parts[1].insert(1, 3000000);
+  parts[2].insert(3, 1);
+  parts[2].insert(5, 7);
+  s21::multiset<int> merged = s21::merge_all(parts, 2);
+  EXPECT_EQ(merged.size(), 4000010U);
+  EXPECT_EQ(merged.unique_size(), 3U);
+  EXPECT_EQ(merged.count(1), 4000000U);
+  EXPECT_EQ(merged.count(3), 1U);
+  EXPECT_EQ(merged.count(5), 9U);
+  std::vector<std::pair<int, std::size_t>> counted{{2, 3}, {4, 1}};
+  auto b = s21::multiset<int>::from_sorted_counts(counted.begin(), counted.end());
+  EXPECT_EQ(b.size(), 4U);
+  EXPECT_EQ(b.count(2), 3U);
+  EXPECT_EQ(*b.key_lower_bound(3), 4);
+}
+
+TEST(MergeAll, EmptyInputs) {
+  std::vector<s21::set<int>> none;
+  EXPECT_TRUE(s21::merge_all(none).empty());
+  std::vector<s21::set<int>> parts(3);
+  parts[1].insert(5);
+  s21::set<int> merged = s21::merge_all(parts);
+  EXPECT_EQ(merged.size(), 1U);
+  EXPECT_EQ(*merged.begin(), 5);
+}
+
+TEST(MergeAll, CustomCompare) {
+  std::vector<s21::set<int, std::greater<int>>> parts(2);
+  parts[0].insert_many(1, 5, 9);
+  parts[1].insert_many(2, 5, 8);
+  auto merged = s21::merge_all(parts);
+  std::vector<int> expected{9, 8, 5, 2, 1};
+  auto it = merged.begin();
+  for (int key : expected) {
+    EXPECT_EQ(*it, key);
+    ++it;
+  }
+  EXPECT_EQ(it, merged.end());
+}
+
+TEST(MergeAll, FromSorted) {
+  std::vector<int> sorted{1, 1, 2, 3, 3, 3, 7};
+  s21::set<int> a = s21::set<int>::from_sorted(sorted.begin(), sorted.end());
+  EXPECT_EQ(a.size(), 4U);
+  s21::multiset<int> b = s21::multiset<int>::from_sorted(sorted.begin(), sorted.end());
+  EXPECT_EQ(b.size(), 7U);
+  EXPECT_EQ(b.count(3), 3U);
+  EXPECT_EQ(*a.lower_bound(4), 7);
+  EXPECT_EQ(*a.upper_bound(1), 2);
+}
+TEST(MergeAll, MemoryResource) {
+  std::pmr::monotonic_buffer_resource pool;
+  std::vector<s21::pmr::set<int>> sets;
+  std::vector<s21::pmr::multiset<int>> multisets;
+  // a reallocating vector would copy them, and copies use the default resource
+  sets.reserve(3);
+  multisets.reserve(3);
+  for (int i = 0; i < 3; i++) {
+    sets.emplace_back(&pool);
+    multisets.emplace_back(&pool);
+  }
+  for (int i = 0; i < 300; i++) {
+    sets[i % 3].insert(i % 100);
+    multisets[i % 3].insert(i % 100);
+  }
+  std::vector<int> sorted{1, 2, 2, 3};
+  std::vector<std::pair<int, std::size_t>> counted{{1, 2}, {4, 1}};
+  std::vector<std::pair<const int, int>> pairs{{1, 10}, {2, 20}};
+  // nothing below may fall back to the default resource
+  std::pmr::memory_resource *previous =
+      std::pmr::set_default_resource(std::pmr::null_memory_resource());
+  auto merged_sets = s21::merge_all(sets, 2);
+  auto merged_multisets = s21::merge_all(multisets, 2);
+  auto set = s21::pmr::set<int>::build_parallel(sorted.begin(), sorted.end(), 2, &pool);
+  auto sorted_set = s21::pmr::set<int>::from_sorted(sorted.begin(), sorted.end(), 2, &pool);
+  auto multiset = s21::pmr::multiset<int>::build_parallel(sorted.begin(), sorted.end(), 2, &pool);
+  auto counts =
+      s21::pmr::multiset<int>::from_sorted_counts(counted.begin(), counted.end(), 2, &pool);
+  auto map = s21::pmr::map<int, int>::build_parallel(pairs.begin(), pairs.end(), 2, &pool);
+  auto sorted_map = s21::pmr::map<int, int>::from_sorted(pairs.begin(), pairs.end(), 2, &pool);
+  std::pmr::set_default_resource(previous);
+  EXPECT_EQ(merged_sets.get_allocator().resource(), &pool);
+  EXPECT_EQ(merged_sets.size(), 100U);
+  EXPECT_EQ(merged_multisets.get_allocator().resource(), &pool);
+  EXPECT_EQ(merged_multisets.size(), 300U);
+  EXPECT_EQ(set.size(), 3U);
+  EXPECT_EQ(sorted_set.size(), 3U);
+  EXPECT_EQ(multiset.count(2), 2U);
+  EXPECT_EQ(counts.size(), 3U);
+  EXPECT_EQ(map.at(2), 20);
+  EXPECT_EQ(sorted_map.size(), 2U);
+  // an explicit allocator overrides the one of the inputs
+  auto elsewhere = s21::merge_all(sets, 1, std::pmr::get_default_resource());
+  EXPECT_EQ(elsewhere.get_allocator().resource(), std::pmr::get_default_resource());
+  EXPECT_EQ(elsewhere.size(), 100U);
+}
+
+TEST(BufferedMap, UpdateAndFlush) {
+  s21::buffered_map<int, long> a;
+  a.update(1, 5);
+  a.update(2, 1);
+  a.update(1, 10);
+  EXPECT_TRUE(a.empty());
+  EXPECT_FALSE(a.find(1).has_value());
+  a.flush();
+  EXPECT_EQ(a.size(), 2U);
+  EXPECT_EQ(*a.find(1), 15);
+  EXPECT_EQ(*a.find(2), 1);
+  EXPECT_FALSE(a.contains(3));
+  a.update(1, 1);
+  a.flush();
+  EXPECT_EQ(*a.find(1), 16);
+}
+
+TEST(BufferedMap, ThresholdPublishes) {
+  s21::buffered_map<int, int> a(4);
+  EXPECT_EQ(a.flush_threshold(), 4U);
+  for (int i = 0; i < 3; i++) {
+    a.update(i, 1);
+  }
+  EXPECT_TRUE(a.empty());
+  a.update(3, 1);
+  EXPECT_EQ(a.size(), 4U);
+}
+
+TEST(BufferedMap, CustomCombine) {
+  auto max = [](int lhs, int rhs) { return std::max(lhs, rhs); };
+  s21::buffered_map<int, int, decltype(max)> a(2, max);
+  for (int value : {3, -1, 8, 2}) {
+    a.update(7, value);
+    a.update(value, value);
+  }
+  auto snapshot = a.snapshot();
+  EXPECT_EQ(snapshot.at(7), 8);
+  EXPECT_EQ(snapshot.at(-1), -1);
+}
+
+TEST(BufferedMap, ConcurrentCounters) {
+  s21::buffered_map<int, long> a(64);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&a, t] {
+      for (int i = 0; i < 20000; i++) {
+        a.update(i % 500, 1);
+        a.update(1000 + t, 2);
+        if (i % 5000 == 0) {
+          a.flush();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  a.flush();
+  EXPECT_EQ(a.size(), 504U);
+  for (int key = 0; key < 500; key++) {
+    EXPECT_EQ(*a.find(key), 4 * 40);
+  }
+  for (int t = 0; t < 4; t++) {
+    EXPECT_EQ(*a.find(1000 + t), 40000);
+  }
+}
+
+template <typename T, typename Container>
+void queue_eq(s21::queue<T, Container> a, std::queue<T> b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  while (!b.empty()) {
+    EXPECT_EQ(a.front(), b.front());
+    EXPECT_EQ(a.back(), b.back());
+    a.pop();
+    b.pop();
+  }
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(Queue, DefaultConstructor) {
+  s21::queue<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_THROW(a.front(), std::out_of_range);
+  EXPECT_THROW(a.back(), std::out_of_range);
+  EXPECT_THROW(a.pop(), std::out_of_range);
+}
+
+TEST(Queue, InitializerListConstructor) {
+  s21::queue<int> a{1, 2, 3};
+  std::queue<int> b;
+  for (int value : {1, 2, 3}) {
+    b.push(value);
+  }
+  queue_eq(a, b);
+}
+
+TEST(Queue, CopyMove) {
+  s21::queue<std::string> a{"one", "two", "three"};
+  s21::queue<std::string> b(a);
+  EXPECT_EQ(b.size(), 3U);
+  EXPECT_EQ(b.front(), "one");
+  s21::queue<std::string> c(std::move(b));
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(c.back(), "three");
+  s21::queue<std::string> d;
+  d = c;
+  d.pop();
+  EXPECT_EQ(d.front(), "two");
+  EXPECT_EQ(c.front(), "one");
+  s21::queue<std::string> e{"x"};
+  e = std::move(d);
+  EXPECT_EQ(e.size(), 2U);
+}
+
+TEST(Queue, PushPopWrapsAround) {
+  s21::queue<int> a;
+  std::queue<int> b;
+  int next = 0;
+  for (int round = 0; round < 100; round++) {
+    for (int i = 0; i < 7; i++) {
+      a.push(next);
+      b.push(next++);
+    }
+    for (int i = 0; i < 5; i++) {
+      EXPECT_EQ(a.front(), b.front());
+      a.pop();
+      b.pop();
+    }
+  }
+  queue_eq(a, b);
+}
+
+TEST(Queue, Reserve) {
+  s21::queue<int> a;
+  a.reserve(100);
+  size_t capacity = a.capacity();
+  EXPECT_GE(capacity, 100U);
+  for (int i = 0; i < 100; i++) {
+    a.push(i);
+  }
+  EXPECT_EQ(a.capacity(), capacity);
+  EXPECT_EQ(a.back(), 99);
+  a.front() = -1;
+  EXPECT_EQ(a.front(), -1);
+}
+
+TEST(Queue, Swap) {
+  s21::queue<int> a{1, 2};
+  s21::queue<int> b{3};
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1U);
+  EXPECT_EQ(a.front(), 3);
+  EXPECT_EQ(b.back(), 2);
+}
+
+TEST(Queue, InsertManyBack) {
+  s21::queue<int> a{1};
+  a.insert_many_back(2, 3, 4);
+  std::queue<int> b;
+  for (int value : {1, 2, 3, 4}) {
+    b.push(value);
+  }
+  queue_eq(a, b);
+}
+
+TEST(Queue, StableReferences) {
+  s21::queue<int> a;
+  std::vector<const int*> addresses;
+  for (int i = 0; i < 50000; i++) {
+    a.push(i);
+    addresses.push_back(&a.back());
+    if (i % 2 == 0) {
+      a.pop();
+    }
+  }
+  for (std::size_t i = addresses.size() - a.size(); i < addresses.size(); i++) {
+    EXPECT_EQ(&a.front(), addresses[i]);
+    a.pop();
+  }
+}
+
+TEST(Queue, OtherContainers) {
+  s21::queue<std::string, s21::list<std::string>> a{"one", "two"};
+  a.reserve(100);
+  a.push("three");
+  EXPECT_EQ(a.capacity(), 3U);
+  std::queue<std::string> b;
+  for (const char* value : {"one", "two", "three"}) {
+    b.push(value);
+  }
+  queue_eq(a, b);
+}
+TEST(Queue, RingDeque) {
+  s21::queue<std::string, s21::ring_deque<std::string>> a{"one", "two"};
+  a.reserve(100);
+  EXPECT_EQ(a.capacity(), 128U);
+  std::queue<std::string> b;
+  b.push("one");
+  b.push("two");
+  // head and tail wrap around the ring many times without growing it
+  for (int i = 0; i < 1000; ++i) {
+    a.push(std::to_string(i));
+    b.push(std::to_string(i));
+    a.pop();
+    b.pop();
+  }
+  EXPECT_EQ(a.capacity(), 128U);
+  queue_eq(a, b);
+  // a growing push may take its value from the ring itself
+  s21::ring_deque<std::string> c;
+  c.push_back("first");
+  while (c.size() < c.capacity()) {
+    c.push_back("filler");
+  }
+  c.emplace_back(c.front());
+  EXPECT_EQ(c.back(), "first");
+  EXPECT_EQ(c.capacity(), 2 * s21::ring_deque<std::string>::kMinCapacity);
+}
+
+TEST(SpscQueue, PushPop) {
+  s21::spsc_queue<int, 4> a;
+  EXPECT_EQ(a.capacity(), 4U);
+  EXPECT_TRUE(a.empty());
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(a.try_push(i));
+  }
+  EXPECT_FALSE(a.try_push(4));
+  EXPECT_EQ(a.size(), 4U);
+  int value = -1;
+  EXPECT_TRUE(a.try_pop(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(a.try_push(4));
+  for (int i = 1; i <= 4; i++) {
+    EXPECT_TRUE(a.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(a.try_pop(value));
+}
+
+TEST(SpscQueue, Batches) {
+  s21::spsc_queue<int, 8> a;
+  std::vector<int> input{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto rest = a.push_batch(input.begin(), input.end());
+  EXPECT_EQ(rest - input.begin(), 8);
+  std::vector<int> output(5);
+  EXPECT_EQ(a.pop_batch(output.begin(), 5), 5U);
+  EXPECT_EQ(output, std::vector<int>({0, 1, 2, 3, 4}));
+  rest = a.push_batch(rest, input.end());
+  EXPECT_EQ(rest, input.end());
+  std::vector<int> tail;
+  EXPECT_EQ(a.pop_batch(std::back_inserter(tail), 100), 5U);
+  EXPECT_EQ(tail, std::vector<int>({5, 6, 7, 8, 9}));
+}
+
+TEST(SpscQueue, DestroysRemaining) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::spsc_queue<std::shared_ptr<int>, 4> a;
+    a.try_push(counter);
+    a.try_emplace(counter);
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(SpscQueue, ProducerConsumer) {
+  s21::spsc_queue<long, 64> a;
+  const long count = 200000;
+  std::thread producer([&a, count] {
+    for (long i = 0; i < count;) {
+      if (a.try_push(i)) {
+        i++;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  long expected = 0;
+  std::vector<long> batch(16);
+  while (expected < count) {
+    size_t popped = a.pop_batch(batch.begin(), batch.size());
+    if (popped == 0) {
+      std::this_thread::yield();
+    }
+    for (size_t i = 0; i < popped; i++) {
+      EXPECT_EQ(batch[i], expected++);
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(MpmcQueue, TryPushPop) {
+  s21::mpmc_queue<std::string> a(3);
+  EXPECT_EQ(a.capacity(), 4U);
+  EXPECT_TRUE(a.empty());
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(a.try_push(std::to_string(i)));
+  }
+  EXPECT_FALSE(a.try_push("full"));
+  EXPECT_EQ(a.size(), 4U);
+  std::string value;
+  for (int lap = 0; lap < 10; lap++) {
+    EXPECT_TRUE(a.try_pop(value));
+    EXPECT_EQ(value, std::to_string(lap));
+    EXPECT_TRUE(a.try_emplace(std::to_string(lap + 4)));
+  }
+  for (int i = 10; i < 14; i++) {
+    EXPECT_EQ(a.pop(), std::to_string(i));
+  }
+  EXPECT_FALSE(a.try_pop(value));
+}
+
+TEST(MpmcQueue, DestroysRemaining) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::mpmc_queue<std::shared_ptr<int>> a(8);
+    a.push(counter);
+    a.push(counter);
+    std::shared_ptr<int> out;
+    a.pop(out);
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(MpmcQueue, ManyProducersConsumers) {
+  s21::mpmc_queue<long> a(64);
+  const int producers = 3;
+  const int consumers = 3;
+  const long per_producer = 30000;
+  std::atomic<long> sum(0);
+  std::atomic<long> received(0);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([&a, p, per_producer] {
+      for (long i = 0; i < per_producer; i++) {
+        a.push(p * per_producer + i);
+      }
+    });
+  }
+  for (int c = 0; c < consumers; c++) {
+    threads.emplace_back([&a, &sum, &received, per_producer] {
+      while (received.load() < producers * per_producer) {
+        long value;
+        if (a.try_pop(value)) {
+          sum += value;
+          received++;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  long total = producers * per_producer;
+  EXPECT_EQ(received.load(), total);
+  EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(WsDeque, OwnerIsLifo) {
+  s21::ws_deque<int> a;
+  EXPECT_TRUE(a.empty());
+  for (int i = 0; i < 200; i++) {
+    a.push(i);
+  }
+  EXPECT_EQ(a.size(), 200U);
+  int value = -1;
+  for (int i = 199; i >= 0; i--) {
+    EXPECT_TRUE(a.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(a.pop(value));
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(WsDeque, ThiefIsFifo) {
+  s21::ws_deque<int> a;
+  for (int i = 0; i < 100; i++) {
+    a.push(i);
+  }
+  int value = -1;
+  EXPECT_TRUE(a.steal(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(a.pop(value));
+  EXPECT_EQ(value, 99);
+  EXPECT_TRUE(a.steal(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_EQ(a.size(), 97U);
+}
+
+TEST(WsDeque, ConcurrentSteal) {
+  s21::ws_deque<long> a;
+  const long count = 100000;
+  std::atomic<bool> finished(false);
+  std::atomic<long> stolen_sum(0);
+  std::atomic<long> stolen(0);
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < 3; t++) {
+    thieves.emplace_back([&] {
+      long value;
+      while (!finished.load()) {
+        if (a.steal(value)) {
+          stolen_sum += value;
+          stolen++;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  long owned_sum = 0;
+  long owned = 0;
+  long value;
+  for (long i = 0; i < count; i++) {
+    a.push(i);
+    if (i % 3 == 0 && a.pop(value)) {
+      owned_sum += value;
+      owned++;
+    }
+  }
+  while (a.pop(value)) {
+    owned_sum += value;
+    owned++;
+  }
+  while (owned + stolen.load() < count) {
+    std::this_thread::yield();
+  }
+  finished = true;
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+  EXPECT_EQ(owned + stolen.load(), count);
+  EXPECT_EQ(owned_sum + stolen_sum.load(), count * (count - 1) / 2);
+}
+
+template <typename T, typename Growth>
+void vector_eq(const s21::vector<T, Growth>& a, const std::vector<T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  ASSERT_EQ(a.size(), b.size());
+  for (std::size_t i = 0; i < b.size(); i++) {
+    EXPECT_EQ(a[i], b[i]);
+  }
+}
+
+// moves are counted, but the vector may relocate it with memcpy
+struct relocatable {
+  static int moves;
+
+  relocatable(int v = 0) : value(v) {}
+  relocatable(relocatable&& other) noexcept : value(other.value) { moves++; }
+  relocatable& operator=(relocatable&& other) noexcept {
+    value = other.value;
+    return *this;
+  }
+  ~relocatable() {}
+
+  int value;
+};
+
+int relocatable::moves = 0;
+
+namespace s21 {
+template <>
+struct is_trivially_relocatable<relocatable> : std::true_type {};
+}  // namespace s21
+
+struct alignas(64) over_aligned {
+  int value;
+};
+
+TEST(Vector, DefaultConstructor) {
+  s21::vector<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.capacity(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_THROW(a.at(0), std::out_of_range);
+}
+
+TEST(Vector, Constructors) {
+  s21::vector<int> a(5);
+  vector_eq(a, std::vector<int>(5));
+  s21::vector<std::string> b{"one", "two", "three"};
+  vector_eq(b, {"one", "two", "three"});
+  s21::vector<std::string> c(b);
+  vector_eq(c, {"one", "two", "three"});
+  s21::vector<std::string> d(std::move(c));
+  vector_eq(d, {"one", "two", "three"});
+  EXPECT_TRUE(c.empty());
+  c = d;
+  vector_eq(c, {"one", "two", "three"});
+  c = s21::vector<std::string>{"four"};
+  vector_eq(c, {"four"});
+}
+
+TEST(Vector, ElementAccess) {
+  s21::vector<int> a{1, 2, 3};
+  EXPECT_EQ(a.at(1), 2);
+  EXPECT_THROW(a.at(3), std::out_of_range);
+  EXPECT_EQ(a.front(), 1);
+  EXPECT_EQ(a.back(), 3);
+  EXPECT_EQ(a.data(), &a[0]);
+  a[1] = 5;
+  const s21::vector<int>& b = a;
+  EXPECT_EQ(b.at(1), 5);
+  int sum = 0;
+  for (int value : b) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 9);
+}
+
+TEST(Vector, PushPop) {
+  s21::vector<std::string> a;
+  std::vector<std::string> b;
+  for (int i = 0; i < 1000; i++) {
+    a.push_back(std::to_string(i));
+    b.push_back(std::to_string(i));
+  }
+  vector_eq(a, b);
+  for (int i = 0; i < 500; i++) {
+    a.pop_back();
+    b.pop_back();
+  }
+  vector_eq(a, b);
+  EXPECT_EQ(a.emplace_back(3, 'x'), "xxx");
+  b.emplace_back(3, 'x');
+  vector_eq(a, b);
+}
+
+TEST(Vector, PushBackOwnElement) {
+  s21::vector<std::string> a{"first"};
+  a.shrink_to_fit();
+  for (int i = 0; i < 100; i++) {
+    a.push_back(a[0]);
+  }
+  for (const std::string& value : a) {
+    EXPECT_EQ(value, "first");
+  }
+}
+
+TEST(Vector, Capacity) {
+  s21::vector<int> a;
+  a.reserve(100);
+  EXPECT_EQ(a.capacity(), 100U);
+  int* data = a.data();
+  for (int i = 0; i < 100; i++) {
+    a.unchecked_push_back(i);
+  }
+  EXPECT_EQ(a.data(), data);
+  EXPECT_EQ(a.size(), 100U);
+  a.resize(10);
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 10U);
+  EXPECT_EQ(a[9], 9);
+  a.clear();
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 0U);
+  EXPECT_GT(a.max_size(), 0U);
+}
+
+TEST(Vector, GrowthFactor) {
+  s21::vector<int> a;
+  s21::vector<int, std::ratio<3, 2>> b;
+  std::vector<std::size_t> a_capacities;
+  std::vector<std::size_t> b_capacities;
+  for (int i = 0; i < 40; i++) {
+    a.push_back(i);
+    b.push_back(i);
+    if (a_capacities.empty() || a_capacities.back() != a.capacity()) {
+      a_capacities.push_back(a.capacity());
+    }
+    if (b_capacities.empty() || b_capacities.back() != b.capacity()) {
+      b_capacities.push_back(b.capacity());
+    }
+  }
+  EXPECT_EQ(a_capacities, std::vector<std::size_t>({4, 8, 16, 32, 64}));
+  EXPECT_EQ(b_capacities, std::vector<std::size_t>({4, 6, 9, 13, 19, 28, 42}));
+}
+
+TEST(Vector, TriviallyRelocatable) {
+  relocatable::moves = 0;
+  s21::vector<relocatable> a;
+  int growths = 0;
+  for (int i = 0; i < 1000; i++) {
+    growths += a.size() == a.capacity();
+    a.emplace_back(i);
+  }
+  // only the element being added when the vector grows is moved
+  EXPECT_EQ(relocatable::moves, growths);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(a[i].value, i);
+  }
+  s21::vector<over_aligned> b;
+  for (int i = 0; i < 1000; i++) {
+    b.push_back(over_aligned{i});
+  }
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b.data()) % 64, 0U);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(b[i].value, i);
+  }
+  s21::vector<std::unique_ptr<int>> c;
+  for (int i = 0; i < 100; i++) {
+    c.push_back(std::make_unique<int>(i));
+  }
+  EXPECT_EQ(*c[99], 99);
+}
+
+TEST(Vector, InsertErase) {
+  s21::vector<int> a{1, 2, 3};
+  EXPECT_EQ(*a.insert(a.begin() + 1, 5), 5);
+  vector_eq(a, {1, 5, 2, 3});
+  a.insert(a.end(), 7);
+  vector_eq(a, {1, 5, 2, 3, 7});
+  a.erase(a.begin());
+  vector_eq(a, {5, 2, 3, 7});
+  a.erase(a.end() - 1);
+  vector_eq(a, {5, 2, 3});
+}
+
+TEST(Vector, InsertMany) {
+  s21::vector<int> a{1, 2, 3};
+  EXPECT_EQ(*a.insert_many(a.begin() + 1, 7, 8, 9), 7);
+  vector_eq(a, {1, 7, 8, 9, 2, 3});
+  a.insert_many_back(4, 5);
+  vector_eq(a, {1, 7, 8, 9, 2, 3, 4, 5});
+  a.insert_many(a.begin());
+  vector_eq(a, {1, 7, 8, 9, 2, 3, 4, 5});
+}
+
+TEST(Vector, Swap) {
+  s21::vector<int> a{1, 2};
+  s21::vector<int> b{3};
+  a.swap(b);
+  vector_eq(a, {3});
+  vector_eq(b, {1, 2});
+}
+
+template <typename T, std::size_t N>
+void small_vector_eq(const s21::small_vector<T, N>& a, const std::vector<T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  ASSERT_EQ(a.size(), b.size());
+  for (std::size_t i = 0; i < b.size(); i++) {
+    EXPECT_EQ(a[i], b[i]);
+  }
+}
+
+TEST(SmallVector, DefaultConstructor) {
+  s21::small_vector<int, 4> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_TRUE(a.is_inline());
+  EXPECT_EQ(a.capacity(), 4U);
+  EXPECT_THROW(a.at(0), std::out_of_range);
+  s21::small_vector<int, 0> b;
+  EXPECT_EQ(b.capacity(), 0U);
+  b.push_back(1);
+  EXPECT_FALSE(b.is_inline());
+  EXPECT_EQ(b[0], 1);
+}
+
+TEST(SmallVector, SpillsToHeap) {
+  s21::small_vector<std::string, 3> a;
+  std::vector<std::string> b;
+  for (int i = 0; i < 3; i++) {
+    a.push_back(std::to_string(i));
+    b.push_back(std::to_string(i));
+  }
+  EXPECT_TRUE(a.is_inline());
+  small_vector_eq(a, b);
+  for (int i = 3; i < 100; i++) {
+    a.push_back(std::to_string(i));
+    b.push_back(std::to_string(i));
+  }
+  EXPECT_FALSE(a.is_inline());
+  small_vector_eq(a, b);
+  a.resize(2);
+  b.resize(2);
+  a.shrink_to_fit();
+  EXPECT_TRUE(a.is_inline());
+  small_vector_eq(a, b);
+}
+
+TEST(SmallVector, CopyMove) {
+  s21::small_vector<std::string, 2> inside{"one", "two"};
+  s21::small_vector<std::string, 2> outside{"one", "two", "three"};
+  EXPECT_TRUE(inside.is_inline());
+  EXPECT_FALSE(outside.is_inline());
+  s21::small_vector<std::string, 2> a(inside);
+  small_vector_eq(a, {"one", "two"});
+  s21::small_vector<std::string, 2> b(std::move(outside));
+  small_vector_eq(b, {"one", "two", "three"});
+  EXPECT_TRUE(outside.empty());
+  EXPECT_TRUE(outside.is_inline());
+  s21::small_vector<std::string, 2> c(std::move(inside));
+  small_vector_eq(c, {"one", "two"});
+  c = b;
+  small_vector_eq(c, {"one", "two", "three"});
+  b = std::move(a);
+  small_vector_eq(b, {"one", "two"});
+  b.swap(c);
+  small_vector_eq(b, {"one", "two", "three"});
+  small_vector_eq(c, {"one", "two"});
+}
+
+TEST(SmallVector, Modifiers) {
+  s21::small_vector<int, 4> a{1, 2, 3};
+  a.push_back(a[0]);
+  a.push_back(a[1]);
+  small_vector_eq(a, {1, 2, 3, 1, 2});
+  EXPECT_EQ(*a.insert(a.begin(), 0), 0);
+  a.erase(a.end() - 1);
+  small_vector_eq(a, {0, 1, 2, 3, 1});
+  EXPECT_EQ(*a.insert_many(a.begin() + 1, 7, 8), 7);
+  small_vector_eq(a, {0, 7, 8, 1, 2, 3, 1});
+  a.insert_many_back(9);
+  EXPECT_EQ(a.back(), 9);
+  EXPECT_EQ(a.emplace_back(10), 10);
+  a.pop_back();
+  a.clear();
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(SmallVector, InsertManyResult) {
+  s21::set<int> a{2};
+  auto result = a.insert_many(1, 2, 3);
+  EXPECT_TRUE(result.is_inline());
+  EXPECT_EQ(result.capacity(), 3U);
+  ASSERT_EQ(result.size(), 3U);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_EQ(*result[2].first, 3);
+}
+
+template <typename T>
+void list_eq(const s21::list<T>& a, const std::list<T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  ASSERT_EQ(a.size(), b.size());
+  auto it = a.begin();
+  for (const T& value : b) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_EQ(it, a.end());
+  if (!b.empty()) {
+    EXPECT_EQ(a.front(), b.front());
+    EXPECT_EQ(a.back(), b.back());
+  }
+}
+
+TEST(List, DefaultConstructor) {
+  s21::list<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_THROW(a.front(), std::out_of_range);
+  EXPECT_THROW(a.back(), std::out_of_range);
+  EXPECT_THROW(a.pop_back(), std::out_of_range);
+  EXPECT_THROW(a.pop_front(), std::out_of_range);
+}
+
+TEST(List, Constructors) {
+  s21::list<int> a(3);
+  list_eq(a, std::list<int>(3));
+  s21::list<std::string> b{"one", "two", "three"};
+  list_eq(b, {"one", "two", "three"});
+  s21::list<std::string> c(b);
+  list_eq(c, {"one", "two", "three"});
+  EXPECT_NE(c.pool(), b.pool());
+  s21::list<std::string> d(std::move(c));
+  list_eq(d, {"one", "two", "three"});
+  EXPECT_TRUE(c.empty());
+  c.push_back("four");
+  list_eq(c, {"four"});
+  c = d;
+  list_eq(c, {"one", "two", "three"});
+  d = s21::list<std::string>{"five"};
+  list_eq(d, {"five"});
+}
+
+TEST(List, PushPop) {
+  s21::list<int> a;
+  std::list<int> b;
+  for (int i = 0; i < 100; i++) {
+    a.push_back(i);
+    b.push_back(i);
+    a.push_front(-i);
+    b.push_front(-i);
+  }
+  list_eq(a, b);
+  for (int i = 0; i < 30; i++) {
+    a.pop_back();
+    b.pop_back();
+    a.pop_front();
+    b.pop_front();
+  }
+  list_eq(a, b);
+  EXPECT_EQ(a.emplace_back(7), 7);
+  EXPECT_EQ(a.emplace_front(8), 8);
+}
+
+TEST(List, InsertErase) {
+  s21::list<int> a{1, 2, 3};
+  auto it = a.begin();
+  ++it;
+  EXPECT_EQ(*a.insert(it, 5), 5);
+  list_eq(a, {1, 5, 2, 3});
+  it = a.erase(it);
+  EXPECT_EQ(*it, 3);
+  list_eq(a, {1, 5, 3});
+  a.erase(a.begin());
+  list_eq(a, {5, 3});
+  a.clear();
+  list_eq(a, {});
+  a.push_back(1);
+  list_eq(a, {1});
+}
+
+TEST(List, PoolReusesNodes) {
+  s21::list<int> a;
+  for (int i = 0; i < 100; i++) {
+    a.push_back(i);
+  }
+  std::size_t capacity = a.pool()->capacity();
+  for (int round = 0; round < 10; round++) {
+    a.clear();
+    for (int i = 0; i < 100; i++) {
+      a.push_back(i);
+    }
+  }
+  EXPECT_EQ(a.pool()->capacity(), capacity);
+}
+
+TEST(List, SpliceSharedPool) {
+  auto pool = s21::list<int>::make_pool();
+  s21::list<int> a(pool);
+  s21::list<int> b(pool);
+  a.insert_many_back(1, 2, 3);
+  b.insert_many_back(4, 5);
+  auto kept = b.begin();
+  a.splice(a.begin(), b);
+  list_eq(a, {4, 5, 1, 2, 3});
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(*kept, 4);
+  auto last = a.end();
+  --last;
+  b.splice(b.end(), a, last);
+  list_eq(a, {4, 5, 1, 2});
+  list_eq(b, {3});
+  // LRU: move an element to the front of its own list
+  auto two = a.end();
+  --two;
+  a.splice(a.begin(), a, two);
+  list_eq(a, {2, 4, 5, 1});
+  a.splice(a.begin(), a, a.begin());
+  list_eq(a, {2, 4, 5, 1});
+}
+
+TEST(List, SpliceOtherPool) {
+  s21::list<std::string> a{"a", "b"};
+  s21::list<std::string> b{"c", "d"};
+  auto pos = a.begin();
+  ++pos;
+  a.splice(pos, b);
+  list_eq(a, {"a", "c", "d", "b"});
+  EXPECT_TRUE(b.empty());
+  b.splice(b.begin(), a, a.begin());
+  list_eq(a, {"c", "d", "b"});
+  list_eq(b, {"a"});
+}
+
+TEST(List, Merge) {
+  s21::list<int> a{1, 3, 5, 7};
+  s21::list<int> b{0, 2, 3, 8, 9};
+  a.merge(b);
+  list_eq(a, {0, 1, 2, 3, 3, 5, 7, 8, 9});
+  EXPECT_TRUE(b.empty());
+  auto pool = s21::list<int>::make_pool();
+  s21::list<int> c(pool);
+  s21::list<int> d(pool);
+  d.insert_many_back(5, 1);
+  c.merge(d, [](int lhs, int rhs) { return lhs > rhs; });
+  list_eq(c, {5, 1});
+  c.merge(c);
+  list_eq(c, {5, 1});
+}
+
+TEST(List, SortReverseUnique) {
+  s21::list<int> a;
+  std::list<int> b;
+  for (int i = 0; i < 1000; i++) {
+    int value = (i * 7919) % 101;
+    a.push_back(value);
+    b.push_back(value);
+  }
+  std::size_t capacity = a.pool()->capacity();
+  a.sort();
+  b.sort();
+  list_eq(a, b);
+  EXPECT_EQ(a.pool()->capacity(), capacity);
+  a.reverse();
+  b.reverse();
+  list_eq(a, b);
+  a.unique();
+  b.unique();
+  list_eq(a, b);
+  EXPECT_EQ(a.size(), 101U);
+}
+
+TEST(List, SortIsStable) {
+  s21::list<std::pair<int, int>> a;
+  for (int i = 0; i < 100; i++) {
+    a.push_back({i % 3, i});
+  }
+  a.sort([](const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) {
+    return lhs.first < rhs.first;
+  });
+  auto prev = *a.begin();
+  for (auto it = ++a.begin(); it != a.end(); ++it) {
+    EXPECT_TRUE(prev.first < it->first || (prev.first == it->first && prev.second < it->second));
+    prev = *it;
+  }
+}
+
+TEST(List, InsertMany) {
+  s21::list<int> a{1, 5};
+  auto it = a.begin();
+  ++it;
+  EXPECT_EQ(*a.insert_many(it, 2, 3, 4), 4);
+  list_eq(a, {1, 2, 3, 4, 5});
+  a.insert_many_back(6, 7);
+  a.insert_many_front(-1, 0);
+  list_eq(a, {-1, 0, 1, 2, 3, 4, 5, 6, 7});
+}
+
+TEST(List, Swap) {
+  s21::list<int> a{1, 2};
+  s21::list<int> b{3};
+  auto pool = a.pool();
+  a.swap(b);
+  list_eq(a, {3});
+  list_eq(b, {1, 2});
+  EXPECT_EQ(b.pool(), pool);
+}
+
+template <typename T, std::size_t N>
+void array_eq(const s21::array<T, N>& a, const std::array<T, N>& b) {
+  EXPECT_EQ(a.size(), b.size());
+  EXPECT_EQ(a.empty(), b.empty());
+  for (std::size_t i = 0; i < N; i++) {
+    EXPECT_EQ(a[i], b[i]);
+  }
+}
+
+constexpr s21::array<int, 16> squares() {
+  s21::array<int, 16> table;
+  for (std::size_t i = 0; i < table.size(); i++) {
+    table[i] = static_cast<int>(i * i);
+  }
+  return table;
+}
+
+TEST(Array, Constexpr) {
+  constexpr s21::array<int, 16> table = squares();
+  static_assert(table[3] == 9, "built at compile time");
+  static_assert(table.at(15) == 225, "at() in constant expressions");
+  static_assert(table.find(49) == table.begin() + 7, "find() in constant expressions");
+  static_assert(!table.contains(50), "contains() in constant expressions");
+  static_assert(table == squares(), "== in constant expressions");
+  constexpr s21::array<char, 4> filled = [] {
+    s21::array<char, 4> a;
+    a.fill('x');
+    return a;
+  }();
+  static_assert(filled.back() == 'x', "fill() in constant expressions");
+  constexpr s21::array<int, 3> listed{1, 2};
+  static_assert(listed[1] == 2 && listed[2] == 0, "the rest is value-initialized");
+  EXPECT_EQ(table[4], 16);
+}
+
+TEST(Array, Constructors) {
+  s21::array<int, 3> a;
+  array_eq(a, {0, 0, 0});
+  s21::array<std::string, 3> b{"one", "two"};
+  array_eq(b, {"one", "two", ""});
+  s21::array<std::string, 3> c(b);
+  array_eq(c, {"one", "two", ""});
+  s21::array<std::string, 3> d(std::move(c));
+  array_eq(d, {"one", "two", ""});
+  c = d;
+  array_eq(c, {"one", "two", ""});
+  EXPECT_THROW((s21::array<int, 2>{1, 2, 3}), std::out_of_range);
+  s21::array<int, 0> e;
+  EXPECT_TRUE(e.empty());
+  EXPECT_EQ(e.begin(), e.end());
+}
+
+TEST(Array, ElementAccess) {
+  s21::array<int, 3> a{1, 2, 3};
+  EXPECT_EQ(a.at(1), 2);
+  EXPECT_THROW(a.at(3), std::out_of_range);
+  EXPECT_EQ(a.front(), 1);
+  EXPECT_EQ(a.back(), 3);
+  EXPECT_EQ(a.data(), &a[0]);
+  int sum = 0;
+  for (int value : a) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 6);
+  s21::array<int, 3> b{4, 5, 6};
+  a.swap(b);
+  array_eq(a, {4, 5, 6});
+  array_eq(b, {1, 2, 3});
+}
+
+// every size and offset, so both the SIMD blocks and the tails are hit
+template <typename T>
+void check_kernels() {
+  s21::array<T, 37> a;
+  a.fill(T(3));
+  for (T value : a) {
+    EXPECT_EQ(value, T(3));
+  }
+  s21::array<T, 37> b(a);
+  EXPECT_TRUE(a == b);
+  for (std::size_t i = 0; i < a.size(); i++) {
+    EXPECT_EQ(a.find(T(5)), a.end());
+    a[i] = T(5);
+    EXPECT_EQ(a.find(T(5)), a.begin() + i);
+    EXPECT_TRUE(a != b);
+    a[i] = T(3);
+    EXPECT_TRUE(a == b);
+  }
+}
+
+TEST(Array, Kernels) {
+  check_kernels<std::int8_t>();
+  check_kernels<std::uint16_t>();
+  check_kernels<int>();
+  check_kernels<std::int64_t>();
+  check_kernels<float>();
+  check_kernels<double>();
+  s21::array<std::int64_t, 4> halves{0x100000000LL, 1};
+  EXPECT_EQ(halves.find(0x100000001LL), halves.end());
+  EXPECT_EQ(halves.find(1), halves.begin() + 1);
+}
+
+TEST(Array, FloatingPointValues) {
+  s21::array<double, 5> a{0.0, 1.0, NAN, 2.0, 3.0};
+  s21::array<double, 5> b{-0.0, 1.0, 2.0, 2.0, 3.0};
+  EXPECT_EQ(a.find(-0.0), a.begin());
+  EXPECT_EQ(a.find(NAN), a.end());
+  EXPECT_FALSE(a == a);
+  b[2] = 0.0;
+  a[2] = -0.0;
+  EXPECT_TRUE(a == b);
+  s21::array<float, 9> c;
+  c.fill(-0.0f);
+  EXPECT_TRUE(std::signbit(c[8]));
+  EXPECT_EQ(c.find(0.0f), c.begin());
+}
+
+template <typename T, typename Container>
+void stack_eq(s21::stack<T, Container> a, std::stack<T> b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  while (!b.empty()) {
+    EXPECT_EQ(a.top(), b.top());
+    a.pop();
+    b.pop();
+  }
+  EXPECT_TRUE(a.empty());
+}
+
+template <typename T>
+std::stack<T> std_stack(std::initializer_list<T> items) {
+  std::stack<T> result;
+  for (const T& value : items) {
+    result.push(value);
+  }
+  return result;
+}
+
+TEST(Stack, DefaultConstructor) {
+  s21::stack<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_THROW(a.top(), std::out_of_range);
+  EXPECT_THROW(a.pop(), std::out_of_range);
+}
+
+TEST(Stack, Constructors) {
+  s21::stack<std::string> a{"one", "two", "three"};
+  stack_eq(a, std_stack<std::string>({"one", "two", "three"}));
+  s21::stack<std::string> b(a);
+  stack_eq(b, std_stack<std::string>({"one", "two", "three"}));
+  s21::stack<std::string> c(std::move(b));
+  stack_eq(c, std_stack<std::string>({"one", "two", "three"}));
+  EXPECT_TRUE(b.empty());
+  b = c;
+  stack_eq(b, std_stack<std::string>({"one", "two", "three"}));
+  c = s21::stack<std::string>{"four"};
+  stack_eq(c, std_stack<std::string>({"four"}));
+}
+
+TEST(Stack, PushPop) {
+  s21::stack<std::string> a;
+  std::stack<std::string> b;
+  for (int i = 0; i < 10000; i++) {
+    a.push(std::to_string(i));
+    b.push(std::to_string(i));
+    if (i % 3 == 0) {
+      a.pop();
+      b.pop();
+    }
+  }
+  stack_eq(a, b);
+  EXPECT_EQ(a.emplace(2, 'x'), "xx");
+  a.top() = "top";
+  EXPECT_EQ(a.top(), "top");
+}
+
+TEST(Stack, StableReferences) {
+  s21::stack<int> a;
+  a.push(-1);
+  const int& bottom = a.top();
+  std::vector<const int*> addresses;
+  for (int i = 0; i < 100000; i++) {
+    a.push(i);
+    addresses.push_back(&a.top());
+  }
+  EXPECT_EQ(bottom, -1);
+  for (int i = 99999; i >= 0; i--) {
+    EXPECT_EQ(&a.top(), addresses[i]);
+    a.pop();
+  }
+  EXPECT_EQ(&a.top(), &bottom);
+}
+
+TEST(Stack, Storage) {
+  s21::chunked_storage<int> a;
+  a.reserve(10000);
+  std::size_t capacity = a.capacity();
+  EXPECT_GE(capacity, 10000U);
+  for (int i = 0; i < 10000; i++) {
+    a.push_back(i);
+  }
+  EXPECT_EQ(a.capacity(), capacity);
+  // pushing and popping across a chunk boundary reuses the chunk
+  for (int i = 0; i < 10000; i++) {
+    a.pop_back();
+  }
+  EXPECT_TRUE(a.empty());
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 20000; i++) {
+      a.push_back(i);
+    }
+    capacity = a.capacity();
+    for (int i = 0; i < 20000; i++) {
+      a.pop_back();
+    }
+    EXPECT_EQ(a.capacity(), capacity);
+  }
+  a.push_back(1);
+  a.shrink_to_fit();
+  EXPECT_LT(a.capacity(), capacity);
+  EXPECT_EQ(a.back(), 1);
+  a.clear();
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 0U);
+  a.push_back(2);
+  EXPECT_EQ(a.back(), 2);
+}
+
+// throws from its constructor when asked to
+struct may_throw {
+  int value;
+
+  explicit may_throw(int v, bool fail = false) : value(v) {
+    if (fail) {
+      throw std::runtime_error("may_throw");
+    }
+  }
+};
+
+TEST(Stack, StorageThrowingConstructor) {
+  s21::chunked_storage<may_throw> a;
+  std::size_t first = s21::chunked_storage<may_throw>::kMinChunkBytes / sizeof(may_throw);
+  for (std::size_t i = 0; i < first; i++) {
+    a.emplace_back(static_cast<int>(i));
+  }
+  // the first chunk is full, the next push opens a chunk and throws
+  EXPECT_THROW(a.emplace_back(-1, true), std::runtime_error);
+  EXPECT_EQ(a.size(), first);
+  EXPECT_EQ(a.back().value, static_cast<int>(first) - 1);
+  a.pop_back();
+  EXPECT_EQ(a.back().value, static_cast<int>(first) - 2);
+  a.emplace_back(7);
+  a.emplace_back(8);
+  EXPECT_EQ(a.back().value, 8);
+  a.pop_back();
+  EXPECT_EQ(a.back().value, 7);
+}
+
+TEST(Stack, OtherContainers) {
+  s21::stack<int, s21::vector<int>> a{1, 2, 3};
+  a.reserve(100);
+  a.push(4);
+  stack_eq(a, std_stack<int>({1, 2, 3, 4}));
+  s21::stack<std::string, s21::list<std::string>> b{"one", "two"};
+  b.reserve(100);
+  b.push("three");
+  stack_eq(b, std_stack<std::string>({"one", "two", "three"}));
+  s21::stack<int, s21::chunked_storage<int>> c{1, 2};
+  c.push(3);
+  stack_eq(c, std_stack<int>({1, 2, 3}));
+}
+
+TEST(Stack, InsertManyFront) {
+  s21::stack<int> a{1};
+  a.insert_many_front(2, 3, 4);
+  stack_eq(a, std_stack<int>({1, 2, 3, 4}));
+}
+
+TEST(Stack, Swap) {
+  s21::stack<int> a{1, 2};
+  s21::stack<int> b{3};
+  a.swap(b);
+  stack_eq(a, std_stack<int>({3}));
+  stack_eq(b, std_stack<int>({1, 2}));
+}
+
+template <typename T>
+void deque_eq(const s21::deque<T>& a, const std::deque<T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  ASSERT_EQ(a.size(), b.size());
+  for (std::size_t i = 0; i < b.size(); i++) {
+    EXPECT_EQ(a[i], b[i]);
+  }
+  std::size_t i = 0;
+  for (auto it = a.begin(); it != a.end(); ++it, ++i) {
+    EXPECT_EQ(*it, b[i]);
+  }
+}
+
+TEST(Deque, DefaultConstructor) {
+  s21::deque<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.capacity(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_THROW(a.at(0), std::out_of_range);
+}
+
+TEST(Deque, BlockSize) {
+  EXPECT_EQ(s21::deque<char>::kBlockBytes, 4096U);
+  EXPECT_EQ(s21::deque<int>::kBlockSize, 1024U);
+  EXPECT_EQ(s21::deque<std::string>::kBlockBytes % 4096, 0U);
+  struct big {
+    char bytes[1000];
+  };
+  EXPECT_EQ(s21::deque<big>::kBlockBytes, 16384U);
+  EXPECT_GE(s21::deque<big>::kBlockSize, 16U);
+}
+
+TEST(Deque, Constructors) {
+  s21::deque<std::string> a{"one", "two", "three"};
+  deque_eq(a, {"one", "two", "three"});
+  s21::deque<std::string> b(a);
+  deque_eq(b, {"one", "two", "three"});
+  s21::deque<std::string> c(std::move(b));
+  deque_eq(c, {"one", "two", "three"});
+  EXPECT_TRUE(b.empty());
+  b.push_back("four");
+  deque_eq(b, {"four"});
+  b = c;
+  deque_eq(b, {"one", "two", "three"});
+  c = s21::deque<std::string>{"five"};
+  deque_eq(c, {"five"});
+}
+
+TEST(Deque, BothEnds) {
+  s21::deque<int> a;
+  std::deque<int> b;
+  for (int i = 0; i < 5000; i++) {
+    a.push_back(i);
+    b.push_back(i);
+    a.push_front(-i);
+    b.push_front(-i);
+    if (i % 3 == 0) {
+      a.pop_back();
+      b.pop_back();
+    }
+    if (i % 5 == 0) {
+      a.pop_front();
+      b.pop_front();
+    }
+  }
+  deque_eq(a, b);
+  EXPECT_EQ(a.front(), b.front());
+  EXPECT_EQ(a.back(), b.back());
+  EXPECT_EQ(a.at(100), b.at(100));
+  EXPECT_THROW(a.at(b.size()), std::out_of_range);
+  while (!b.empty()) {
+    EXPECT_EQ(a.front(), b.front());
+    a.pop_front();
+    b.pop_front();
+  }
+  deque_eq(a, b);
+  a.push_front(1);
+  a.push_back(2);
+  deque_eq(a, {1, 2});
+}
+
+TEST(Deque, StableReferences) {
+  s21::deque<int> a;
+  std::vector<const int*> addresses;
+  for (int i = 0; i < 20000; i++) {
+    addresses.push_back(&a.emplace_back(i));
+    addresses.insert(addresses.begin(), &a.emplace_front(-i));
+  }
+  for (std::size_t i = 0; i < addresses.size(); i++) {
+    EXPECT_EQ(&a[i], addresses[i]);
+  }
+}
+
+TEST(Deque, QueuePatternReusesBlocks) {
+  s21::deque<int> a;
+  for (int i = 0; i < 3000; i++) {
+    a.push_back(i);
+  }
+  std::size_t capacity = a.capacity();
+  int next = 3000;
+  for (int round = 0; round < 100000; round++) {
+    a.pop_front();
+    a.push_back(next++);
+  }
+  EXPECT_EQ(a.size(), 3000U);
+  EXPECT_EQ(a.front(), next - 3000);
+  EXPECT_LE(a.capacity(), capacity + s21::deque<int>::kBlockSize);
+  // long enough for the blocks to reach the end of the map many times:
+  // they are recentered and recycled, so pushes only ever land in the
+  // same few blocks
+  std::set<const int*> slots;
+  for (int round = 0; round < 1000000; round++) {
+    a.pop_front();
+    a.push_back(next++);
+    slots.insert(&a.back());
+  }
+  std::size_t blocks = 3000 / s21::deque<int>::kBlockSize + 2;
+  EXPECT_LE(slots.size(), blocks * s21::deque<int>::kBlockSize);
+}
+
+TEST(Deque, ReserveShrink) {
+  s21::deque<int> a;
+  a.reserve(5000);
+  std::size_t capacity = a.capacity();
+  EXPECT_GE(capacity, 5000U);
+  for (int i = 0; i < 5000; i++) {
+    a.push_back(i);
+  }
+  EXPECT_EQ(a.capacity(), capacity);
+  for (int i = 0; i < 4000; i++) {
+    a.pop_back();
+  }
+  a.shrink_to_fit();
+  EXPECT_LT(a.capacity(), capacity);
+  EXPECT_EQ(a.back(), 999);
+  a.clear();
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 0U);
+  a.push_front(1);
+  a.push_back(2);
+  deque_eq(a, {1, 2});
+}
+
+TEST(Deque, InsertMany) {
+  s21::deque<int> a{3};
+  a.insert_many_back(4, 5);
+  a.insert_many_front(1, 2);
+  deque_eq(a, {1, 2, 3, 4, 5});
+}
+
+TEST(Deque, Swap) {
+  s21::deque<int> a{1, 2};
+  s21::deque<int> b{3};
+  a.swap(b);
+  deque_eq(a, {3});
+  deque_eq(b, {1, 2});
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void priority_queue_eq(s21::priority_queue<T, Compare, Arity> a,
+                       std::priority_queue<T, std::vector<T>, Compare> b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  while (!b.empty()) {
+    EXPECT_EQ(a.top(), b.top());
+    a.pop();
+    b.pop();
+  }
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(PriorityQueue, DefaultConstructor) {
+  s21::priority_queue<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_THROW(a.top(), std::out_of_range);
+  EXPECT_THROW(a.pop(), std::out_of_range);
+}
+
+TEST(PriorityQueue, Constructors) {
+  s21::priority_queue<std::string> a{"b", "d", "a", "e", "c", "f", "g"};
+  std::priority_queue<std::string> b;
+  for (const char* value : {"b", "d", "a", "e", "c", "f", "g"}) {
+    b.push(value);
+  }
+  priority_queue_eq(a, b);
+  s21::priority_queue<std::string> c(a);
+  priority_queue_eq(c, b);
+  s21::priority_queue<std::string> d(std::move(c));
+  priority_queue_eq(d, b);
+  EXPECT_TRUE(c.empty());
+  c = d;
+  priority_queue_eq(c, b);
+}
+
+template <std::size_t Arity, typename Compare>
+void push_pop_random() {
+  s21::priority_queue<int, Compare, Arity> a;
+  std::priority_queue<int, std::vector<int>, Compare> b;
+  std::srand(47);
+  for (int i = 0; i < 20000; i++) {
+    int value = std::rand() % 1000;
+    a.push(value);
+    b.push(value);
+    if (i % 3 == 0) {
+      EXPECT_EQ(a.top(), b.top());
+      a.pop();
+      b.pop();
+    }
+  }
+  priority_queue_eq(a, b);
+}
+
+TEST(PriorityQueue, PushPop) {
+  push_pop_random<2, std::less<int>>();
+  push_pop_random<4, std::less<int>>();
+  push_pop_random<4, std::greater<int>>();
+  push_pop_random<8, std::less<int>>();
+}
+
+TEST(PriorityQueue, InsertManyBackSwap) {
+  s21::priority_queue<int> a{5};
+  a.insert_many_back(3, 9, 1);
+  EXPECT_EQ(a.top(), 9);
+  s21::priority_queue<int> b;
+  b.swap(a);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), 4U);
+  EXPECT_EQ(b.top(), 9);
+}
+
+TEST(AddressablePriorityQueue, Handles) {
+  s21::addressable_priority_queue<int, std::greater<int>> a;
+  EXPECT_THROW(a.top(), std::out_of_range);
+  auto five = a.push(5);
+  auto three = a.push(3);
+  auto eight = a.push(8);
+  EXPECT_EQ(a.top(), 3);
+  EXPECT_EQ(a.top_handle(), three);
+  EXPECT_EQ(a.value(eight), 8);
+  // a min-queue: a larger value moves away from the top, a smaller one
+  // towards it
+  a.demote(three, 9);
+  EXPECT_EQ(a.top(), 5);
+  a.promote(eight, 1);
+  EXPECT_EQ(a.top_handle(), eight);
+  a.update(five, 0);
+  EXPECT_EQ(a.top(), 0);
+  a.erase(five);
+  EXPECT_FALSE(a.contains(five));
+  EXPECT_TRUE(a.contains(three));
+  EXPECT_EQ(a.top(), 1);
+  a.pop();
+  EXPECT_FALSE(a.contains(eight));
+  EXPECT_EQ(a.size(), 1U);
+  EXPECT_EQ(a.value(three), 9);
+  auto reused = a.push(4);
+  EXPECT_TRUE(a.contains(reused));
+  EXPECT_EQ(a.top_handle(), reused);
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  EXPECT_FALSE(a.contains(reused));
+}
+
+TEST(AddressablePriorityQueue, RandomUpdates) {
+  using queue_type = s21::addressable_priority_queue<std::pair<int, int>>;
+  queue_type a;
+  std::set<std::pair<int, int>> b;
+  std::vector<queue_type::handle> handles;
+  std::srand(4747);
+  for (int id = 0; id < 2000; id++) {
+    std::pair<int, int> value(std::rand() % 500, id);
+    handles.push_back(a.push(value));
+    b.insert(value);
+  }
+  for (int round = 0; round < 20000; round++) {
+    int id = std::rand() % 2000;
+    std::pair<int, int> value(std::rand() % 500, id);
+    if (a.contains(handles[id])) {
+      b.erase(a.value(handles[id]));
+      if (round % 10 == 0) {
+        a.erase(handles[id]);
+        continue;
+      }
+      a.update(handles[id], value);
+    } else {
+      handles[id] = a.push(value);
+    }
+    b.insert(value);
+    ASSERT_EQ(a.top(), *b.rbegin());
+  }
+  EXPECT_EQ(a.size(), b.size());
+  queue_type c(a);
+  while (!b.empty()) {
+    EXPECT_EQ(c.top(), *b.rbegin());
+    EXPECT_EQ(c.value(c.top_handle()), c.top());
+    c.pop();
+    b.erase(std::prev(b.end()));
+  }
+  EXPECT_TRUE(c.empty());
+  EXPECT_FALSE(a.empty());
+}
+
+struct connection {
+  int id;
+  long deadline;
+  s21::rb_hook by_id;
+  s21::rb_hook by_deadline;
+
+  connection(int i, long d) : id(i), deadline(d) {}
+};
+
+struct by_id_less {
+  bool operator()(const connection& lhs, const connection& rhs) const { return lhs.id < rhs.id; }
+};
+
+struct by_deadline_less {
+  bool operator()(const connection& lhs, const connection& rhs) const {
+    return lhs.deadline < rhs.deadline;
+  }
+};
+
+using id_index = s21::intrusive_set<connection, &connection::by_id, by_id_less>;
+using deadline_index = s21::intrusive_set<connection, &connection::by_deadline, by_deadline_less>;
+
+// checks the red-black properties below x, returns its black height
+static int black_height(const s21::rb_hook* x) {
+  if (!x) {
+    return 1;
+  }
+  if (x->color_ == s21::rb_tree_color::red) {
+    EXPECT_FALSE(x->left_ && x->left_->color_ == s21::rb_tree_color::red);
+    EXPECT_FALSE(x->right_ && x->right_->color_ == s21::rb_tree_color::red);
+  }
+  if (x->left_) {
+    EXPECT_EQ(x->left_->parent_, x);
+  }
+  if (x->right_) {
+    EXPECT_EQ(x->right_->parent_, x);
+  }
+  int left = black_height(x->left_);
+  EXPECT_EQ(left, black_height(x->right_));
+  return left + (x->color_ == s21::rb_tree_color::black ? 1 : 0);
+}
+
+template <typename Set>
+static void check_tree(Set& set) {
+  if (set.empty()) {
+    EXPECT_EQ(set.begin(), set.end());
+    return;
+  }
+  // the root is the node whose parent is the header, end()
+  const s21::rb_hook* root = &((*set.begin()).by_id);
+  while (root->parent_->parent_ != root->parent_) {
+    root = root->parent_;
+  }
+  EXPECT_EQ(root->color_, s21::rb_tree_color::black);
+  black_height(root);
+}
+
+TEST(IntrusiveSet, Empty) {
+  id_index a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_EQ(a.find(connection(1, 0)), a.end());
+}
+
+TEST(IntrusiveSet, InsertFindErase) {
+  std::vector<connection> items;
+  for (int i = 0; i < 10; i++) {
+    items.emplace_back(i * 7 % 10, 0);
+  }
+  id_index a;
+  for (connection& c : items) {
+    EXPECT_FALSE(c.by_id.is_linked());
+    EXPECT_TRUE(a.insert(c).second);
+    EXPECT_TRUE(c.by_id.is_linked());
+  }
+  connection duplicate(3, 0);
+  auto result = a.insert(duplicate);
+  EXPECT_FALSE(result.second);
+  EXPECT_FALSE(duplicate.by_id.is_linked());
+  EXPECT_EQ(&*result.first, &items[9]);
+  EXPECT_EQ(a.size(), 10U);
+  int expected = 0;
+  for (connection& c : a) {
+    EXPECT_EQ(c.id, expected++);
+  }
+  EXPECT_EQ(&*a.find(connection(7, 0)), &items[1]);
+  EXPECT_TRUE(a.contains(connection(9, 0)));
+  EXPECT_EQ(a.lower_bound(connection(4, 0))->id, 4);
+  EXPECT_EQ(a.upper_bound(connection(4, 0))->id, 5);
+  EXPECT_EQ(a.upper_bound(connection(9, 0)), a.end());
+  EXPECT_EQ((--a.end())->id, 9);
+  a.erase(items[1]);
+  EXPECT_FALSE(items[1].by_id.is_linked());
+  EXPECT_FALSE(a.contains(connection(7, 0)));
+  a.erase(a.begin());
+  EXPECT_EQ(a.begin()->id, 1);
+  EXPECT_EQ(a.size(), 8U);
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  for (connection& c : items) {
+    EXPECT_FALSE(c.by_id.is_linked());
+  }
+  EXPECT_TRUE(a.insert(items[0]).second);
+}
+
+TEST(IntrusiveSet, SeveralIndexes) {
+  std::vector<connection> items;
+  for (int i = 0; i < 100; i++) {
+    items.emplace_back(i, (i * 37) % 100);
+  }
+  id_index ids;
+  deadline_index deadlines;
+  for (connection& c : items) {
+    ids.insert(c);
+    deadlines.insert(c);
+  }
+  EXPECT_EQ(deadlines.begin()->deadline, 0);
+  EXPECT_EQ(deadlines.begin()->id, 0);
+  // reschedule: unlink from one index, change its key, link it back
+  connection& c = *ids.find(connection(10, 0));
+  deadlines.erase(c);
+  c.deadline = -1;
+  deadlines.insert(c);
+  EXPECT_EQ(&*deadlines.begin(), &c);
+  EXPECT_EQ(&*ids.iterator_to(c), &c);
+  EXPECT_EQ(ids.size(), 100U);
+  EXPECT_EQ(deadlines.size(), 100U);
+}
+
+TEST(IntrusiveSet, RandomAgainstStdSet) {
+  std::vector<connection> items;
+  for (int i = 0; i < 3000; i++) {
+    items.emplace_back(i, 0);
+  }
+  id_index a;
+  std::set<int> b;
+  std::srand(48);
+  for (int round = 0; round < 30000; round++) {
+    connection& c = items[std::rand() % items.size()];
+    if (c.by_id.is_linked()) {
+      a.erase(c);
+      b.erase(c.id);
+    } else {
+      a.insert(c);
+      b.insert(c.id);
+    }
+    if (round % 1000 == 0) {
+      check_tree(a);
+    }
+  }
+  check_tree(a);
+  ASSERT_EQ(a.size(), b.size());
+  auto it = b.begin();
+  for (connection& c : a) {
+    EXPECT_EQ(c.id, *it++);
+  }
+}
+
+TEST(IntrusiveSet, MultiInsert) {
+  std::vector<connection> items;
+  for (int i = 0; i < 6; i++) {
+    items.emplace_back(i, i % 2);
+  }
+  deadline_index a;
+  for (connection& c : items) {
+    a.multiinsert(c);
+  }
+  std::vector<int> order;
+  for (connection& c : a) {
+    order.push_back(c.id);
+  }
+  EXPECT_EQ(order, std::vector<int>({0, 2, 4, 1, 3, 5}));
+  EXPECT_EQ(a.lower_bound(connection(0, 1))->id, 1);
+}
+
+TEST(IntrusiveSet, MoveSwapAndCopiedHooks) {
+  std::vector<connection> items;
+  for (int i = 0; i < 5; i++) {
+    items.emplace_back(i, 0);
+  }
+  id_index a;
+  for (connection& c : items) {
+    a.insert(c);
+  }
+  id_index b(std::move(a));
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), 5U);
+  EXPECT_EQ((--b.end())->id, 4);
+  id_index c;
+  b.erase(items[1]);
+  c.insert(items[1]);
+  c.swap(b);
+  EXPECT_EQ(b.size(), 1U);
+  EXPECT_EQ(b.begin()->id, 1);
+  EXPECT_EQ(c.size(), 4U);
+  EXPECT_EQ(&*c.begin(), &items[0]);
+  EXPECT_EQ(&*--c.end(), &items[4]);
+  connection copy = items[2];
+  EXPECT_TRUE(items[2].by_id.is_linked());
+  EXPECT_FALSE(copy.by_id.is_linked());
+  copy.id = 3;
+  items[3] = copy;
+  EXPECT_TRUE(items[3].by_id.is_linked());
+  EXPECT_EQ(&*c.find(copy), &items[3]);
+  EXPECT_TRUE(c.contains(connection(3, 0)));
+}
+
+template <typename T, std::size_t K>
+void unrolled_list_eq(const s21::unrolled_list<T, K>& a, const std::list<T>& b) {
+  EXPECT_EQ(a.size(), b.size());
+  EXPECT_EQ(a.empty(), b.empty());
+  auto it = b.begin();
+  for (const T& value : a) {
+    ASSERT_NE(it, b.end());
+    EXPECT_EQ(value, *it++);
+  }
+  EXPECT_EQ(it, b.end());
+  // and backwards
+  auto rit = b.rbegin();
+  for (auto i = a.end(); i != a.begin();) {
+    --i;
+    EXPECT_EQ(*i, *rit++);
+  }
+}
+
+TEST(UnrolledList, DefaultConstructor) {
+  s21::unrolled_list<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.capacity(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_THROW(a.front(), std::out_of_range);
+  EXPECT_THROW(a.back(), std::out_of_range);
+  EXPECT_THROW(a.pop_back(), std::out_of_range);
+  EXPECT_THROW(a.pop_front(), std::out_of_range);
+}
+
+TEST(UnrolledList, Constructors) {
+  s21::unrolled_list<std::string, 2> a{"one", "two", "three"};
+  unrolled_list_eq(a, {"one", "two", "three"});
+  s21::unrolled_list<std::string, 2> b(a);
+  unrolled_list_eq(b, {"one", "two", "three"});
+  s21::unrolled_list<std::string, 2> c(std::move(b));
+  unrolled_list_eq(c, {"one", "two", "three"});
+  EXPECT_TRUE(b.empty());
+  b = c;
+  unrolled_list_eq(b, {"one", "two", "three"});
+  c = s21::unrolled_list<std::string, 2>{"four"};
+  unrolled_list_eq(c, {"four"});
+  s21::unrolled_list<int> d(5);
+  unrolled_list_eq(d, {0, 0, 0, 0, 0});
+}
+
+TEST(UnrolledList, PushPopFillBlocks) {
+  s21::unrolled_list<int, 8> a;
+  std::list<int> b;
+  for (int i = 0; i < 64; i++) {
+    a.push_back(i);
+    b.push_back(i);
+    a.push_front(-i);
+    b.push_front(-i);
+  }
+  unrolled_list_eq(a, b);
+  // appending at either end fills every block but the two end ones
+  EXPECT_LT(a.capacity() - a.size(), 2 * 8U);
+  EXPECT_EQ(a.front(), -63);
+  EXPECT_EQ(a.back(), 63);
+  for (int i = 0; i < 60; i++) {
+    a.pop_back();
+    b.pop_back();
+    a.pop_front();
+    b.pop_front();
+  }
+  unrolled_list_eq(a, b);
+  while (!a.empty()) {
+    a.pop_back();
+  }
+  EXPECT_EQ(a.capacity(), 0U);
+}
+
+TEST(UnrolledList, InsertEraseAgainstStdList) {
+  s21::unrolled_list<int, 4> a;
+  std::list<int> b;
+  std::srand(49);
+  for (int round = 0; round < 20000; round++) {
+    std::size_t pos = b.empty() ? 0 : std::rand() % (b.size() + 1);
+    auto ai = a.begin();
+    auto bi = b.begin();
+    for (std::size_t i = 0; i < pos; i++, ++ai, ++bi) {
+    }
+    if (std::rand() % 3 != 0 || bi == b.end()) {
+      auto inserted = a.insert(ai, round);
+      b.insert(bi, round);
+      EXPECT_EQ(*inserted, round);
+    } else {
+      auto next = a.erase(ai);
+      bi = b.erase(bi);
+      EXPECT_EQ(next == a.end(), bi == b.end());
+      if (bi != b.end()) {
+        EXPECT_EQ(*next, *bi);
+      }
+    }
+    if (b.size() > 300) {
+      for (int i = 0; i < 150; i++) {
+        a.pop_front();
+        b.pop_front();
+      }
+    }
+  }
+  unrolled_list_eq(a, b);
+  // every block but the first and the last is at least half full
+  EXPECT_LE(a.capacity(), 2 * a.size() + 8);
+}
+
+TEST(UnrolledList, MassEraseKeepsBlocksHalfFull) {
+  // erase 15 of every 16 elements in one pass
+  s21::unrolled_list<int, 16> a;
+  std::list<int> b;
+  for (int i = 0; i < 16000; i++) {
+    a.push_back(i);
+    b.push_back(i);
+  }
+  auto ai = a.begin();
+  auto bi = b.begin();
+  for (int i = 0; bi != b.end(); i++) {
+    if (i % 16 != 0) {
+      ai = a.erase(ai);
+      bi = b.erase(bi);
+    } else {
+      ++ai;
+      ++bi;
+    }
+  }
+  unrolled_list_eq(a, b);
+  EXPECT_LE(a.capacity(), 2 * a.size() + 16);
+  // drain from the front
+  while (a.size() > 100) {
+    a.pop_front();
+    b.pop_front();
+  }
+  unrolled_list_eq(a, b);
+  EXPECT_LE(a.capacity(), 2 * a.size() + 16);
+}
+TEST(UnrolledList, NonTrivialElements) {
+  s21::unrolled_list<std::unique_ptr<int>, 3> a;
+  for (int i = 0; i < 20; i++) {
+    a.push_back(std::make_unique<int>(i));
+  }
+  auto it = a.begin();
+  for (int i = 0; i < 10; i++) {
+    ++it;
+  }
+  it = a.insert(it, std::make_unique<int>(100));
+  it = a.erase(a.begin());
+  int expected[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 100, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+  int i = 0;
+  for (const auto& p : a) {
+    EXPECT_EQ(*p, expected[i++]);
+  }
+  EXPECT_EQ(i, 20);
+  // inserting a copy of an element of the list itself
+  s21::unrolled_list<std::string, 2> b{"a", "b"};
+  b.insert(b.begin(), b.back());
+  unrolled_list_eq(b, {"b", "a", "b"});
+}
+
+TEST(UnrolledList, InsertMany) {
+  s21::unrolled_list<int, 3> a{1, 5};
+  auto last = a.insert_many(++a.begin(), 2, 3, 4);
+  EXPECT_EQ(*last, 4);
+  EXPECT_EQ(a.insert_many(last), last);
+  a.insert_many_back(6, 7);
+  a.insert_many_front(-1, 0);
+  unrolled_list_eq(a, {-1, 0, 1, 2, 3, 4, 5, 6, 7});
+}
+
+TEST(UnrolledList, Swap) {
+  s21::unrolled_list<int> a{1, 2};
+  s21::unrolled_list<int> b{3};
+  a.swap(b);
+  unrolled_list_eq(a, {3});
+  unrolled_list_eq(b, {1, 2});
+  s21::unrolled_list<int> c;
+  c.swap(a);
+  EXPECT_TRUE(a.empty());
+  unrolled_list_eq(c, {3});
+}
+
+// forwards to new/delete and counts the blocks it has out
+class counting_resource : public std::pmr::memory_resource {
+ public:
+  int outstanding = 0;
+  int total = 0;
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++outstanding;
+    ++total;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+    --outstanding;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST(Set, MemoryResource) {
+  counting_resource resource;
+  {
+    s21::pmr::set<int> a(&resource);
+    EXPECT_EQ(a.get_allocator().resource(), &resource);
+    for (int i = 0; i < 100; i++) {
+      a.insert(i % 50);
+    }
+    // one node per key and the end node
+    EXPECT_EQ(resource.outstanding, 51);
+    a.erase(a.find(7));
+    EXPECT_EQ(resource.outstanding, 50);
+    s21::pmr::set<int> b(std::move(a));
+    EXPECT_EQ(b.size(), 49U);
+    s21::pmr::set<int> c{1, 2, 3};
+    EXPECT_EQ(c.get_allocator().resource(), std::pmr::get_default_resource());
+    // unequal resources: the elements are copied, not the nodes
+    c = std::move(b);
+    EXPECT_EQ(c.size(), 49U);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(resource.outstanding, 2);
+  }
+  EXPECT_EQ(resource.outstanding, 0);
+}
+
+TEST(Map, MonotonicBuffer) {
+  // a request-scoped map: every node comes from the buffer, and running
+  // out of it fails rather than falling back to the heap
+  alignas(std::max_align_t) unsigned char buffer[4096];
+  std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer),
+                                               std::pmr::null_memory_resource());
+  s21::pmr::map<int, int> a(&resource);
+  for (int i = 0; i < 20; i++) {
+    a[i] = i * i;
+  }
+  EXPECT_EQ(a.size(), 20U);
+  EXPECT_EQ(a.at(7), 49);
+  a.erase(a.find(7));
+  EXPECT_FALSE(a.contains(7));
+  EXPECT_THROW(
+      for (int i = 20; i < 1000; i++) { a.insert(i, i); }, std::bad_alloc);
+  EXPECT_EQ(a.at(19), 361);
+}
+
+// std::allocator that counts its live blocks in a shared counter
+template <typename T>
+struct counted_allocator {
+  using value_type = T;
+
+  explicit counted_allocator(int* live) : live_(live) {}
+
+  template <typename U>
+  counted_allocator(const counted_allocator<U>& other) : live_(other.live_) {}
+
+  T* allocate(std::size_t n) {
+    ++*live_;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) {
+    --*live_;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const counted_allocator<U>& other) const {
+    return live_ == other.live_;
+  }
+
+  template <typename U>
+  bool operator!=(const counted_allocator<U>& other) const {
+    return live_ != other.live_;
+  }
+
+  int* live_;
+};
+
+TEST(Multiset, Allocator) {
+  int live = 0;
+  {
+    s21::multiset<int, std::less<int>, counted_allocator<int>> a{
+        {1, 1, 2, 3, 3, 3}, counted_allocator<int>(&live)};
+    // the allocator is rebound to the nodes: one per distinct key and the end node
+    EXPECT_EQ(live, 4);
+    EXPECT_EQ(a.size(), 6U);
+    EXPECT_EQ(a.count(3), 3U);
+    EXPECT_EQ(a.get_allocator().live_, &live);
+    auto b(a);
+    EXPECT_EQ(live, 8);
+    b.clear();
+    EXPECT_EQ(live, 5);
+  }
+  EXPECT_EQ(live, 0);
+}
 
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+#include "../model/s21_array.hh"
+
+template <typename T, std::size_t N>
+void array_eq(const s21::array<T, N>& a, const std::array<T, N>& b) {
+  EXPECT_EQ(a.size(), b.size());
+  EXPECT_EQ(a.empty(), b.empty());
+  for (std::size_t i = 0; i < N; i++) {
+    EXPECT_EQ(a[i], b[i]);
+  }
+}
+
+constexpr s21::array<int, 16> squares() {
+  s21::array<int, 16> table;
+  for (std::size_t i = 0; i < table.size(); i++) {
+    table[i] = static_cast<int>(i * i);
+  }
+  return table;
+}
+
+TEST(Array, Constexpr) {
+  constexpr s21::array<int, 16> table = squares();
+  static_assert(table[3] == 9, "built at compile time");
+  static_assert(table.at(15) == 225, "at() in constant expressions");
+  static_assert(table.find(49) == table.begin() + 7, "find() in constant expressions");
+  static_assert(!table.contains(50), "contains() in constant expressions");
+  static_assert(table == squares(), "== in constant expressions");
+  constexpr s21::array<char, 4> filled = [] {
+    s21::array<char, 4> a;
+    a.fill('x');
+    return a;
+  }();
+  static_assert(filled.back() == 'x', "fill() in constant expressions");
+  constexpr s21::array<int, 3> listed{1, 2};
+  static_assert(listed[1] == 2 && listed[2] == 0, "the rest is value-initialized");
+  EXPECT_EQ(table[4], 16);
+}
+
+TEST(Array, Constructors) {
+  s21::array<int, 3> a;
+  array_eq(a, {0, 0, 0});
+  s21::array<std::string, 3> b{"one", "two"};
+  array_eq(b, {"one", "two", ""});
+  s21::array<std::string, 3> c(b);
+  array_eq(c, {"one", "two", ""});
+  s21::array<std::string, 3> d(std::move(c));
+  array_eq(d, {"one", "two", ""});
+  c = d;
+  array_eq(c, {"one", "two", ""});
+  EXPECT_THROW((s21::array<int, 2>{1, 2, 3}), std::out_of_range);
+  s21::array<int, 0> e;
+  EXPECT_TRUE(e.empty());
+  EXPECT_EQ(e.begin(), e.end());
+}
+
+TEST(Array, ElementAccess) {
+  s21::array<int, 3> a{1, 2, 3};
+  EXPECT_EQ(a.at(1), 2);
+  EXPECT_THROW(a.at(3), std::out_of_range);
+  EXPECT_EQ(a.front(), 1);
+  EXPECT_EQ(a.back(), 3);
+  EXPECT_EQ(a.data(), &a[0]);
+  int sum = 0;
+  for (int value : a) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 6);
+  s21::array<int, 3> b{4, 5, 6};
+  a.swap(b);
+  array_eq(a, {4, 5, 6});
+  array_eq(b, {1, 2, 3});
+}
+
+// every size and offset, so both the SIMD blocks and the tails are hit
+template <typename T>
+void check_kernels() {
+  s21::array<T, 37> a;
+  a.fill(T(3));
+  for (T value : a) {
+    EXPECT_EQ(value, T(3));
+  }
+  s21::array<T, 37> b(a);
+  EXPECT_TRUE(a == b);
+  for (std::size_t i = 0; i < a.size(); i++) {
+    EXPECT_EQ(a.find(T(5)), a.end());
+    a[i] = T(5);
+    EXPECT_EQ(a.find(T(5)), a.begin() + i);
+    EXPECT_TRUE(a != b);
+    a[i] = T(3);
+    EXPECT_TRUE(a == b);
+  }
+}
+
+TEST(Array, Kernels) {
+  check_kernels<std::int8_t>();
+  check_kernels<std::uint16_t>();
+  check_kernels<int>();
+  check_kernels<std::int64_t>();
+  check_kernels<float>();
+  check_kernels<double>();
+  s21::array<std::int64_t, 4> halves{0x100000000LL, 1};
+  EXPECT_EQ(halves.find(0x100000001LL), halves.end());
+  EXPECT_EQ(halves.find(1), halves.begin() + 1);
+}
+
+TEST(Array, FloatingPointValues) {
+  s21::array<double, 5> a{0.0, 1.0, NAN, 2.0, 3.0};
+  s21::array<double, 5> b{-0.0, 1.0, 2.0, 2.0, 3.0};
+  EXPECT_EQ(a.find(-0.0), a.begin());
+  EXPECT_EQ(a.find(NAN), a.end());
+  EXPECT_FALSE(a == a);
+  b[2] = 0.0;
+  a[2] = -0.0;
+  EXPECT_TRUE(a == b);
+  s21::array<float, 9> c;
+  c.fill(-0.0f);
+  EXPECT_TRUE(std::signbit(c[8]));
+  EXPECT_EQ(c.find(0.0f), c.begin());
+}
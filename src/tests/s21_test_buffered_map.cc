@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_buffered_map.hh"
+
+TEST(BufferedMap, UpdateAndFlush) {
+  s21::buffered_map<int, long> a;
+  a.update(1, 5);
+  a.update(2, 1);
+  a.update(1, 10);
+  EXPECT_TRUE(a.empty());
+  EXPECT_FALSE(a.find(1).has_value());
+  a.flush();
+  EXPECT_EQ(a.size(), 2U);
+  EXPECT_EQ(*a.find(1), 15);
+  EXPECT_EQ(*a.find(2), 1);
+  EXPECT_FALSE(a.contains(3));
+  a.update(1, 1);
+  a.flush();
+  EXPECT_EQ(*a.find(1), 16);
+}
+
+TEST(BufferedMap, ThresholdPublishes) {
+  s21::buffered_map<int, int> a(4);
+  EXPECT_EQ(a.flush_threshold(), 4U);
+  for (int i = 0; i < 3; i++) {
+    a.update(i, 1);
+  }
+  EXPECT_TRUE(a.empty());
+  a.update(3, 1);
+  EXPECT_EQ(a.size(), 4U);
+}
+
+TEST(BufferedMap, CustomCombine) {
+  auto max = [](int lhs, int rhs) { return std::max(lhs, rhs); };
+  s21::buffered_map<int, int, decltype(max)> a(2, max);
+  for (int value : {3, -1, 8, 2}) {
+    a.update(7, value);
+    a.update(value, value);
+  }
+  auto snapshot = a.snapshot();
+  EXPECT_EQ(snapshot.at(7), 8);
+  EXPECT_EQ(snapshot.at(-1), -1);
+}
+
+TEST(BufferedMap, ConcurrentCounters) {
+  s21::buffered_map<int, long> a(64);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&a, t] {
+      for (int i = 0; i < 20000; i++) {
+        a.update(i % 500, 1);
+        a.update(1000 + t, 2);
+        if (i % 5000 == 0) {
+          a.flush();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  a.flush();
+  EXPECT_EQ(a.size(), 504U);
+  for (int key = 0; key < 500; key++) {
+    EXPECT_EQ(*a.find(key), 4 * 40);
+  }
+  for (int t = 0; t < 4; t++) {
+    EXPECT_EQ(*a.find(1000 + t), 40000);
+  }
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_concurrent_map.hh"
+
+template <typename K, typename T, std::size_t Shards>
+void concurrent_map_eq(const s21::concurrent_map<K, T, Shards>& a, std::map<K, T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  auto bit = b.begin();
+  a.for_each([&](const std::pair<const K, T>& value) {
+    ASSERT_NE(bit, b.end());
+    EXPECT_EQ(value, *bit);
+    bit++;
+  });
+  EXPECT_EQ(bit, b.end());
+}
+
+TEST(ConcurrentMap, DefaultConstructor) {
+  s21::concurrent_map<int, int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.shard_count(), 16U);
+}
+
+TEST(ConcurrentMap, InitializerListConstructor) {
+  s21::concurrent_map<int, int, 4> a{{3, 30}, {1, 10}, {2, 20}, {1, 100}};
+  std::map<int, int> b{{3, 30}, {1, 10}, {2, 20}, {1, 100}};
+  concurrent_map_eq(a, b);
+}
+
+TEST(ConcurrentMap, InsertErase) {
+  s21::concurrent_map<int, int, 8> a;
+  std::map<int, int> b;
+  unsigned state = 1;
+  for (int i = 0; i < 5000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 700;
+    if ((state >> 4) % 3) {
+      EXPECT_EQ(a.insert(key, i), b.insert({key, i}).second);
+    } else {
+      EXPECT_EQ(a.erase(key), b.erase(key));
+    }
+  }
+  concurrent_map_eq(a, b);
+  a.clear();
+  b.clear();
+  concurrent_map_eq(a, b);
+}
+
+TEST(ConcurrentMap, InsertOrAssign) {
+  s21::concurrent_map<int, int> a{{1, 1}};
+  EXPECT_FALSE(a.insert_or_assign(1, 5));
+  EXPECT_TRUE(a.insert_or_assign(2, 7));
+  EXPECT_EQ(a.at(1), 5);
+  EXPECT_EQ(a.at(2), 7);
+}
+
+TEST(ConcurrentMap, Lookup) {
+  s21::concurrent_map<int, int> a{{1, 10}, {2, 20}};
+  EXPECT_TRUE(a.contains(1));
+  EXPECT_FALSE(a.contains(3));
+  EXPECT_EQ(a.find(2).value(), 20);
+  EXPECT_FALSE(a.find(3).has_value());
+  EXPECT_EQ(a.at(1), 10);
+  EXPECT_ANY_THROW(a.at(3));
+}
+
+TEST(ConcurrentMap, Upsert) {
+  s21::concurrent_map<int, int> a;
+  EXPECT_TRUE(a.upsert(4, [](int& value) { value += 2; }));
+  EXPECT_FALSE(a.upsert(4, [](int& value) { value *= 10; }));
+  EXPECT_EQ(a.at(4), 20);
+}
+
+TEST(ConcurrentMap, Snapshot) {
+  s21::concurrent_map<int, int, 3> a{{5, 5}, {1, 1}, {3, 3}};
+  auto b = a.snapshot();
+  EXPECT_EQ(b.size(), 3U);
+  int expected = 1;
+  for (auto value : b) {
+    EXPECT_EQ(value.first, expected);
+    expected += 2;
+  }
+}
+
+TEST(ConcurrentMap, StridedKeysSpread) {
+  using map_type = s21::concurrent_map<int, int, 16>;
+  for (int stride : {1, 16, 64, 4096}) {
+    std::vector<int> per_shard(map_type::shard_count());
+    for (int i = 0; i < 1600; i++) {
+      std::size_t index = map_type::shard_index(i * stride);
+      ASSERT_LT(index, map_type::shard_count());
+      per_shard[index]++;
+    }
+    // no shard is empty, none takes more than twice its share
+    for (int count : per_shard) {
+      EXPECT_GT(count, 0);
+      EXPECT_LT(count, 200);
+    }
+  }
+  EXPECT_LT((s21::concurrent_map<int, int, 3>::shard_index(12345)), 3U);
+}
+
+TEST(ConcurrentMap, ConcurrentUpsert) {
+  s21::concurrent_map<int, long> a;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&a] {
+      for (int i = 0; i < 10000; i++) {
+        a.upsert(i % 100, [](long& value) { value++; });
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(a.size(), 100U);
+  int expected = 0;
+  a.for_each([&expected](const std::pair<const int, long>& value) {
+    EXPECT_EQ(value.first, expected++);
+    EXPECT_EQ(value.second, 400);
+  });
+}
+
+TEST(ConcurrentMap, ConcurrentMixed) {
+  s21::concurrent_map<int, int, 4> a;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&a, t] {
+      unsigned state = t + 1;
+      for (int i = 0; i < 20000; i++) {
+        state = state * 1103515245U + 12345U;
+        int key = (state >> 8) % 256;
+        switch ((state >> 4) % 3) {
+          case 0:
+            a.insert_or_assign(key, -key);
+            break;
+          case 1:
+            a.erase(key);
+            break;
+          default: {
+            auto value = a.find(key);
+            if (value) {
+              EXPECT_EQ(*value, -key);
+            }
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  int prev = -1;
+  size_t count = 0;
+  a.for_each([&](const std::pair<const int, int>& value) {
+    EXPECT_LT(prev, value.first);
+    prev = value.first;
+    count++;
+  });
+  EXPECT_EQ(count, a.size());
+}
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_concurrent_skiplist_map.hh"
+
+template <typename K, typename T>
+void skiplist_map_eq(s21::concurrent_skiplist_map<K, T>& a, std::map<K, T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  auto ait = a.begin();
+  auto bit = b.begin();
+  while (bit != b.end()) {
+    EXPECT_EQ(*ait, *bit);
+    ait++;
+    bit++;
+  }
+  EXPECT_EQ(ait, a.end());
+}
+
+TEST(ConcurrentSkiplistMap, DefaultConstructor) {
+  s21::concurrent_skiplist_map<int, int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+}
+
+TEST(ConcurrentSkiplistMap, InitializerListConstructor) {
+  s21::concurrent_skiplist_map<int, int> a{{3, 3}, {1, 1}, {2, 2}, {1, 10}};
+  std::map<int, int> b{{3, 3}, {1, 1}, {2, 2}, {1, 10}};
+  skiplist_map_eq(a, b);
+}
+
+TEST(ConcurrentSkiplistMap, Insert) {
+  s21::concurrent_skiplist_map<int, int> a;
+  std::map<int, int> b;
+  unsigned state = 1;
+  for (int i = 0; i < 2000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = state % 500;
+    auto ares = a.insert(key, i);
+    auto bres = b.insert({key, i});
+    EXPECT_EQ(ares.second, bres.second);
+    EXPECT_EQ(*ares.first, *bres.first);
+  }
+  skiplist_map_eq(a, b);
+}
+
+TEST(ConcurrentSkiplistMap, Erase) {
+  s21::concurrent_skiplist_map<int, int> a{{1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}};
+  std::map<int, int> b{{1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}};
+  EXPECT_EQ(a.erase(3), 1U);
+  EXPECT_EQ(a.erase(3), 0U);
+  b.erase(3);
+  skiplist_map_eq(a, b);
+  a.erase(a.begin());
+  b.erase(b.begin());
+  skiplist_map_eq(a, b);
+  a.erase(a.find(5));
+  b.erase(5);
+  skiplist_map_eq(a, b);
+  a.insert(3, 30);
+  b.insert({3, 30});
+  skiplist_map_eq(a, b);
+}
+
+TEST(ConcurrentSkiplistMap, Lookup) {
+  s21::concurrent_skiplist_map<int, int> a{{1, 10}, {2, 20}};
+  EXPECT_TRUE(a.contains(1));
+  EXPECT_FALSE(a.contains(3));
+  EXPECT_EQ(a.count(2), 1U);
+  EXPECT_EQ(a.at(2), 20);
+  EXPECT_ANY_THROW(a.at(3));
+  EXPECT_EQ(a.find(1)->second, 10);
+  EXPECT_EQ(a.find(3), a.end());
+}
+
+TEST(ConcurrentSkiplistMap, Clear) {
+  s21::concurrent_skiplist_map<int, int> a{{1, 10}, {2, 20}};
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.begin(), a.end());
+  a.insert(7, 7);
+  EXPECT_EQ(a.size(), 1U);
+}
+
+TEST(ConcurrentSkiplistMap, InsertMany) {
+  s21::concurrent_skiplist_map<int, int> a{{1, 1}};
+  std::map<int, int> c{{1, 1}, {2, 2}, {3, 3}};
+  auto res = a.insert_many(std::pair<const int, int>{1, 5}, std::pair<const int, int>{2, 2},
+                           std::pair<const int, int>{3, 3});
+  EXPECT_EQ(res.size(), 3U);
+  EXPECT_FALSE(res[0].second);
+  EXPECT_TRUE(res[1].second);
+  skiplist_map_eq(a, c);
+}
+
+TEST(ConcurrentSkiplistMap, ConcurrentDisjointInserts) {
+  s21::concurrent_skiplist_map<int, int> a;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&a, t] {
+      for (int i = t; i < 4000; i += 4) {
+        a.insert(i, i * 2);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(a.size(), 4000U);
+  int expected = 0;
+  for (auto it = a.begin(); it != a.end(); ++it) {
+    EXPECT_EQ(it->first, expected);
+    EXPECT_EQ(it->second, expected * 2);
+    expected++;
+  }
+}
+
+TEST(ConcurrentSkiplistMap, ConcurrentMixed) {
+  s21::concurrent_skiplist_map<int, int> a;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&a, t] {
+      unsigned state = t + 1;
+      for (int i = 0; i < 20000; i++) {
+        state = state * 1103515245U + 12345U;
+        int key = (state >> 8) % 256;
+        switch ((state >> 4) % 3) {
+          case 0:
+            a.insert(key, -key);
+            break;
+          case 1:
+            a.erase(key);
+            break;
+          default: {
+            auto it = a.find(key);
+            if (it != a.end()) {
+              EXPECT_EQ(it->second, -key);
+            }
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  size_t count = 0;
+  int prev = -1;
+  for (auto it = a.begin(); it != a.end(); ++it) {
+    EXPECT_LT(prev, it->first);
+    prev = it->first;
+    count++;
+  }
+  EXPECT_EQ(count, a.size());
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../model/s21_deque.hh"
+
+template <typename T>
+void deque_eq(const s21::deque<T>& a, const std::deque<T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  ASSERT_EQ(a.size(), b.size());
+  for (std::size_t i = 0; i < b.size(); i++) {
+    EXPECT_EQ(a[i], b[i]);
+  }
+  std::size_t i = 0;
+  for (auto it = a.begin(); it != a.end(); ++it, ++i) {
+    EXPECT_EQ(*it, b[i]);
+  }
+}
+
+TEST(Deque, DefaultConstructor) {
+  s21::deque<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.capacity(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_THROW(a.at(0), std::out_of_range);
+}
+
+TEST(Deque, BlockSize) {
+  EXPECT_EQ(s21::deque<char>::kBlockBytes, 4096U);
+  EXPECT_EQ(s21::deque<int>::kBlockSize, 1024U);
+  EXPECT_EQ(s21::deque<std::string>::kBlockBytes % 4096, 0U);
+  struct big {
+    char bytes[1000];
+  };
+  EXPECT_EQ(s21::deque<big>::kBlockBytes, 16384U);
+  EXPECT_GE(s21::deque<big>::kBlockSize, 16U);
+}
+
+TEST(Deque, Constructors) {
+  s21::deque<std::string> a{"one", "two", "three"};
+  deque_eq(a, {"one", "two", "three"});
+  s21::deque<std::string> b(a);
+  deque_eq(b, {"one", "two", "three"});
+  s21::deque<std::string> c(std::move(b));
+  deque_eq(c, {"one", "two", "three"});
+  EXPECT_TRUE(b.empty());
+  b.push_back("four");
+  deque_eq(b, {"four"});
+  b = c;
+  deque_eq(b, {"one", "two", "three"});
+  c = s21::deque<std::string>{"five"};
+  deque_eq(c, {"five"});
+}
+
+TEST(Deque, BothEnds) {
+  s21::deque<int> a;
+  std::deque<int> b;
+  for (int i = 0; i < 5000; i++) {
+    a.push_back(i);
+    b.push_back(i);
+    a.push_front(-i);
+    b.push_front(-i);
+    if (i % 3 == 0) {
+      a.pop_back();
+      b.pop_back();
+    }
+    if (i % 5 == 0) {
+      a.pop_front();
+      b.pop_front();
+    }
+  }
+  deque_eq(a, b);
+  EXPECT_EQ(a.front(), b.front());
+  EXPECT_EQ(a.back(), b.back());
+  EXPECT_EQ(a.at(100), b.at(100));
+  EXPECT_THROW(a.at(b.size()), std::out_of_range);
+  while (!b.empty()) {
+    EXPECT_EQ(a.front(), b.front());
+    a.pop_front();
+    b.pop_front();
+  }
+  deque_eq(a, b);
+  a.push_front(1);
+  a.push_back(2);
+  deque_eq(a, {1, 2});
+}
+
+TEST(Deque, StableReferences) {
+  s21::deque<int> a;
+  std::vector<const int*> addresses;
+  for (int i = 0; i < 20000; i++) {
+    addresses.push_back(&a.emplace_back(i));
+    addresses.insert(addresses.begin(), &a.emplace_front(-i));
+  }
+  for (std::size_t i = 0; i < addresses.size(); i++) {
+    EXPECT_EQ(&a[i], addresses[i]);
+  }
+}
+
+TEST(Deque, QueuePatternReusesBlocks) {
+  s21::deque<int> a;
+  for (int i = 0; i < 3000; i++) {
+    a.push_back(i);
+  }
+  std::size_t capacity = a.capacity();
+  int next = 3000;
+  for (int round = 0; round < 100000; round++) {
+    a.pop_front();
+    a.push_back(next++);
+  }
+  EXPECT_EQ(a.size(), 3000U);
+  EXPECT_EQ(a.front(), next - 3000);
+  EXPECT_LE(a.capacity(), capacity + s21::deque<int>::kBlockSize);
+  // long enough for the blocks to reach the end of the map many times:
+  // they are recentered and recycled, so pushes only ever land in the
+  // same few blocks
+  std::set<const int*> slots;
+  for (int round = 0; round < 1000000; round++) {
+    a.pop_front();
+    a.push_back(next++);
+    slots.insert(&a.back());
+  }
+  std::size_t blocks = 3000 / s21::deque<int>::kBlockSize + 2;
+  EXPECT_LE(slots.size(), blocks * s21::deque<int>::kBlockSize);
+}
+
+TEST(Deque, ReserveShrink) {
+  s21::deque<int> a;
+  a.reserve(5000);
+  std::size_t capacity = a.capacity();
+  EXPECT_GE(capacity, 5000U);
+  for (int i = 0; i < 5000; i++) {
+    a.push_back(i);
+  }
+  EXPECT_EQ(a.capacity(), capacity);
+  for (int i = 0; i < 4000; i++) {
+    a.pop_back();
+  }
+  a.shrink_to_fit();
+  EXPECT_LT(a.capacity(), capacity);
+  EXPECT_EQ(a.back(), 999);
+  a.clear();
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 0U);
+  a.push_front(1);
+  a.push_back(2);
+  deque_eq(a, {1, 2});
+}
+
+TEST(Deque, InsertMany) {
+  s21::deque<int> a{3};
+  a.insert_many_back(4, 5);
+  a.insert_many_front(1, 2);
+  deque_eq(a, {1, 2, 3, 4, 5});
+}
+
+TEST(Deque, Swap) {
+  s21::deque<int> a{1, 2};
+  s21::deque<int> b{3};
+  a.swap(b);
+  deque_eq(a, {3});
+  deque_eq(b, {1, 2});
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <vector>
+
+#include "../model/s21_int_set.hh"
+
+template <typename T>
+void int_set_eq(s21::int_set<T>& a, std::set<T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  auto ait = a.begin();
+  auto bit = b.begin();
+  while (bit != b.end()) {
+    EXPECT_EQ(*ait, *bit);
+    ait++;
+    bit++;
+  }
+  EXPECT_EQ(ait, a.end());
+}
+
+TEST(IntSet, DefaultConstructor) {
+  s21::int_set<unsigned> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.max_size(), 4294967296ULL);
+  EXPECT_EQ(a.begin(), a.end());
+}
+
+TEST(IntSet, InitializerListConstructor) {
+  {
+    s21::int_set<unsigned> a{};
+    std::set<unsigned> b{};
+    int_set_eq(a, b);
+  }
+  {
+    s21::int_set<unsigned> a{5, 4, 3, 2, 1};
+    std::set<unsigned> b{5, 4, 3, 2, 1};
+    int_set_eq(a, b);
+  }
+  {
+    s21::int_set<unsigned> a{3, 3, 2, 2, 1, 1};
+    std::set<unsigned> b{3, 3, 2, 2, 1, 1};
+    int_set_eq(a, b);
+  }
+  {
+    s21::int_set<unsigned> a{0, 63, 64, 4095, 4096, 262143, 262144, 1000000};
+    std::set<unsigned> b{0, 63, 64, 4095, 4096, 262143, 262144, 1000000};
+    int_set_eq(a, b);
+  }
+}
+
+TEST(IntSet, CopyMove) {
+  s21::int_set<unsigned> a{1, 100, 10000};
+  std::set<unsigned> c{1, 100, 10000};
+  s21::int_set<unsigned> b(a);
+  a.clear();
+  int_set_eq(b, c);
+  s21::int_set<unsigned> d(std::move(b));
+  int_set_eq(d, c);
+  s21::int_set<unsigned> e;
+  e = d;
+  int_set_eq(e, c);
+  s21::int_set<unsigned> f;
+  f = std::move(e);
+  int_set_eq(f, c);
+}
+
+TEST(IntSet, Insert) {
+  s21::int_set<unsigned> a;
+  std::set<unsigned> b;
+  unsigned key = 7;
+  for (int i = 0; i < 2000; i++) {
+    key = (key * 1103515245U + 12345U) % 300000U;
+    auto ares = a.insert(key);
+    auto bres = b.insert(key);
+    EXPECT_EQ(ares.second, bres.second);
+    EXPECT_EQ(*ares.first, *bres.first);
+  }
+  int_set_eq(a, b);
+}
+
+TEST(IntSet, Erase) {
+  s21::int_set<unsigned> a{1, 2, 64, 65, 4096, 70000};
+  std::set<unsigned> b{1, 2, 64, 65, 4096, 70000};
+  int size = a.size();
+  for (int i = 0; i < size; i++) {
+    a.erase(a.begin());
+    b.erase(b.begin());
+    int_set_eq(a, b);
+  }
+  a.insert_many(3, 5, 7);
+  EXPECT_EQ(a.erase(5U), 1U);
+  EXPECT_EQ(a.erase(5U), 0U);
+  EXPECT_EQ(a.erase(1000000U), 0U);
+  EXPECT_FALSE(a.contains(5));
+  EXPECT_EQ(a.size(), 2U);
+}
+
+TEST(IntSet, Swap) {
+  s21::int_set<unsigned> a{1, 2, 3};
+  s21::int_set<unsigned> b{100000};
+  std::set<unsigned> c{1, 2, 3};
+  std::set<unsigned> d{100000};
+  a.swap(b);
+  int_set_eq(a, d);
+  int_set_eq(b, c);
+}
+
+TEST(IntSet, Merge) {
+  {
+    s21::int_set<unsigned> a{1, 2, 3};
+    s21::int_set<unsigned> b{3, 4, 500000};
+    std::set<unsigned> c{1, 2, 3, 4, 500000};
+    a.merge(b);
+    int_set_eq(a, c);
+  }
+  {
+    s21::int_set<unsigned> a{1, 2, 300000};
+    s21::int_set<unsigned> b{7};
+    std::set<unsigned> c{1, 2, 7, 300000};
+    a.merge(b);
+    int_set_eq(a, c);
+  }
+}
+
+TEST(IntSet, ContainsFind) {
+  s21::int_set<unsigned> a{10, 20, 30, 100000};
+  for (unsigned key : {0U, 10U, 15U, 20U, 30U, 99999U, 100000U, 5000000U}) {
+    bool expected = key == 10 || key == 20 || key == 30 || key == 100000;
+    EXPECT_EQ(a.contains(key), expected);
+    EXPECT_EQ(a.count(key), expected ? 1U : 0U);
+    if (expected) {
+      EXPECT_EQ(*a.find(key), key);
+    } else {
+      EXPECT_EQ(a.find(key), a.end());
+    }
+  }
+}
+
+TEST(IntSet, Bounds) {
+  std::vector<unsigned> keys{0, 1, 63, 64, 65, 4095, 4096, 4097, 300000};
+  s21::int_set<unsigned> a{1, 64, 4097, 200000};
+  std::set<unsigned> b{1, 64, 4097, 200000};
+  for (unsigned key : keys) {
+    auto alower = a.lower_bound(key);
+    auto blower = b.lower_bound(key);
+    if (blower == b.end()) {
+      EXPECT_EQ(alower, a.end());
+    } else {
+      EXPECT_EQ(*alower, *blower);
+    }
+    auto aupper = a.upper_bound(key);
+    auto bupper = b.upper_bound(key);
+    if (bupper == b.end()) {
+      EXPECT_EQ(aupper, a.end());
+    } else {
+      EXPECT_EQ(*aupper, *bupper);
+    }
+  }
+}
+
+TEST(IntSet, ReverseIteration) {
+  s21::int_set<unsigned> a{3, 70, 5000, 262145};
+  std::set<unsigned> b{3, 70, 5000, 262145};
+  auto ait = a.end();
+  auto bit = b.end();
+  while (bit != b.begin()) {
+    --ait;
+    --bit;
+    EXPECT_EQ(*ait, *bit);
+  }
+  EXPECT_EQ(ait, a.begin());
+}
+
+TEST(IntSet, InsertMany) {
+  s21::int_set<unsigned> a{1};
+  std::set<unsigned> c{1, 2, 3, 70000};
+  auto res = a.insert_many(1U, 2U, 3U, 70000U);
+  EXPECT_EQ(res.size(), 4U);
+  EXPECT_FALSE(res[0].second);
+  EXPECT_TRUE(res[3].second);
+  int_set_eq(a, c);
+}
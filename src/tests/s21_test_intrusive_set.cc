@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../model/s21_intrusive_set.hh"
+
+struct connection {
+  int id;
+  long deadline;
+  s21::rb_hook by_id;
+  s21::rb_hook by_deadline;
+
+  connection(int i, long d) : id(i), deadline(d) {}
+};
+
+struct by_id_less {
+  bool operator()(const connection& lhs, const connection& rhs) const { return lhs.id < rhs.id; }
+};
+
+struct by_deadline_less {
+  bool operator()(const connection& lhs, const connection& rhs) const {
+    return lhs.deadline < rhs.deadline;
+  }
+};
+
+using id_index = s21::intrusive_set<connection, &connection::by_id, by_id_less>;
+using deadline_index = s21::intrusive_set<connection, &connection::by_deadline, by_deadline_less>;
+
+// checks the red-black properties below x, returns its black height
+static int black_height(const s21::rb_hook* x) {
+  if (!x) {
+    return 1;
+  }
+  if (x->color_ == s21::rb_tree_color::red) {
+    EXPECT_FALSE(x->left_ && x->left_->color_ == s21::rb_tree_color::red);
+    EXPECT_FALSE(x->right_ && x->right_->color_ == s21::rb_tree_color::red);
+  }
+  if (x->left_) {
+    EXPECT_EQ(x->left_->parent_, x);
+  }
+  if (x->right_) {
+    EXPECT_EQ(x->right_->parent_, x);
+  }
+  int left = black_height(x->left_);
+  EXPECT_EQ(left, black_height(x->right_));
+  return left + (x->color_ == s21::rb_tree_color::black ? 1 : 0);
+}
+
+template <typename Set>
+static void check_tree(Set& set) {
+  if (set.empty()) {
+    EXPECT_EQ(set.begin(), set.end());
+    return;
+  }
+  // the root is the node whose parent is the header, end()
+  const s21::rb_hook* root = &((*set.begin()).by_id);
+  while (root->parent_->parent_ != root->parent_) {
+    root = root->parent_;
+  }
+  EXPECT_EQ(root->color_, s21::rb_tree_color::black);
+  black_height(root);
+}
+
+TEST(IntrusiveSet, Empty) {
+  id_index a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_EQ(a.find(connection(1, 0)), a.end());
+}
+
+TEST(IntrusiveSet, InsertFindErase) {
+  std::vector<connection> items;
+  for (int i = 0; i < 10; i++) {
+    items.emplace_back(i * 7 % 10, 0);
+  }
+  id_index a;
+  for (connection& c : items) {
+    EXPECT_FALSE(c.by_id.is_linked());
+    EXPECT_TRUE(a.insert(c).second);
+    EXPECT_TRUE(c.by_id.is_linked());
+  }
+  connection duplicate(3, 0);
+  auto result = a.insert(duplicate);
+  EXPECT_FALSE(result.second);
+  EXPECT_FALSE(duplicate.by_id.is_linked());
+  EXPECT_EQ(&*result.first, &items[9]);
+  EXPECT_EQ(a.size(), 10U);
+  int expected = 0;
+  for (connection& c : a) {
+    EXPECT_EQ(c.id, expected++);
+  }
+  EXPECT_EQ(&*a.find(connection(7, 0)), &items[1]);
+  EXPECT_TRUE(a.contains(connection(9, 0)));
+  EXPECT_EQ(a.lower_bound(connection(4, 0))->id, 4);
+  EXPECT_EQ(a.upper_bound(connection(4, 0))->id, 5);
+  EXPECT_EQ(a.upper_bound(connection(9, 0)), a.end());
+  EXPECT_EQ((--a.end())->id, 9);
+  a.erase(items[1]);
+  EXPECT_FALSE(items[1].by_id.is_linked());
+  EXPECT_FALSE(a.contains(connection(7, 0)));
+  a.erase(a.begin());
+  EXPECT_EQ(a.begin()->id, 1);
+  EXPECT_EQ(a.size(), 8U);
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  for (connection& c : items) {
+    EXPECT_FALSE(c.by_id.is_linked());
+  }
+  EXPECT_TRUE(a.insert(items[0]).second);
+}
+
+TEST(IntrusiveSet, SeveralIndexes) {
+  std::vector<connection> items;
+  for (int i = 0; i < 100; i++) {
+    items.emplace_back(i, (i * 37) % 100);
+  }
+  id_index ids;
+  deadline_index deadlines;
+  for (connection& c : items) {
+    ids.insert(c);
+    deadlines.insert(c);
+  }
+  EXPECT_EQ(deadlines.begin()->deadline, 0);
+  EXPECT_EQ(deadlines.begin()->id, 0);
+  // reschedule: unlink from one index, change its key, link it back
+  connection& c = *ids.find(connection(10, 0));
+  deadlines.erase(c);
+  c.deadline = -1;
+  deadlines.insert(c);
+  EXPECT_EQ(&*deadlines.begin(), &c);
+  EXPECT_EQ(&*ids.iterator_to(c), &c);
+  EXPECT_EQ(ids.size(), 100U);
+  EXPECT_EQ(deadlines.size(), 100U);
+}
+
+TEST(IntrusiveSet, RandomAgainstStdSet) {
+  std::vector<connection> items;
+  for (int i = 0; i < 3000; i++) {
+    items.emplace_back(i, 0);
+  }
+  id_index a;
+  std::set<int> b;
+  std::srand(48);
+  for (int round = 0; round < 30000; round++) {
+    connection& c = items[std::rand() % items.size()];
+    if (c.by_id.is_linked()) {
+      a.erase(c);
+      b.erase(c.id);
+    } else {
+      a.insert(c);
+      b.insert(c.id);
+    }
+    if (round % 1000 == 0) {
+      check_tree(a);
+    }
+  }
+  check_tree(a);
+  ASSERT_EQ(a.size(), b.size());
+  auto it = b.begin();
+  for (connection& c : a) {
+    EXPECT_EQ(c.id, *it++);
+  }
+}
+
+TEST(IntrusiveSet, MultiInsert) {
+  std::vector<connection> items;
+  for (int i = 0; i < 6; i++) {
+    items.emplace_back(i, i % 2);
+  }
+  deadline_index a;
+  for (connection& c : items) {
+    a.multiinsert(c);
+  }
+  std::vector<int> order;
+  for (connection& c : a) {
+    order.push_back(c.id);
+  }
+  EXPECT_EQ(order, std::vector<int>({0, 2, 4, 1, 3, 5}));
+  EXPECT_EQ(a.lower_bound(connection(0, 1))->id, 1);
+}
+
+TEST(IntrusiveSet, MoveSwapAndCopiedHooks) {
+  std::vector<connection> items;
+  for (int i = 0; i < 5; i++) {
+    items.emplace_back(i, 0);
+  }
+  id_index a;
+  for (connection& c : items) {
+    a.insert(c);
+  }
+  id_index b(std::move(a));
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), 5U);
+  EXPECT_EQ((--b.end())->id, 4);
+  id_index c;
+  b.erase(items[1]);
+  c.insert(items[1]);
+  c.swap(b);
+  EXPECT_EQ(b.size(), 1U);
+  EXPECT_EQ(b.begin()->id, 1);
+  EXPECT_EQ(c.size(), 4U);
+  EXPECT_EQ(&*c.begin(), &items[0]);
+  EXPECT_EQ(&*--c.end(), &items[4]);
+  connection copy = items[2];
+  EXPECT_TRUE(items[2].by_id.is_linked());
+  EXPECT_FALSE(copy.by_id.is_linked());
+  copy.id = 3;
+  items[3] = copy;
+  EXPECT_TRUE(items[3].by_id.is_linked());
+  EXPECT_EQ(&*c.find(copy), &items[3]);
+  EXPECT_TRUE(c.contains(connection(3, 0)));
+}
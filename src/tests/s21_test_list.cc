@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+
+#include "../model/s21_list.hh"
+
+template <typename T>
+void list_eq(const s21::list<T>& a, const std::list<T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  ASSERT_EQ(a.size(), b.size());
+  auto it = a.begin();
+  for (const T& value : b) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_EQ(it, a.end());
+  if (!b.empty()) {
+    EXPECT_EQ(a.front(), b.front());
+    EXPECT_EQ(a.back(), b.back());
+  }
+}
+
+TEST(List, DefaultConstructor) {
+  s21::list<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_THROW(a.front(), std::out_of_range);
+  EXPECT_THROW(a.back(), std::out_of_range);
+  EXPECT_THROW(a.pop_back(), std::out_of_range);
+  EXPECT_THROW(a.pop_front(), std::out_of_range);
+}
+
+TEST(List, Constructors) {
+  s21::list<int> a(3);
+  list_eq(a, std::list<int>(3));
+  s21::list<std::string> b{"one", "two", "three"};
+  list_eq(b, {"one", "two", "three"});
+  s21::list<std::string> c(b);
+  list_eq(c, {"one", "two", "three"});
+  EXPECT_NE(c.pool(), b.pool());
+  s21::list<std::string> d(std::move(c));
+  list_eq(d, {"one", "two", "three"});
+  EXPECT_TRUE(c.empty());
+  c.push_back("four");
+  list_eq(c, {"four"});
+  c = d;
+  list_eq(c, {"one", "two", "three"});
+  d = s21::list<std::string>{"five"};
+  list_eq(d, {"five"});
+}
+
+TEST(List, PushPop) {
+  s21::list<int> a;
+  std::list<int> b;
+  for (int i = 0; i < 100; i++) {
+    a.push_back(i);
+    b.push_back(i);
+    a.push_front(-i);
+    b.push_front(-i);
+  }
+  list_eq(a, b);
+  for (int i = 0; i < 30; i++) {
+    a.pop_back();
+    b.pop_back();
+    a.pop_front();
+    b.pop_front();
+  }
+  list_eq(a, b);
+  EXPECT_EQ(a.emplace_back(7), 7);
+  EXPECT_EQ(a.emplace_front(8), 8);
+}
+
+TEST(List, InsertErase) {
+  s21::list<int> a{1, 2, 3};
+  auto it = a.begin();
+  ++it;
+  EXPECT_EQ(*a.insert(it, 5), 5);
+  list_eq(a, {1, 5, 2, 3});
+  it = a.erase(it);
+  EXPECT_EQ(*it, 3);
+  list_eq(a, {1, 5, 3});
+  a.erase(a.begin());
+  list_eq(a, {5, 3});
+  a.clear();
+  list_eq(a, {});
+  a.push_back(1);
+  list_eq(a, {1});
+}
+
+TEST(List, PoolReusesNodes) {
+  s21::list<int> a;
+  for (int i = 0; i < 100; i++) {
+    a.push_back(i);
+  }
+  std::size_t capacity = a.pool()->capacity();
+  for (int round = 0; round < 10; round++) {
+    a.clear();
+    for (int i = 0; i < 100; i++) {
+      a.push_back(i);
+    }
+  }
+  EXPECT_EQ(a.pool()->capacity(), capacity);
+}
+
+TEST(List, SpliceSharedPool) {
+  auto pool = s21::list<int>::make_pool();
+  s21::list<int> a(pool);
+  s21::list<int> b(pool);
+  a.insert_many_back(1, 2, 3);
+  b.insert_many_back(4, 5);
+  auto kept = b.begin();
+  a.splice(a.begin(), b);
+  list_eq(a, {4, 5, 1, 2, 3});
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(*kept, 4);
+  auto last = a.end();
+  --last;
+  b.splice(b.end(), a, last);
+  list_eq(a, {4, 5, 1, 2});
+  list_eq(b, {3});
+  // LRU: move an element to the front of its own list
+  auto two = a.end();
+  --two;
+  a.splice(a.begin(), a, two);
+  list_eq(a, {2, 4, 5, 1});
+  a.splice(a.begin(), a, a.begin());
+  list_eq(a, {2, 4, 5, 1});
+}
+
+TEST(List, SpliceOtherPool) {
+  s21::list<std::string> a{"a", "b"};
+  s21::list<std::string> b{"c", "d"};
+  auto pos = a.begin();
+  ++pos;
+  a.splice(pos, b);
+  list_eq(a, {"a", "c", "d", "b"});
+  EXPECT_TRUE(b.empty());
+  b.splice(b.begin(), a, a.begin());
+  list_eq(a, {"c", "d", "b"});
+  list_eq(b, {"a"});
+}
+
+TEST(List, Merge) {
+  s21::list<int> a{1, 3, 5, 7};
+  s21::list<int> b{0, 2, 3, 8, 9};
+  a.merge(b);
+  list_eq(a, {0, 1, 2, 3, 3, 5, 7, 8, 9});
+  EXPECT_TRUE(b.empty());
+  auto pool = s21::list<int>::make_pool();
+  s21::list<int> c(pool);
+  s21::list<int> d(pool);
+  d.insert_many_back(5, 1);
+  c.merge(d, [](int lhs, int rhs) { return lhs > rhs; });
+  list_eq(c, {5, 1});
+  c.merge(c);
+  list_eq(c, {5, 1});
+}
+
+TEST(List, SortReverseUnique) {
+  s21::list<int> a;
+  std::list<int> b;
+  for (int i = 0; i < 1000; i++) {
+    int value = (i * 7919) % 101;
+    a.push_back(value);
+    b.push_back(value);
+  }
+  std::size_t capacity = a.pool()->capacity();
+  a.sort();
+  b.sort();
+  list_eq(a, b);
+  EXPECT_EQ(a.pool()->capacity(), capacity);
+  a.reverse();
+  b.reverse();
+  list_eq(a, b);
+  a.unique();
+  b.unique();
+  list_eq(a, b);
+  EXPECT_EQ(a.size(), 101U);
+}
+
+TEST(List, SortIsStable) {
+  s21::list<std::pair<int, int>> a;
+  for (int i = 0; i < 100; i++) {
+    a.push_back({i % 3, i});
+  }
+  a.sort([](const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) {
+    return lhs.first < rhs.first;
+  });
+  auto prev = *a.begin();
+  for (auto it = ++a.begin(); it != a.end(); ++it) {
+    EXPECT_TRUE(prev.first < it->first || (prev.first == it->first && prev.second < it->second));
+    prev = *it;
+  }
+}
+
+TEST(List, InsertMany) {
+  s21::list<int> a{1, 5};
+  auto it = a.begin();
+  ++it;
+  EXPECT_EQ(*a.insert_many(it, 2, 3, 4), 4);
+  list_eq(a, {1, 2, 3, 4, 5});
+  a.insert_many_back(6, 7);
+  a.insert_many_front(-1, 0);
+  list_eq(a, {-1, 0, 1, 2, 3, 4, 5, 6, 7});
+}
+
+TEST(List, Swap) {
+  s21::list<int> a{1, 2};
+  s21::list<int> b{3};
+  auto pool = a.pool();
+  a.swap(b);
+  list_eq(a, {3});
+  list_eq(b, {1, 2});
+  EXPECT_EQ(b.pool(), pool);
+}
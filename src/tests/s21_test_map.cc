@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <memory_resource>
+#include <new>
+#include <vector>
 
 #include "../model/s21_map.hh"
 
@@ -786,4 +789,42 @@ TEST(Map, InsertMany) {
                   std::pair<int, int>{9, 9});
     map_eq(a, c);
   }
-}
\ No newline at end of file
+}
+
+TEST(Map, BuildParallel) {
+  std::vector<std::pair<int, int>> input;
+  unsigned state = 5;
+  for (int i = 0; i < 100000; i++) {
+    state = state * 1103515245U + 12345U;
+    input.emplace_back((state >> 8) % 50000, i);
+  }
+  for (unsigned threads : {1U, 4U}) {
+    s21::map<int, int> a =
+        s21::map<int, int>::build_parallel(input.begin(), input.end(), threads);
+    // like insert(), the first pair of every key wins
+    std::map<int, int> c;
+    for (const auto& value : input) {
+      c.insert(value);
+    }
+    map_eq(a, c);
+  }
+}
+
+TEST(Map, MonotonicBuffer) {
+  // a request-scoped map: every node comes from the buffer, and running
+  // out of it fails rather than falling back to the heap
+  alignas(std::max_align_t) unsigned char buffer[4096];
+  std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer),
+                                               std::pmr::null_memory_resource());
+  s21::pmr::map<int, int> a(&resource);
+  for (int i = 0; i < 20; i++) {
+    a[i] = i * i;
+  }
+  EXPECT_EQ(a.size(), 20U);
+  EXPECT_EQ(a.at(7), 49);
+  a.erase(a.find(7));
+  EXPECT_FALSE(a.contains(7));
+  EXPECT_THROW(
+      for (int i = 20; i < 1000; i++) { a.insert(i, i); }, std::bad_alloc);
+  EXPECT_EQ(a.at(19), 361);
+}
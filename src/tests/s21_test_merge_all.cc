@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../model/s21_map.hh"
+#include "../model/s21_merge_all.hh"
+#include "../model/s21_set.hh"
+#include "../s21_containersplus.h"
+
+TEST(MergeAll, Sets) {
+  std::vector<s21::set<int>> parts(7);
+  std::set<int> expected;
+  unsigned state = 11;
+  for (int i = 0; i < 200000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 100000;
+    parts[i % parts.size()].insert(key);
+    expected.insert(key);
+  }
+  for (unsigned threads : {1U, 4U}) {
+    s21::set<int> merged = s21::merge_all(parts, threads);
+    EXPECT_EQ(merged.size(), expected.size());
+    auto it = merged.begin();
+    for (int key : expected) {
+      EXPECT_EQ(*it, key);
+      ++it;
+    }
+    EXPECT_EQ(it, merged.end());
+  }
+}
+
+TEST(MergeAll, Multisets) {
+  std::vector<s21::multiset<int>> parts(5);
+  std::multiset<int> expected;
+  unsigned state = 13;
+  for (int i = 0; i < 150000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 3000;
+    parts[(state >> 4) % parts.size()].insert(key);
+    expected.insert(key);
+  }
+  for (unsigned threads : {1U, 3U}) {
+    s21::multiset<int> merged = s21::merge_all(parts, threads);
+    EXPECT_EQ(merged.size(), expected.size());
+    EXPECT_EQ(merged.count(42), expected.count(42));
+    auto it = merged.begin();
+    for (int key : expected) {
+      EXPECT_EQ(*it, key);
+      ++it;
+    }
+    EXPECT_EQ(it, merged.end());
+  }
+}
+
+TEST(MergeAll, MultisetCounts) {
+  // a million copies per key: merged as runs, never copy by copy
+  std::vector<s21::multiset<int>> parts(3);
+  parts[0].insert(1, 1000000);
+  parts[0].insert(5, 2);
+  parts[1].insert(1, 3000000);
+  parts[2].insert(3, 1);
+  parts[2].insert(5, 7);
+  s21::multiset<int> merged = s21::merge_all(parts, 2);
+  EXPECT_EQ(merged.size(), 4000010U);
+  EXPECT_EQ(merged.unique_size(), 3U);
+  EXPECT_EQ(merged.count(1), 4000000U);
+  EXPECT_EQ(merged.count(3), 1U);
+  EXPECT_EQ(merged.count(5), 9U);
+  std::vector<std::pair<int, std::size_t>> counted{{2, 3}, {4, 1}};
+  auto b = s21::multiset<int>::from_sorted_counts(counted.begin(), counted.end());
+  EXPECT_EQ(b.size(), 4U);
+  EXPECT_EQ(b.count(2), 3U);
+  EXPECT_EQ(*b.key_lower_bound(3), 4);
+}
+
+TEST(MergeAll, EmptyInputs) {
+  std::vector<s21::set<int>> none;
+  EXPECT_TRUE(s21::merge_all(none).empty());
+  std::vector<s21::set<int>> parts(3);
+  parts[1].insert(5);
+  s21::set<int> merged = s21::merge_all(parts);
+  EXPECT_EQ(merged.size(), 1U);
+  EXPECT_EQ(*merged.begin(), 5);
+}
+
+TEST(MergeAll, CustomCompare) {
+  std::vector<s21::set<int, std::greater<int>>> parts(2);
+  parts[0].insert_many(1, 5, 9);
+  parts[1].insert_many(2, 5, 8);
+  auto merged = s21::merge_all(parts);
+  std::vector<int> expected{9, 8, 5, 2, 1};
+  auto it = merged.begin();
+  for (int key : expected) {
+    EXPECT_EQ(*it, key);
+    ++it;
+  }
+  EXPECT_EQ(it, merged.end());
+}
+
+TEST(MergeAll, FromSorted) {
+  std::vector<int> sorted{1, 1, 2, 3, 3, 3, 7};
+  s21::set<int> a = s21::set<int>::from_sorted(sorted.begin(), sorted.end());
+  EXPECT_EQ(a.size(), 4U);
+  s21::multiset<int> b = s21::multiset<int>::from_sorted(sorted.begin(), sorted.end());
+  EXPECT_EQ(b.size(), 7U);
+  EXPECT_EQ(b.count(3), 3U);
+  EXPECT_EQ(*a.lower_bound(4), 7);
+  EXPECT_EQ(*a.upper_bound(1), 2);
+}
+
+TEST(MergeAll, MemoryResource) {
+  std::pmr::monotonic_buffer_resource pool;
+  std::vector<s21::pmr::set<int>> sets;
+  std::vector<s21::pmr::multiset<int>> multisets;
+  // a reallocating vector would copy them, and copies use the default resource
+  sets.reserve(3);
+  multisets.reserve(3);
+  for (int i = 0; i < 3; i++) {
+    sets.emplace_back(&pool);
+    multisets.emplace_back(&pool);
+  }
+  for (int i = 0; i < 300; i++) {
+    sets[i % 3].insert(i % 100);
+    multisets[i % 3].insert(i % 100);
+  }
+  std::vector<int> sorted{1, 2, 2, 3};
+  std::vector<std::pair<int, std::size_t>> counted{{1, 2}, {4, 1}};
+  std::vector<std::pair<const int, int>> pairs{{1, 10}, {2, 20}};
+  // nothing below may fall back to the default resource
+  std::pmr::memory_resource *previous =
+      std::pmr::set_default_resource(std::pmr::null_memory_resource());
+  auto merged_sets = s21::merge_all(sets, 2);
+  auto merged_multisets = s21::merge_all(multisets, 2);
+  auto set = s21::pmr::set<int>::build_parallel(sorted.begin(), sorted.end(), 2, &pool);
+  auto sorted_set = s21::pmr::set<int>::from_sorted(sorted.begin(), sorted.end(), 2, &pool);
+  auto multiset = s21::pmr::multiset<int>::build_parallel(sorted.begin(), sorted.end(), 2, &pool);
+  auto counts =
+      s21::pmr::multiset<int>::from_sorted_counts(counted.begin(), counted.end(), 2, &pool);
+  auto map = s21::pmr::map<int, int>::build_parallel(pairs.begin(), pairs.end(), 2, &pool);
+  auto sorted_map = s21::pmr::map<int, int>::from_sorted(pairs.begin(), pairs.end(), 2, &pool);
+  std::pmr::set_default_resource(previous);
+  EXPECT_EQ(merged_sets.get_allocator().resource(), &pool);
+  EXPECT_EQ(merged_sets.size(), 100U);
+  EXPECT_EQ(merged_multisets.get_allocator().resource(), &pool);
+  EXPECT_EQ(merged_multisets.size(), 300U);
+  EXPECT_EQ(set.size(), 3U);
+  EXPECT_EQ(sorted_set.size(), 3U);
+  EXPECT_EQ(multiset.count(2), 2U);
+  EXPECT_EQ(counts.size(), 3U);
+  EXPECT_EQ(map.at(2), 20);
+  EXPECT_EQ(sorted_map.size(), 2U);
+  // an explicit allocator overrides the one of the inputs
+  auto elsewhere = s21::merge_all(sets, 1, std::pmr::get_default_resource());
+  EXPECT_EQ(elsewhere.get_allocator().resource(), std::pmr::get_default_resource());
+  EXPECT_EQ(elsewhere.size(), 100U);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_mpmc_queue.hh"
+
+TEST(MpmcQueue, TryPushPop) {
+  s21::mpmc_queue<std::string> a(3);
+  EXPECT_EQ(a.capacity(), 4U);
+  EXPECT_TRUE(a.empty());
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(a.try_push(std::to_string(i)));
+  }
+  EXPECT_FALSE(a.try_push("full"));
+  EXPECT_EQ(a.size(), 4U);
+  std::string value;
+  for (int lap = 0; lap < 10; lap++) {
+    EXPECT_TRUE(a.try_pop(value));
+    EXPECT_EQ(value, std::to_string(lap));
+    EXPECT_TRUE(a.try_emplace(std::to_string(lap + 4)));
+  }
+  for (int i = 10; i < 14; i++) {
+    EXPECT_EQ(a.pop(), std::to_string(i));
+  }
+  EXPECT_FALSE(a.try_pop(value));
+}
+
+TEST(MpmcQueue, DestroysRemaining) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::mpmc_queue<std::shared_ptr<int>> a(8);
+    a.push(counter);
+    a.push(counter);
+    std::shared_ptr<int> out;
+    a.pop(out);
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(MpmcQueue, ManyProducersConsumers) {
+  s21::mpmc_queue<long> a(64);
+  const int producers = 3;
+  const int consumers = 3;
+  const long per_producer = 30000;
+  std::atomic<long> sum(0);
+  std::atomic<long> received(0);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([&a, p, per_producer] {
+      for (long i = 0; i < per_producer; i++) {
+        a.push(p * per_producer + i);
+      }
+    });
+  }
+  for (int c = 0; c < consumers; c++) {
+    threads.emplace_back([&a, &sum, &received, per_producer] {
+      while (received.load() < producers * per_producer) {
+        long value;
+        if (a.try_pop(value)) {
+          sum += value;
+          received++;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  long total = producers * per_producer;
+  EXPECT_EQ(received.load(), total);
+  EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+  EXPECT_TRUE(a.empty());
+}
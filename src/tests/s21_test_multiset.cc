@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -1014,4 +1015,138 @@ TEST(Multiset, InsertMany) {
     a.insert_many(1, 3, 5, 7, 9);
     multiset_eq(a, c);
   }
-}
\ No newline at end of file
+}
+TEST(Multiset, CountedDuplicates) {
+  s21::multiset<int> a;
+  std::multiset<int> b;
+  for (int i = 0; i < 100000; i++) {
+    a.insert(i % 3 == 0 ? 7 : i % 5);
+    b.insert(i % 3 == 0 ? 7 : i % 5);
+  }
+  EXPECT_EQ(a.unique_size(), 6U);
+  for (int key = 0; key < 8; key++) {
+    EXPECT_EQ(a.count(key), b.count(key));
+  }
+  multiset_eq(a, b);
+  a.erase(a.find(7));
+  b.erase(b.find(7));
+  EXPECT_EQ(a.count(7), b.count(7));
+  multiset_eq(a, b);
+}
+
+TEST(Multiset, InsertCount) {
+  s21::multiset<int> a{2};
+  std::multiset<int> b{2, 1, 1, 1, 2, 2};
+  auto it = a.insert(1, 3);
+  EXPECT_EQ(*it, 1);
+  EXPECT_EQ(*++it, 2);
+  a.insert(2, 2);
+  EXPECT_EQ(a.count(2), 3U);
+  EXPECT_EQ(a.unique_size(), 2U);
+  multiset_eq(a, b);
+}
+
+TEST(Multiset, InsertZeroAndEraseEnd) {
+  s21::multiset<int> a{2, 2};
+  EXPECT_EQ(a.insert(5, 0), a.end());
+  EXPECT_FALSE(a.contains(5));
+  EXPECT_EQ(a.unique_size(), 1U);
+  auto it = a.insert(2, 0);
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(a.count(2), 2U);
+  a.erase(a.end());
+  EXPECT_EQ(a.size(), 2U);
+  std::multiset<int> b{2, 2};
+  multiset_eq(a, b);
+}
+
+TEST(Multiset, FromSortedCountsSkipsZero) {
+  std::vector<std::pair<int, std::size_t>> counted{{1, 0}, {2, 2}, {3, 0}, {4, 1}, {5, 0}};
+  auto a = s21::multiset<int>::from_sorted_counts(counted.begin(), counted.end());
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_EQ(a.unique_size(), 2U);
+  EXPECT_FALSE(a.contains(3));
+  std::multiset<int> b{2, 2, 4};
+  multiset_eq(a, b);
+  std::vector<std::pair<int, std::size_t>> none{{7, 0}};
+  EXPECT_TRUE(s21::multiset<int>::from_sorted_counts(none.begin(), none.end()).empty());
+}
+
+TEST(Multiset, IteratorDecrement) {
+  s21::multiset<int> a{3, 1, 3, 2, 3};
+  std::vector<int> expected{3, 3, 3, 2, 1};
+  auto it = a.end();
+  for (int value : expected) {
+    --it;
+    EXPECT_EQ(*it, value);
+  }
+  EXPECT_EQ(it, a.begin());
+}
+
+TEST(Multiset, BuildParallel) {
+  std::vector<int> input;
+  unsigned state = 9;
+  for (int i = 0; i < 100000; i++) {
+    state = state * 1103515245U + 12345U;
+    input.push_back((state >> 8) % 5000);
+  }
+  for (unsigned threads : {1U, 4U}) {
+    s21::multiset<int> a =
+        s21::multiset<int>::build_parallel(input.begin(), input.end(), threads);
+    std::multiset<int> c(input.begin(), input.end());
+    multiset_eq(a, c);
+    EXPECT_EQ(a.unique_size(), std::set<int>(input.begin(), input.end()).size());
+    EXPECT_EQ(a.count(42), c.count(42));
+  }
+}
+
+// std::allocator that counts its live blocks in a shared counter
+template <typename T>
+struct counted_allocator {
+  using value_type = T;
+
+  explicit counted_allocator(int* live) : live_(live) {}
+
+  template <typename U>
+  counted_allocator(const counted_allocator<U>& other) : live_(other.live_) {}
+
+  T* allocate(std::size_t n) {
+    ++*live_;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) {
+    --*live_;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const counted_allocator<U>& other) const {
+    return live_ == other.live_;
+  }
+
+  template <typename U>
+  bool operator!=(const counted_allocator<U>& other) const {
+    return live_ != other.live_;
+  }
+
+  int* live_;
+};
+
+TEST(Multiset, Allocator) {
+  int live = 0;
+  {
+    s21::multiset<int, std::less<int>, counted_allocator<int>> a{
+        {1, 1, 2, 3, 3, 3}, counted_allocator<int>(&live)};
+    // the allocator is rebound to the nodes: one per distinct key and the end node
+    EXPECT_EQ(live, 4);
+    EXPECT_EQ(a.size(), 6U);
+    EXPECT_EQ(a.count(3), 3U);
+    EXPECT_EQ(a.get_allocator().live_, &live);
+    auto b(a);
+    EXPECT_EQ(live, 8);
+    b.clear();
+    EXPECT_EQ(live, 5);
+  }
+  EXPECT_EQ(live, 0);
+}
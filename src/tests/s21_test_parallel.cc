@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../model/s21_map.hh"
+#include "../model/s21_set.hh"
+#include "../s21_containersplus.h"
+
+TEST(Parallel, SplitRanges) {
+  s21::set<int> a;
+  for (int i = 0; i < 1000; i++) {
+    a.insert(i);
+  }
+  auto ranges = a.split_ranges(16);
+  EXPECT_GE(ranges.size(), 16U);
+  EXPECT_EQ(ranges.front().first, a.begin());
+  EXPECT_EQ(ranges.back().second, a.end());
+  int expected = 0;
+  for (size_t i = 0; i < ranges.size(); i++) {
+    if (i > 0) {
+      EXPECT_EQ(ranges[i - 1].second, ranges[i].first);
+    }
+    for (auto it = ranges[i].first; it != ranges[i].second; ++it) {
+      EXPECT_EQ(*it, expected++);
+    }
+  }
+  EXPECT_EQ(expected, 1000);
+  s21::set<int> empty;
+  EXPECT_TRUE(empty.split_ranges(4).empty());
+}
+
+TEST(Parallel, ForEachMap) {
+  s21::thread_pool pool(4);
+  s21::map<int, int> a;
+  for (int i = 0; i < 10000; i++) {
+    a.insert(i, i);
+  }
+  s21::parallel_for_each(a, [](std::pair<const int, int>& value) { value.second *= 3; }, pool);
+  for (int i = 0; i < 10000; i++) {
+    EXPECT_EQ(a.at(i), i * 3);
+  }
+}
+
+TEST(Parallel, ReduceSet) {
+  s21::thread_pool pool(4);
+  s21::set<long> a;
+  long expected = 0;
+  for (long i = 0; i < 20000; i += 3) {
+    a.insert(i);
+    expected += i;
+  }
+  EXPECT_EQ(s21::parallel_reduce(a, 0L, [](long lhs, long rhs) { return lhs + rhs; }, pool),
+            expected);
+  s21::set<long> empty;
+  EXPECT_EQ(s21::parallel_reduce(empty, 7L, [](long lhs, long rhs) { return lhs + rhs; }, pool),
+            7L);
+}
+
+TEST(Parallel, ReduceKeepsOrder) {
+  s21::thread_pool pool(3);
+  s21::multiset<char> a;
+  std::multiset<char> b;
+  for (int i = 0; i < 3000; i++) {
+    char c = static_cast<char>('a' + (i * 7) % 26);
+    a.insert(c);
+    b.insert(c);
+  }
+  std::string concatenated = s21::parallel_reduce(
+      a, std::string(), [](std::string lhs, char rhs) { return lhs + rhs; },
+      [](std::string lhs, const std::string& rhs) { return lhs + rhs; }, pool);
+  EXPECT_EQ(concatenated, std::string(b.begin(), b.end()));
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_persistent_rb_tree.hh"
+
+template <typename T>
+void persistent_tree_eq(const s21::persistent_rb_tree<T>& a, const std::set<T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  auto ait = a.begin();
+  auto bit = b.begin();
+  while (bit != b.end()) {
+    EXPECT_EQ(*ait, *bit);
+    ait++;
+    bit++;
+  }
+  EXPECT_EQ(ait, a.end());
+}
+
+TEST(PersistentRbTree, DefaultConstructor) {
+  s21::persistent_rb_tree<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+}
+
+TEST(PersistentRbTree, InitializerListConstructor) {
+  s21::persistent_rb_tree<int> a{5, 1, 4, 1, 3};
+  std::set<int> b{5, 1, 4, 1, 3};
+  persistent_tree_eq(a, b);
+}
+
+TEST(PersistentRbTree, CopyMove) {
+  s21::persistent_rb_tree<int> a{1, 2, 3};
+  std::set<int> c{1, 2, 3};
+  s21::persistent_rb_tree<int> b(a);
+  a.clear();
+  persistent_tree_eq(b, c);
+  s21::persistent_rb_tree<int> d(std::move(b));
+  persistent_tree_eq(d, c);
+  s21::persistent_rb_tree<int> e{7};
+  e = d;
+  persistent_tree_eq(e, c);
+  s21::persistent_rb_tree<int> f;
+  f = std::move(e);
+  persistent_tree_eq(f, c);
+}
+
+TEST(PersistentRbTree, InsertErase) {
+  s21::persistent_rb_tree<int> a;
+  std::set<int> b;
+  unsigned state = 1;
+  for (int i = 0; i < 20000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 1000;
+    if ((state >> 4) % 2) {
+      auto ares = a.insert(key);
+      EXPECT_EQ(ares.second, b.insert(key).second);
+      EXPECT_EQ(*ares.first, key);
+    } else {
+      EXPECT_EQ(a.erase(key), b.erase(key));
+    }
+  }
+  persistent_tree_eq(a, b);
+  while (!a.empty()) {
+    a.erase(a.begin());
+    b.erase(b.begin());
+  }
+  persistent_tree_eq(a, b);
+}
+
+TEST(PersistentRbTree, Snapshot) {
+  s21::persistent_rb_tree<int> a;
+  std::set<int> b;
+  std::vector<s21::persistent_rb_tree<int>> snapshots;
+  std::vector<std::set<int>> expected;
+  unsigned state = 7;
+  for (int i = 0; i < 5000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 300;
+    if ((state >> 4) % 3) {
+      a.insert(key);
+      b.insert(key);
+    } else {
+      a.erase(key);
+      b.erase(key);
+    }
+    if (i % 500 == 0) {
+      snapshots.push_back(a.snapshot());
+      expected.push_back(b);
+    }
+  }
+  a.clear();
+  for (size_t i = 0; i < snapshots.size(); i++) {
+    persistent_tree_eq(snapshots[i], expected[i]);
+  }
+}
+
+TEST(PersistentRbTree, Iterators) {
+  s21::persistent_rb_tree<int> a{2, 1, 3};
+  auto it = a.end();
+  --it;
+  EXPECT_EQ(*it, 3);
+  it--;
+  EXPECT_EQ(*it, 2);
+  --it;
+  EXPECT_EQ(it, a.begin());
+  EXPECT_EQ(*++it, 2);
+}
+
+TEST(PersistentRbTree, Lookup) {
+  s21::persistent_rb_tree<int> a{10, 20, 30};
+  EXPECT_TRUE(a.contains(20));
+  EXPECT_FALSE(a.contains(25));
+  EXPECT_EQ(a.count(30), 1U);
+  EXPECT_EQ(*a.find(10), 10);
+  EXPECT_EQ(a.find(11), a.end());
+  EXPECT_EQ(*a.lower_bound(20), 20);
+  EXPECT_EQ(*a.lower_bound(21), 30);
+  EXPECT_EQ(*a.upper_bound(20), 30);
+  EXPECT_EQ(a.upper_bound(30), a.end());
+  auto range = a.equal_range(20);
+  EXPECT_EQ(*range.first, 20);
+  EXPECT_EQ(*range.second, 30);
+}
+
+TEST(PersistentRbTree, SwapMerge) {
+  s21::persistent_rb_tree<int> a{1, 2};
+  s21::persistent_rb_tree<int> b{3};
+  a.swap(b);
+  persistent_tree_eq(a, std::set<int>{3});
+  persistent_tree_eq(b, std::set<int>{1, 2});
+  a.merge(b);
+  persistent_tree_eq(a, std::set<int>{1, 2, 3});
+}
+
+TEST(PersistentRbTree, InsertMany) {
+  s21::persistent_rb_tree<int> a{1};
+  auto res = a.insert_many(1, 2, 3);
+  EXPECT_EQ(res.size(), 3U);
+  EXPECT_FALSE(res[0].second);
+  EXPECT_TRUE(res[2].second);
+  persistent_tree_eq(a, std::set<int>{1, 2, 3});
+}
+
+TEST(PersistentRbTree, ConcurrentSnapshotReaders) {
+  s21::persistent_rb_tree<int> a;
+  for (int i = 0; i < 1000; i++) {
+    a.insert(i);
+  }
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; t++) {
+    readers.emplace_back([snapshot = a.snapshot()] {
+      int expected = 0;
+      for (int key : snapshot) {
+        EXPECT_EQ(key, expected++);
+      }
+      EXPECT_EQ(expected, 1000);
+    });
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    a.erase(i);
+    a.insert(i + 1000);
+  }
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(a.size(), 1000U);
+  EXPECT_EQ(*a.begin(), 1);
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../model/s21_priority_queue.hh"
+
+template <typename T, typename Compare, std::size_t Arity>
+void priority_queue_eq(s21::priority_queue<T, Compare, Arity> a,
+                       std::priority_queue<T, std::vector<T>, Compare> b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  while (!b.empty()) {
+    EXPECT_EQ(a.top(), b.top());
+    a.pop();
+    b.pop();
+  }
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(PriorityQueue, DefaultConstructor) {
+  s21::priority_queue<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_THROW(a.top(), std::out_of_range);
+  EXPECT_THROW(a.pop(), std::out_of_range);
+}
+
+TEST(PriorityQueue, Constructors) {
+  s21::priority_queue<std::string> a{"b", "d", "a", "e", "c", "f", "g"};
+  std::priority_queue<std::string> b;
+  for (const char* value : {"b", "d", "a", "e", "c", "f", "g"}) {
+    b.push(value);
+  }
+  priority_queue_eq(a, b);
+  s21::priority_queue<std::string> c(a);
+  priority_queue_eq(c, b);
+  s21::priority_queue<std::string> d(std::move(c));
+  priority_queue_eq(d, b);
+  EXPECT_TRUE(c.empty());
+  c = d;
+  priority_queue_eq(c, b);
+}
+
+template <std::size_t Arity, typename Compare>
+void push_pop_random() {
+  s21::priority_queue<int, Compare, Arity> a;
+  std::priority_queue<int, std::vector<int>, Compare> b;
+  std::srand(47);
+  for (int i = 0; i < 20000; i++) {
+    int value = std::rand() % 1000;
+    a.push(value);
+    b.push(value);
+    if (i % 3 == 0) {
+      EXPECT_EQ(a.top(), b.top());
+      a.pop();
+      b.pop();
+    }
+  }
+  priority_queue_eq(a, b);
+}
+
+TEST(PriorityQueue, PushPop) {
+  push_pop_random<2, std::less<int>>();
+  push_pop_random<4, std::less<int>>();
+  push_pop_random<4, std::greater<int>>();
+  push_pop_random<8, std::less<int>>();
+}
+
+TEST(PriorityQueue, InsertManyBackSwap) {
+  s21::priority_queue<int> a{5};
+  a.insert_many_back(3, 9, 1);
+  EXPECT_EQ(a.top(), 9);
+  s21::priority_queue<int> b;
+  b.swap(a);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), 4U);
+  EXPECT_EQ(b.top(), 9);
+}
+
+TEST(AddressablePriorityQueue, Handles) {
+  s21::addressable_priority_queue<int, std::greater<int>> a;
+  EXPECT_THROW(a.top(), std::out_of_range);
+  auto five = a.push(5);
+  auto three = a.push(3);
+  auto eight = a.push(8);
+  EXPECT_EQ(a.top(), 3);
+  EXPECT_EQ(a.top_handle(), three);
+  EXPECT_EQ(a.value(eight), 8);
+  // a min-queue: a larger value moves away from the top, a smaller one
+  // towards it
+  a.demote(three, 9);
+  EXPECT_EQ(a.top(), 5);
+  a.promote(eight, 1);
+  EXPECT_EQ(a.top_handle(), eight);
+  a.update(five, 0);
+  EXPECT_EQ(a.top(), 0);
+  a.erase(five);
+  EXPECT_FALSE(a.contains(five));
+  EXPECT_TRUE(a.contains(three));
+  EXPECT_EQ(a.top(), 1);
+  a.pop();
+  EXPECT_FALSE(a.contains(eight));
+  EXPECT_EQ(a.size(), 1U);
+  EXPECT_EQ(a.value(three), 9);
+  auto reused = a.push(4);
+  EXPECT_TRUE(a.contains(reused));
+  EXPECT_EQ(a.top_handle(), reused);
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  EXPECT_FALSE(a.contains(reused));
+}
+
+TEST(AddressablePriorityQueue, RandomUpdates) {
+  using queue_type = s21::addressable_priority_queue<std::pair<int, int>>;
+  queue_type a;
+  std::set<std::pair<int, int>> b;
+  std::vector<queue_type::handle> handles;
+  std::srand(4747);
+  for (int id = 0; id < 2000; id++) {
+    std::pair<int, int> value(std::rand() % 500, id);
+    handles.push_back(a.push(value));
+    b.insert(value);
+  }
+  for (int round = 0; round < 20000; round++) {
+    int id = std::rand() % 2000;
+    std::pair<int, int> value(std::rand() % 500, id);
+    if (a.contains(handles[id])) {
+      b.erase(a.value(handles[id]));
+      if (round % 10 == 0) {
+        a.erase(handles[id]);
+        continue;
+      }
+      a.update(handles[id], value);
+    } else {
+      handles[id] = a.push(value);
+    }
+    b.insert(value);
+    ASSERT_EQ(a.top(), *b.rbegin());
+  }
+  EXPECT_EQ(a.size(), b.size());
+  queue_type c(a);
+  while (!b.empty()) {
+    EXPECT_EQ(c.top(), *b.rbegin());
+    EXPECT_EQ(c.value(c.top_handle()), c.top());
+    c.pop();
+    b.erase(std::prev(b.end()));
+  }
+  EXPECT_TRUE(c.empty());
+  EXPECT_FALSE(a.empty());
+}
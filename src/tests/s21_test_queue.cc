@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "../model/s21_list.hh"
+#include "../model/s21_queue.hh"
+
+template <typename T, typename Container>
+void queue_eq(s21::queue<T, Container> a, std::queue<T> b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  while (!b.empty()) {
+    EXPECT_EQ(a.front(), b.front());
+    EXPECT_EQ(a.back(), b.back());
+    a.pop();
+    b.pop();
+  }
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(Queue, DefaultConstructor) {
+  s21::queue<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_THROW(a.front(), std::out_of_range);
+  EXPECT_THROW(a.back(), std::out_of_range);
+  EXPECT_THROW(a.pop(), std::out_of_range);
+}
+
+TEST(Queue, InitializerListConstructor) {
+  s21::queue<int> a{1, 2, 3};
+  std::queue<int> b;
+  for (int value : {1, 2, 3}) {
+    b.push(value);
+  }
+  queue_eq(a, b);
+}
+
+TEST(Queue, CopyMove) {
+  s21::queue<std::string> a{"one", "two", "three"};
+  s21::queue<std::string> b(a);
+  EXPECT_EQ(b.size(), 3U);
+  EXPECT_EQ(b.front(), "one");
+  s21::queue<std::string> c(std::move(b));
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(c.back(), "three");
+  s21::queue<std::string> d;
+  d = c;
+  d.pop();
+  EXPECT_EQ(d.front(), "two");
+  EXPECT_EQ(c.front(), "one");
+  s21::queue<std::string> e{"x"};
+  e = std::move(d);
+  EXPECT_EQ(e.size(), 2U);
+}
+
+TEST(Queue, PushPopWrapsAround) {
+  s21::queue<int> a;
+  std::queue<int> b;
+  int next = 0;
+  for (int round = 0; round < 100; round++) {
+    for (int i = 0; i < 7; i++) {
+      a.push(next);
+      b.push(next++);
+    }
+    for (int i = 0; i < 5; i++) {
+      EXPECT_EQ(a.front(), b.front());
+      a.pop();
+      b.pop();
+    }
+  }
+  queue_eq(a, b);
+}
+
+TEST(Queue, Reserve) {
+  s21::queue<int> a;
+  a.reserve(100);
+  size_t capacity = a.capacity();
+  EXPECT_GE(capacity, 100U);
+  for (int i = 0; i < 100; i++) {
+    a.push(i);
+  }
+  EXPECT_EQ(a.capacity(), capacity);
+  EXPECT_EQ(a.back(), 99);
+  a.front() = -1;
+  EXPECT_EQ(a.front(), -1);
+}
+
+TEST(Queue, Swap) {
+  s21::queue<int> a{1, 2};
+  s21::queue<int> b{3};
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1U);
+  EXPECT_EQ(a.front(), 3);
+  EXPECT_EQ(b.back(), 2);
+}
+
+TEST(Queue, InsertManyBack) {
+  s21::queue<int> a{1};
+  a.insert_many_back(2, 3, 4);
+  std::queue<int> b;
+  for (int value : {1, 2, 3, 4}) {
+    b.push(value);
+  }
+  queue_eq(a, b);
+}
+
+TEST(Queue, StableReferences) {
+  s21::queue<int> a;
+  std::vector<const int*> addresses;
+  for (int i = 0; i < 50000; i++) {
+    a.push(i);
+    addresses.push_back(&a.back());
+    if (i % 2 == 0) {
+      a.pop();
+    }
+  }
+  for (std::size_t i = addresses.size() - a.size(); i < addresses.size(); i++) {
+    EXPECT_EQ(&a.front(), addresses[i]);
+    a.pop();
+  }
+}
+
+TEST(Queue, OtherContainers) {
+  s21::queue<std::string, s21::list<std::string>> a{"one", "two"};
+  a.reserve(100);
+  a.push("three");
+  EXPECT_EQ(a.capacity(), 3U);
+  std::queue<std::string> b;
+  for (const char* value : {"one", "two", "three"}) {
+    b.push(value);
+  }
+  queue_eq(a, b);
+}
+
+TEST(Queue, RingDeque) {
+  s21::queue<std::string, s21::ring_deque<std::string>> a{"one", "two"};
+  a.reserve(100);
+  EXPECT_EQ(a.capacity(), 128U);
+  std::queue<std::string> b;
+  b.push("one");
+  b.push("two");
+  // head and tail wrap around the ring many times without growing it
+  for (int i = 0; i < 1000; ++i) {
+    a.push(std::to_string(i));
+    b.push(std::to_string(i));
+    a.pop();
+    b.pop();
+  }
+  EXPECT_EQ(a.capacity(), 128U);
+  queue_eq(a, b);
+  // a growing push may take its value from the ring itself
+  s21::ring_deque<std::string> c;
+  c.push_back("first");
+  while (c.size() < c.capacity()) {
+    c.push_back("filler");
+  }
+  c.emplace_back(c.front());
+  EXPECT_EQ(c.back(), "first");
+  EXPECT_EQ(c.capacity(), 2 * s21::ring_deque<std::string>::kMinCapacity);
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../model/s21_radix_map.hh"
+
+template <typename T>
+void radix_map_eq(s21::radix_map<T>& a, std::map<std::string, T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  auto ait = a.begin();
+  auto bit = b.begin();
+  while (bit != b.end()) {
+    EXPECT_EQ(*ait, *bit);
+    ait++;
+    bit++;
+  }
+  EXPECT_EQ(ait, a.end());
+}
+
+TEST(RadixMap, DefaultConstructor) {
+  s21::radix_map<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+}
+
+TEST(RadixMap, InitializerListConstructor) {
+  {
+    s21::radix_map<int> a{{"b", 2}, {"a", 1}, {"c", 3}};
+    std::map<std::string, int> b{{"b", 2}, {"a", 1}, {"c", 3}};
+    radix_map_eq(a, b);
+  }
+  {
+    s21::radix_map<int> a{{"abc", 1}, {"ab", 2}, {"a", 3}, {"", 4}, {"abd", 5}};
+    std::map<std::string, int> b{{"abc", 1}, {"ab", 2}, {"a", 3}, {"", 4}, {"abd", 5}};
+    radix_map_eq(a, b);
+  }
+  {
+    s21::radix_map<int> a{{"x", 1}, {"x", 2}, {"x", 3}};
+    std::map<std::string, int> b{{"x", 1}, {"x", 2}, {"x", 3}};
+    radix_map_eq(a, b);
+  }
+}
+
+TEST(RadixMap, CopyMove) {
+  s21::radix_map<int> a{{"/api/v1/users", 1}, {"/api/v1/orders", 2}, {"/api/v2", 3}};
+  std::map<std::string, int> c{{"/api/v1/users", 1}, {"/api/v1/orders", 2}, {"/api/v2", 3}};
+  s21::radix_map<int> b(a);
+  a.clear();
+  radix_map_eq(b, c);
+  s21::radix_map<int> d(std::move(b));
+  radix_map_eq(d, c);
+  s21::radix_map<int> e;
+  e = d;
+  radix_map_eq(e, c);
+  s21::radix_map<int> f{{"z", 0}};
+  f = std::move(e);
+  radix_map_eq(f, c);
+}
+
+TEST(RadixMap, At) {
+  s21::radix_map<int> a{{"/users", 1}, {"/users/", 2}, {"/user", 3}};
+  EXPECT_EQ(a.at("/users"), 1);
+  EXPECT_EQ(a.at("/users/"), 2);
+  EXPECT_EQ(a.at("/user"), 3);
+  a.at("/user") = 30;
+  EXPECT_EQ(a.at("/user"), 30);
+  EXPECT_ANY_THROW(a.at("/use"));
+  EXPECT_ANY_THROW(a.at("/users/x"));
+  EXPECT_ANY_THROW(a.at(""));
+}
+
+TEST(RadixMap, OperatorSquaredBrackets) {
+  s21::radix_map<int> a;
+  std::map<std::string, int> b;
+  for (const char* key : {"/a", "/a/b", "/a", "/", "/a/c", "/a/b"}) {
+    a[key]++;
+    b[key]++;
+  }
+  radix_map_eq(a, b);
+}
+
+TEST(RadixMap, Insert) {
+  s21::radix_map<int> a;
+  std::map<std::string, int> b;
+  unsigned state = 1;
+  for (int i = 0; i < 3000; i++) {
+    state = state * 1103515245U + 12345U;
+    std::string key = "/route/" + std::to_string(state % 700) + "/" + std::to_string(state % 7);
+    auto ares = a.insert(key, i);
+    auto bres = b.insert({key, i});
+    EXPECT_EQ(ares.second, bres.second);
+    EXPECT_EQ(*ares.first, *bres.first);
+  }
+  radix_map_eq(a, b);
+}
+
+TEST(RadixMap, InsertOrAssign) {
+  s21::radix_map<int> a{{"k", 1}};
+  auto res = a.insert_or_assign("k", 2);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ((*res.first).second, 2);
+  res = a.insert_or_assign("kk", 3);
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(a.size(), 2U);
+  EXPECT_EQ(a.at("kk"), 3);
+}
+
+TEST(RadixMap, WideNodes) {
+  s21::radix_map<int> a;
+  std::map<std::string, int> b;
+  for (int i = 255; i >= 0; i--) {
+    std::string key = "p";
+    key += static_cast<char>(i);
+    a.insert(key, i);
+    b.insert({key, i});
+  }
+  radix_map_eq(a, b);
+  for (int i = 0; i < 256; i += 3) {
+    std::string key = "p";
+    key += static_cast<char>(i);
+    EXPECT_EQ(a.erase(key), 1U);
+    b.erase(key);
+  }
+  radix_map_eq(a, b);
+}
+
+TEST(RadixMap, Erase) {
+  std::vector<std::string> keys{"", "a", "ab", "abc", "abd", "b", "ba", "/x/y/z", "/x/y", "/x"};
+  s21::radix_map<int> a;
+  std::map<std::string, int> b;
+  for (size_t i = 0; i < keys.size(); i++) {
+    a.insert(keys[i], i);
+    b.insert({keys[i], i});
+  }
+  int size = a.size();
+  for (int i = 0; i < size; i++) {
+    a.erase(a.begin());
+    b.erase(b.begin());
+    radix_map_eq(a, b);
+  }
+  for (size_t i = 0; i < keys.size(); i++) {
+    a.insert(keys[i], i);
+    b.insert({keys[i], i});
+  }
+  for (size_t i = keys.size(); i > 0; i--) {
+    EXPECT_EQ(a.erase(keys[i - 1]), 1U);
+    EXPECT_EQ(a.erase(keys[i - 1]), 0U);
+    b.erase(keys[i - 1]);
+    radix_map_eq(a, b);
+  }
+}
+
+TEST(RadixMap, Iterators) {
+  s21::radix_map<int> a{{"b", 2}, {"a", 1}, {"ba", 3}};
+  auto it = a.end();
+  --it;
+  EXPECT_EQ((*it).first, "ba");
+  it--;
+  EXPECT_EQ(it->first, "b");
+  --it;
+  EXPECT_EQ(it, a.begin());
+  auto inserted = a.insert("aa", 4).first;
+  EXPECT_EQ((*++it).first, "aa");
+  EXPECT_EQ(it, inserted);
+}
+
+TEST(RadixMap, SwapMerge) {
+  s21::radix_map<int> a{{"1", 1}, {"2", 2}};
+  s21::radix_map<int> b{{"3", 3}};
+  std::map<std::string, int> c{{"1", 1}, {"2", 2}};
+  std::map<std::string, int> d{{"3", 3}};
+  a.swap(b);
+  radix_map_eq(a, d);
+  radix_map_eq(b, c);
+  a.merge(b);
+  std::map<std::string, int> e{{"1", 1}, {"2", 2}, {"3", 3}};
+  radix_map_eq(a, e);
+}
+
+TEST(RadixMap, ContainsFind) {
+  s21::radix_map<int> a{{"/api", 1}, {"/api/v1", 2}};
+  EXPECT_TRUE(a.contains("/api"));
+  EXPECT_TRUE(a.contains("/api/v1"));
+  EXPECT_FALSE(a.contains("/ap"));
+  EXPECT_FALSE(a.contains("/api/"));
+  EXPECT_FALSE(a.contains("/api/v2"));
+  EXPECT_EQ(a.find("/api/v1")->second, 2);
+  EXPECT_EQ(a.find("/api/v"), a.end());
+}
+
+TEST(RadixMap, InsertMany) {
+  s21::radix_map<int> a{{"a", 1}};
+  std::map<std::string, int> c{{"a", 1}, {"b", 2}, {"c", 3}};
+  auto res = a.insert_many(std::pair<const std::string, int>{"a", 5},
+                           std::pair<const std::string, int>{"b", 2},
+                           std::pair<const std::string, int>{"c", 3});
+  EXPECT_EQ(res.size(), 3U);
+  EXPECT_FALSE(res[0].second);
+  EXPECT_TRUE(res[2].second);
+  radix_map_eq(a, c);
+}
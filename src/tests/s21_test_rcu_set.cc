@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_rcu_set.hh"
+
+TEST(RcuSet, DefaultConstructor) {
+  s21::rcu_set<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_FALSE(a.contains(0));
+}
+
+TEST(RcuSet, InitializerListConstructor) {
+  s21::rcu_set<int> a{3, 1, 2, 1};
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_TRUE(a.contains(1));
+  EXPECT_TRUE(a.contains(3));
+  EXPECT_FALSE(a.contains(4));
+}
+
+TEST(RcuSet, InsertErase) {
+  s21::rcu_set<int> a;
+  std::set<int> b;
+  unsigned state = 1;
+  for (int i = 0; i < 5000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 700;
+    if ((state >> 4) % 3) {
+      EXPECT_EQ(a.insert(key), b.insert(key).second);
+    } else {
+      EXPECT_EQ(a.erase(key), b.erase(key));
+    }
+  }
+  EXPECT_EQ(a.size(), b.size());
+  for (int key = 0; key < 700; key++) {
+    EXPECT_EQ(a.contains(key), b.count(key) == 1);
+  }
+  a.clear();
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(RcuSet, UpdateAndSnapshot) {
+  s21::rcu_set<int> a{1, 2};
+  auto before = a.snapshot();
+  a.update([](s21::rcu_set<int>::tree_type& tree) {
+    tree.erase(1);
+    tree.insert(5);
+    tree.insert(7);
+  });
+  std::vector<int> old_keys;
+  for (int key : before) {
+    old_keys.push_back(key);
+  }
+  std::vector<int> new_keys;
+  for (int key : a.snapshot()) {
+    new_keys.push_back(key);
+  }
+  EXPECT_EQ(old_keys, (std::vector<int>{1, 2}));
+  EXPECT_EQ(new_keys, (std::vector<int>{2, 5, 7}));
+}
+
+TEST(RcuSet, ConcurrentReaders) {
+  // even keys are always present, odd keys come and go
+  s21::rcu_set<int> a;
+  a.update([](s21::rcu_set<int>::tree_type& tree) {
+    for (int key = 0; key < 512; key += 2) {
+      tree.insert(key);
+    }
+  });
+  std::atomic<bool> done{false};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 3; t++) {
+    readers.emplace_back([&a, &done, t] {
+      unsigned state = t + 1;
+      while (!done.load()) {
+        state = state * 1103515245U + 12345U;
+        int key = (state >> 8) % 256 * 2;
+        ASSERT_TRUE(a.contains(key));
+      }
+    });
+  }
+  for (int round = 0; round < 20; round++) {
+    for (int key = 1; key < 512; key += 2) {
+      a.insert(key);
+    }
+    for (int key = 1; key < 512; key += 2) {
+      a.erase(key);
+    }
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(a.size(), 256U);
+}
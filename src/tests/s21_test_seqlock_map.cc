@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_seqlock_map.hh"
+
+TEST(SeqlockMap, DefaultConstructor) {
+  s21::seqlock_map<int, int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.version(), 0U);
+}
+
+TEST(SeqlockMap, InitializerListConstructor) {
+  s21::seqlock_map<int, int> a{{3, 30}, {1, 10}, {2, 20}, {1, 100}};
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_EQ(a.at(1), 10);
+  EXPECT_EQ(a.at(3), 30);
+}
+
+TEST(SeqlockMap, InsertErase) {
+  s21::seqlock_map<int, int> a;
+  std::map<int, int> b;
+  unsigned state = 1;
+  for (int i = 0; i < 5000; i++) {
+    state = state * 1103515245U + 12345U;
+    int key = (state >> 8) % 700;
+    if ((state >> 4) % 3) {
+      EXPECT_EQ(a.insert(key, i), b.insert({key, i}).second);
+    } else {
+      EXPECT_EQ(a.erase(key), b.erase(key));
+    }
+  }
+  EXPECT_EQ(a.size(), b.size());
+  for (int key = 0; key < 700; key++) {
+    auto it = b.find(key);
+    EXPECT_EQ(a.contains(key), it != b.end());
+    if (it != b.end()) {
+      EXPECT_EQ(a.find(key).value(), it->second);
+    }
+  }
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  EXPECT_FALSE(a.contains(0));
+}
+
+TEST(SeqlockMap, InsertOrAssign) {
+  s21::seqlock_map<int, double> a{{1, 1.5}};
+  EXPECT_FALSE(a.insert_or_assign(1, 2.5));
+  EXPECT_TRUE(a.insert_or_assign(2, 3.5));
+  EXPECT_EQ(a.at(1), 2.5);
+  EXPECT_EQ(a.at(2), 3.5);
+  EXPECT_ANY_THROW(a.at(3));
+}
+
+TEST(SeqlockMap, Version) {
+  s21::seqlock_map<int, int> a;
+  auto version = a.version();
+  a.insert(1, 1);
+  EXPECT_GT(a.version(), version);
+  version = a.version();
+  a.insert(1, 2);
+  a.erase(5);
+  EXPECT_EQ(a.version(), version);
+  EXPECT_EQ(a.version() % 2, 0U);
+}
+
+TEST(SeqlockMap, ConcurrentReaders) {
+  // even keys are always present, odd keys come and go
+  s21::seqlock_map<int, int> a;
+  for (int key = 0; key < 512; key += 2) {
+    a.insert(key, key * 3);
+  }
+  std::atomic<bool> done{false};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 3; t++) {
+    readers.emplace_back([&a, &done, t] {
+      unsigned state = t + 1;
+      while (!done.load()) {
+        state = state * 1103515245U + 12345U;
+        int key = (state >> 8) % 512;
+        auto value = a.find(key);
+        if (key % 2 == 0) {
+          ASSERT_TRUE(value.has_value());
+        }
+        if (value) {
+          EXPECT_EQ(*value, key * 3);
+        }
+      }
+    });
+  }
+  for (int round = 0; round < 20; round++) {
+    for (int key = 1; key < 512; key += 2) {
+      a.insert(key, key * 3);
+    }
+    for (int key = 1; key < 512; key += 2) {
+      a.erase(key);
+    }
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(a.size(), 256U);
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <memory_resource>
 #include <set>
 #include <vector>
 
@@ -930,6 +931,62 @@ TEST(Set, InsertMany) {
   }
 }
 
+TEST(Set, MirrorBalancing) {
+  // Descending inserts keep hitting insert case 3.2.3 (left-left chain).
+  {
+    s21::set<int> a;
+    std::set<int> c;
+    for (int i = 1000; i > 0; i--) {
+      a.insert(i);
+      c.insert(i);
+    }
+    set_eq(a, c);
+  }
+  // Erasing the black right leaf 3 leaves sibling 1 with a red left child 0,
+  // which is delete mirror case 3.4.
+  {
+    s21::set<int> a{2, 1, 3, 0};
+    std::set<int> c{2, 1, 3, 0};
+    a.erase(a.find(3));
+    c.erase(3);
+    set_eq(a, c);
+  }
+  // Draining from the right end keeps the deficit on the right side.
+  {
+    s21::set<int> a;
+    std::set<int> c;
+    for (int i = 0; i < 1000; i++) {
+      a.insert(i);
+      c.insert(i);
+    }
+    for (int i = 999; i >= 0; i--) {
+      a.erase(a.find(i));
+      c.erase(i);
+      if (i % 100 == 0) set_eq(a, c);
+    }
+  }
+  // Mixed inserts and erases reach every balancing case. A tree left
+  // unbalanced by a wrong rotation breaks a later erase.
+  {
+    s21::set<int> a;
+    std::set<int> c;
+    unsigned state = 7;
+    for (int i = 0; i < 200000; i++) {
+      state = state * 1103515245U + 12345U;
+      int key = (state >> 8) % 2000;
+      if ((state >> 4) & 1) {
+        a.insert(key);
+        c.insert(key);
+      } else {
+        auto it = a.find(key);
+        if (it != a.end()) a.erase(it);
+        c.erase(key);
+      }
+    }
+    set_eq(a, c);
+  }
+}
+
 TEST(Set, Functional) {
   {
     s21::set<int> a{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
@@ -946,4 +1003,74 @@ TEST(Set, Functional) {
     c.erase(c.find(9));
     set_eq(a, c);
   }
-}
\ No newline at end of file
+}
+
+TEST(Set, BuildParallel) {
+  std::vector<int> input;
+  unsigned state = 3;
+  for (int i = 0; i < 100000; i++) {
+    state = state * 1103515245U + 12345U;
+    input.push_back((state >> 8) % 50000);
+  }
+  for (unsigned threads : {1U, 4U}) {
+    s21::set<int> a = s21::set<int>::build_parallel(input.begin(), input.end(), threads);
+    std::set<int> c(input.begin(), input.end());
+    set_eq(a, c);
+    a.insert(-1);
+    c.insert(-1);
+    a.erase(a.find(*c.rbegin()));
+    c.erase(*c.rbegin());
+    set_eq(a, c);
+  }
+  std::vector<int> empty;
+  s21::set<int> a = s21::set<int>::build_parallel(empty.begin(), empty.end());
+  EXPECT_TRUE(a.empty());
+}
+
+// forwards to new/delete and counts the blocks it has out
+class counting_resource : public std::pmr::memory_resource {
+ public:
+  int outstanding = 0;
+  int total = 0;
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++outstanding;
+    ++total;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+    --outstanding;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST(Set, MemoryResource) {
+  counting_resource resource;
+  {
+    s21::pmr::set<int> a(&resource);
+    EXPECT_EQ(a.get_allocator().resource(), &resource);
+    for (int i = 0; i < 100; i++) {
+      a.insert(i % 50);
+    }
+    // one node per key and the end node
+    EXPECT_EQ(resource.outstanding, 51);
+    a.erase(a.find(7));
+    EXPECT_EQ(resource.outstanding, 50);
+    s21::pmr::set<int> b(std::move(a));
+    EXPECT_EQ(b.size(), 49U);
+    s21::pmr::set<int> c{1, 2, 3};
+    EXPECT_EQ(c.get_allocator().resource(), std::pmr::get_default_resource());
+    // unequal resources: the elements are copied, not the nodes
+    c = std::move(b);
+    EXPECT_EQ(c.size(), 49U);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(resource.outstanding, 2);
+  }
+  EXPECT_EQ(resource.outstanding, 0);
+}
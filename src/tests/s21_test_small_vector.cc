@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../model/s21_set.hh"
+#include "../model/s21_small_vector.hh"
+
+template <typename T, std::size_t N>
+void small_vector_eq(const s21::small_vector<T, N>& a, const std::vector<T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  ASSERT_EQ(a.size(), b.size());
+  for (std::size_t i = 0; i < b.size(); i++) {
+    EXPECT_EQ(a[i], b[i]);
+  }
+}
+
+TEST(SmallVector, DefaultConstructor) {
+  s21::small_vector<int, 4> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_TRUE(a.is_inline());
+  EXPECT_EQ(a.capacity(), 4U);
+  EXPECT_THROW(a.at(0), std::out_of_range);
+  s21::small_vector<int, 0> b;
+  EXPECT_EQ(b.capacity(), 0U);
+  b.push_back(1);
+  EXPECT_FALSE(b.is_inline());
+  EXPECT_EQ(b[0], 1);
+}
+
+TEST(SmallVector, SpillsToHeap) {
+  s21::small_vector<std::string, 3> a;
+  std::vector<std::string> b;
+  for (int i = 0; i < 3; i++) {
+    a.push_back(std::to_string(i));
+    b.push_back(std::to_string(i));
+  }
+  EXPECT_TRUE(a.is_inline());
+  small_vector_eq(a, b);
+  for (int i = 3; i < 100; i++) {
+    a.push_back(std::to_string(i));
+    b.push_back(std::to_string(i));
+  }
+  EXPECT_FALSE(a.is_inline());
+  small_vector_eq(a, b);
+  a.resize(2);
+  b.resize(2);
+  a.shrink_to_fit();
+  EXPECT_TRUE(a.is_inline());
+  small_vector_eq(a, b);
+}
+
+TEST(SmallVector, CopyMove) {
+  s21::small_vector<std::string, 2> inside{"one", "two"};
+  s21::small_vector<std::string, 2> outside{"one", "two", "three"};
+  EXPECT_TRUE(inside.is_inline());
+  EXPECT_FALSE(outside.is_inline());
+  s21::small_vector<std::string, 2> a(inside);
+  small_vector_eq(a, {"one", "two"});
+  s21::small_vector<std::string, 2> b(std::move(outside));
+  small_vector_eq(b, {"one", "two", "three"});
+  EXPECT_TRUE(outside.empty());
+  EXPECT_TRUE(outside.is_inline());
+  s21::small_vector<std::string, 2> c(std::move(inside));
+  small_vector_eq(c, {"one", "two"});
+  c = b;
+  small_vector_eq(c, {"one", "two", "three"});
+  b = std::move(a);
+  small_vector_eq(b, {"one", "two"});
+  b.swap(c);
+  small_vector_eq(b, {"one", "two", "three"});
+  small_vector_eq(c, {"one", "two"});
+}
+
+TEST(SmallVector, Modifiers) {
+  s21::small_vector<int, 4> a{1, 2, 3};
+  a.push_back(a[0]);
+  a.push_back(a[1]);
+  small_vector_eq(a, {1, 2, 3, 1, 2});
+  EXPECT_EQ(*a.insert(a.begin(), 0), 0);
+  a.erase(a.end() - 1);
+  small_vector_eq(a, {0, 1, 2, 3, 1});
+  EXPECT_EQ(*a.insert_many(a.begin() + 1, 7, 8), 7);
+  small_vector_eq(a, {0, 7, 8, 1, 2, 3, 1});
+  a.insert_many_back(9);
+  EXPECT_EQ(a.back(), 9);
+  EXPECT_EQ(a.emplace_back(10), 10);
+  a.pop_back();
+  a.clear();
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(SmallVector, InsertManyResult) {
+  s21::set<int> a{2};
+  auto result = a.insert_many(1, 2, 3);
+  EXPECT_TRUE(result.is_inline());
+  EXPECT_EQ(result.capacity(), 3U);
+  ASSERT_EQ(result.size(), 3U);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_EQ(*result[2].first, 3);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_spsc_queue.hh"
+
+TEST(SpscQueue, PushPop) {
+  s21::spsc_queue<int, 4> a;
+  EXPECT_EQ(a.capacity(), 4U);
+  EXPECT_TRUE(a.empty());
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(a.try_push(i));
+  }
+  EXPECT_FALSE(a.try_push(4));
+  EXPECT_EQ(a.size(), 4U);
+  int value = -1;
+  EXPECT_TRUE(a.try_pop(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(a.try_push(4));
+  for (int i = 1; i <= 4; i++) {
+    EXPECT_TRUE(a.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(a.try_pop(value));
+}
+
+TEST(SpscQueue, Batches) {
+  s21::spsc_queue<int, 8> a;
+  std::vector<int> input{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto rest = a.push_batch(input.begin(), input.end());
+  EXPECT_EQ(rest - input.begin(), 8);
+  std::vector<int> output(5);
+  EXPECT_EQ(a.pop_batch(output.begin(), 5), 5U);
+  EXPECT_EQ(output, std::vector<int>({0, 1, 2, 3, 4}));
+  rest = a.push_batch(rest, input.end());
+  EXPECT_EQ(rest, input.end());
+  std::vector<int> tail;
+  EXPECT_EQ(a.pop_batch(std::back_inserter(tail), 100), 5U);
+  EXPECT_EQ(tail, std::vector<int>({5, 6, 7, 8, 9}));
+}
+
+TEST(SpscQueue, DestroysRemaining) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::spsc_queue<std::shared_ptr<int>, 4> a;
+    a.try_push(counter);
+    a.try_emplace(counter);
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(SpscQueue, ProducerConsumer) {
+  s21::spsc_queue<long, 64> a;
+  const long count = 200000;
+  std::thread producer([&a, count] {
+    for (long i = 0; i < count;) {
+      if (a.try_push(i)) {
+        i++;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  long expected = 0;
+  std::vector<long> batch(16);
+  while (expected < count) {
+    size_t popped = a.pop_batch(batch.begin(), batch.size());
+    if (popped == 0) {
+      std::this_thread::yield();
+    }
+    for (size_t i = 0; i < popped; i++) {
+      EXPECT_EQ(batch[i], expected++);
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(a.empty());
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#include <stack>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../model/s21_chunked_storage.hh"
+#include "../model/s21_list.hh"
+#include "../model/s21_stack.hh"
+#include "../model/s21_vector.hh"
+
+template <typename T, typename Container>
+void stack_eq(s21::stack<T, Container> a, std::stack<T> b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  EXPECT_EQ(a.size(), b.size());
+  while (!b.empty()) {
+    EXPECT_EQ(a.top(), b.top());
+    a.pop();
+    b.pop();
+  }
+  EXPECT_TRUE(a.empty());
+}
+
+template <typename T>
+std::stack<T> std_stack(std::initializer_list<T> items) {
+  std::stack<T> result;
+  for (const T& value : items) {
+    result.push(value);
+  }
+  return result;
+}
+
+TEST(Stack, DefaultConstructor) {
+  s21::stack<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_THROW(a.top(), std::out_of_range);
+  EXPECT_THROW(a.pop(), std::out_of_range);
+}
+
+TEST(Stack, Constructors) {
+  s21::stack<std::string> a{"one", "two", "three"};
+  stack_eq(a, std_stack<std::string>({"one", "two", "three"}));
+  s21::stack<std::string> b(a);
+  stack_eq(b, std_stack<std::string>({"one", "two", "three"}));
+  s21::stack<std::string> c(std::move(b));
+  stack_eq(c, std_stack<std::string>({"one", "two", "three"}));
+  EXPECT_TRUE(b.empty());
+  b = c;
+  stack_eq(b, std_stack<std::string>({"one", "two", "three"}));
+  c = s21::stack<std::string>{"four"};
+  stack_eq(c, std_stack<std::string>({"four"}));
+}
+
+TEST(Stack, PushPop) {
+  s21::stack<std::string> a;
+  std::stack<std::string> b;
+  for (int i = 0; i < 10000; i++) {
+    a.push(std::to_string(i));
+    b.push(std::to_string(i));
+    if (i % 3 == 0) {
+      a.pop();
+      b.pop();
+    }
+  }
+  stack_eq(a, b);
+  EXPECT_EQ(a.emplace(2, 'x'), "xx");
+  a.top() = "top";
+  EXPECT_EQ(a.top(), "top");
+}
+
+TEST(Stack, StableReferences) {
+  s21::stack<int> a;
+  a.push(-1);
+  const int& bottom = a.top();
+  std::vector<const int*> addresses;
+  for (int i = 0; i < 100000; i++) {
+    a.push(i);
+    addresses.push_back(&a.top());
+  }
+  EXPECT_EQ(bottom, -1);
+  for (int i = 99999; i >= 0; i--) {
+    EXPECT_EQ(&a.top(), addresses[i]);
+    a.pop();
+  }
+  EXPECT_EQ(&a.top(), &bottom);
+}
+
+TEST(Stack, Storage) {
+  s21::chunked_storage<int> a;
+  a.reserve(10000);
+  std::size_t capacity = a.capacity();
+  EXPECT_GE(capacity, 10000U);
+  for (int i = 0; i < 10000; i++) {
+    a.push_back(i);
+  }
+  EXPECT_EQ(a.capacity(), capacity);
+  // pushing and popping across a chunk boundary reuses the chunk
+  for (int i = 0; i < 10000; i++) {
+    a.pop_back();
+  }
+  EXPECT_TRUE(a.empty());
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 20000; i++) {
+      a.push_back(i);
+    }
+    capacity = a.capacity();
+    for (int i = 0; i < 20000; i++) {
+      a.pop_back();
+    }
+    EXPECT_EQ(a.capacity(), capacity);
+  }
+  a.push_back(1);
+  a.shrink_to_fit();
+  EXPECT_LT(a.capacity(), capacity);
+  EXPECT_EQ(a.back(), 1);
+  a.clear();
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 0U);
+  a.push_back(2);
+  EXPECT_EQ(a.back(), 2);
+}
+
+// throws from its constructor when asked to
+struct may_throw {
+  int value;
+
+  explicit may_throw(int v, bool fail = false) : value(v) {
+    if (fail) {
+      throw std::runtime_error("may_throw");
+    }
+  }
+};
+
+TEST(Stack, StorageThrowingConstructor) {
+  s21::chunked_storage<may_throw> a;
+  std::size_t first = s21::chunked_storage<may_throw>::kMinChunkBytes / sizeof(may_throw);
+  for (std::size_t i = 0; i < first; i++) {
+    a.emplace_back(static_cast<int>(i));
+  }
+  // the first chunk is full, the next push opens a chunk and throws
+  EXPECT_THROW(a.emplace_back(-1, true), std::runtime_error);
+  EXPECT_EQ(a.size(), first);
+  EXPECT_EQ(a.back().value, static_cast<int>(first) - 1);
+  a.pop_back();
+  EXPECT_EQ(a.back().value, static_cast<int>(first) - 2);
+  a.emplace_back(7);
+  a.emplace_back(8);
+  EXPECT_EQ(a.back().value, 8);
+  a.pop_back();
+  EXPECT_EQ(a.back().value, 7);
+}
+
+TEST(Stack, OtherContainers) {
+  s21::stack<int, s21::vector<int>> a{1, 2, 3};
+  a.reserve(100);
+  a.push(4);
+  stack_eq(a, std_stack<int>({1, 2, 3, 4}));
+  s21::stack<std::string, s21::list<std::string>> b{"one", "two"};
+  b.reserve(100);
+  b.push("three");
+  stack_eq(b, std_stack<std::string>({"one", "two", "three"}));
+  s21::stack<int, s21::chunked_storage<int>> c{1, 2};
+  c.push(3);
+  stack_eq(c, std_stack<int>({1, 2, 3}));
+}
+
+TEST(Stack, InsertManyFront) {
+  s21::stack<int> a{1};
+  a.insert_many_front(2, 3, 4);
+  stack_eq(a, std_stack<int>({1, 2, 3, 4}));
+}
+
+TEST(Stack, Swap) {
+  s21::stack<int> a{1, 2};
+  s21::stack<int> b{3};
+  a.swap(b);
+  stack_eq(a, std_stack<int>({3}));
+  stack_eq(b, std_stack<int>({1, 2}));
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "../model/s21_thread_pool.hh"
+
+TEST(ThreadPool, RunsEveryTask) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(pool.size(), 4U);
+  std::vector<int> results(1000, 0);
+  std::vector<s21::thread_pool::task_type> tasks;
+  for (int i = 0; i < 1000; i++) {
+    tasks.emplace_back([&results, i] { results[i] = i * 2; });
+  }
+  pool.run(tasks);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(results[i], i * 2);
+  }
+}
+
+TEST(ThreadPool, NestedRun) {
+  s21::thread_pool pool(2);
+  std::atomic<int> leaves(0);
+  std::vector<s21::thread_pool::task_type> outer;
+  for (int i = 0; i < 8; i++) {
+    outer.emplace_back([&pool, &leaves] {
+      std::vector<s21::thread_pool::task_type> inner;
+      for (int j = 0; j < 8; j++) {
+        inner.emplace_back([&leaves] { leaves++; });
+      }
+      pool.run(inner);
+    });
+  }
+  pool.run(outer);
+  EXPECT_EQ(leaves.load(), 64);
+}
+
+TEST(ThreadPool, RethrowsException) {
+  s21::thread_pool pool(2);
+  std::atomic<int> finished(0);
+  std::vector<s21::thread_pool::task_type> tasks;
+  for (int i = 0; i < 16; i++) {
+    tasks.emplace_back([&finished, i] {
+      if (i == 5) {
+        throw std::runtime_error("task failed");
+      }
+      finished++;
+    });
+  }
+  EXPECT_THROW(pool.run(tasks), std::runtime_error);
+  EXPECT_EQ(finished.load(), 15);
+  std::vector<s21::thread_pool::task_type> empty;
+  pool.run(empty);
+}
+
+static long fork_join_sum(s21::thread_pool& pool, long first, long last) {
+  if (last - first <= 1000) {
+    long sum = 0;
+    for (long i = first; i < last; i++) {
+      sum += i;
+    }
+    return sum;
+  }
+  long middle = first + (last - first) / 2;
+  long left = 0;
+  long right = 0;
+  pool.fork_join([&] { left = fork_join_sum(pool, first, middle); },
+                 [&] { right = fork_join_sum(pool, middle, last); });
+  return left + right;
+}
+
+TEST(ThreadPool, ForkJoin) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(fork_join_sum(pool, 0, 1000000), 999999L * 1000000 / 2);
+  std::vector<s21::thread_pool::task_type> tasks;
+  std::vector<long> sums(4);
+  for (int i = 0; i < 4; i++) {
+    tasks.emplace_back([&pool, &sums, i] { sums[i] = fork_join_sum(pool, 0, 100000 * (i + 1)); });
+  }
+  pool.run(tasks);
+  for (long i = 0; i < 4; i++) {
+    long n = 100000 * (i + 1);
+    EXPECT_EQ(sums[i], n * (n - 1) / 2);
+  }
+}
+
+TEST(ThreadPool, ForkJoinException) {
+  s21::thread_pool pool(2);
+  bool first_ran = false;
+  EXPECT_THROW(pool.fork_join([&first_ran] { first_ran = true; },
+                              [] { throw std::runtime_error("second failed"); }),
+               std::runtime_error);
+  EXPECT_TRUE(first_ran);
+  bool second_ran = false;
+  EXPECT_THROW(pool.fork_join([] { throw std::logic_error("first failed"); },
+                              [&second_ran] { second_ran = true; }),
+               std::logic_error);
+  EXPECT_TRUE(second_ran);
+}
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../model/s21_unrolled_list.hh"
+
+template <typename T, std::size_t K>
+void unrolled_list_eq(const s21::unrolled_list<T, K>& a, const std::list<T>& b) {
+  EXPECT_EQ(a.size(), b.size());
+  EXPECT_EQ(a.empty(), b.empty());
+  auto it = b.begin();
+  for (const T& value : a) {
+    ASSERT_NE(it, b.end());
+    EXPECT_EQ(value, *it++);
+  }
+  EXPECT_EQ(it, b.end());
+  // and backwards
+  auto rit = b.rbegin();
+  for (auto i = a.end(); i != a.begin();) {
+    --i;
+    EXPECT_EQ(*i, *rit++);
+  }
+}
+
+TEST(UnrolledList, DefaultConstructor) {
+  s21::unrolled_list<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.capacity(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_THROW(a.front(), std::out_of_range);
+  EXPECT_THROW(a.back(), std::out_of_range);
+  EXPECT_THROW(a.pop_back(), std::out_of_range);
+  EXPECT_THROW(a.pop_front(), std::out_of_range);
+}
+
+TEST(UnrolledList, Constructors) {
+  s21::unrolled_list<std::string, 2> a{"one", "two", "three"};
+  unrolled_list_eq(a, {"one", "two", "three"});
+  s21::unrolled_list<std::string, 2> b(a);
+  unrolled_list_eq(b, {"one", "two", "three"});
+  s21::unrolled_list<std::string, 2> c(std::move(b));
+  unrolled_list_eq(c, {"one", "two", "three"});
+  EXPECT_TRUE(b.empty());
+  b = c;
+  unrolled_list_eq(b, {"one", "two", "three"});
+  c = s21::unrolled_list<std::string, 2>{"four"};
+  unrolled_list_eq(c, {"four"});
+  s21::unrolled_list<int> d(5);
+  unrolled_list_eq(d, {0, 0, 0, 0, 0});
+}
+
+TEST(UnrolledList, PushPopFillBlocks) {
+  s21::unrolled_list<int, 8> a;
+  std::list<int> b;
+  for (int i = 0; i < 64; i++) {
+    a.push_back(i);
+    b.push_back(i);
+    a.push_front(-i);
+    b.push_front(-i);
+  }
+  unrolled_list_eq(a, b);
+  // appending at either end fills every block but the two end ones
+  EXPECT_LT(a.capacity() - a.size(), 2 * 8U);
+  EXPECT_EQ(a.front(), -63);
+  EXPECT_EQ(a.back(), 63);
+  for (int i = 0; i < 60; i++) {
+    a.pop_back();
+    b.pop_back();
+    a.pop_front();
+    b.pop_front();
+  }
+  unrolled_list_eq(a, b);
+  while (!a.empty()) {
+    a.pop_back();
+  }
+  EXPECT_EQ(a.capacity(), 0U);
+}
+
+TEST(UnrolledList, InsertEraseAgainstStdList) {
+  s21::unrolled_list<int, 4> a;
+  std::list<int> b;
+  std::srand(49);
+  for (int round = 0; round < 20000; round++) {
+    std::size_t pos = b.empty() ? 0 : std::rand() % (b.size() + 1);
+    auto ai = a.begin();
+    auto bi = b.begin();
+    for (std::size_t i = 0; i < pos; i++, ++ai, ++bi) {
+    }
+    if (std::rand() % 3 != 0 || bi == b.end()) {
+      auto inserted = a.insert(ai, round);
+      b.insert(bi, round);
+      EXPECT_EQ(*inserted, round);
+    } else {
+      auto next = a.erase(ai);
+      bi = b.erase(bi);
+      EXPECT_EQ(next == a.end(), bi == b.end());
+      if (bi != b.end()) {
+        EXPECT_EQ(*next, *bi);
+      }
+    }
+    if (b.size() > 300) {
+      for (int i = 0; i < 150; i++) {
+        a.pop_front();
+        b.pop_front();
+      }
+    }
+  }
+  unrolled_list_eq(a, b);
+  // every block but the first and the last is at least half full
+  EXPECT_LE(a.capacity(), 2 * a.size() + 8);
+}
+
+TEST(UnrolledList, MassEraseKeepsBlocksHalfFull) {
+  // erase 15 of every 16 elements in one pass
+  s21::unrolled_list<int, 16> a;
+  std::list<int> b;
+  for (int i = 0; i < 16000; i++) {
+    a.push_back(i);
+    b.push_back(i);
+  }
+  auto ai = a.begin();
+  auto bi = b.begin();
+  for (int i = 0; bi != b.end(); i++) {
+    if (i % 16 != 0) {
+      ai = a.erase(ai);
+      bi = b.erase(bi);
+    } else {
+      ++ai;
+      ++bi;
+    }
+  }
+  unrolled_list_eq(a, b);
+  EXPECT_LE(a.capacity(), 2 * a.size() + 16);
+  // drain from the front
+  while (a.size() > 100) {
+    a.pop_front();
+    b.pop_front();
+  }
+  unrolled_list_eq(a, b);
+  EXPECT_LE(a.capacity(), 2 * a.size() + 16);
+}
+
+TEST(UnrolledList, NonTrivialElements) {
+  s21::unrolled_list<std::unique_ptr<int>, 3> a;
+  for (int i = 0; i < 20; i++) {
+    a.push_back(std::make_unique<int>(i));
+  }
+  auto it = a.begin();
+  for (int i = 0; i < 10; i++) {
+    ++it;
+  }
+  it = a.insert(it, std::make_unique<int>(100));
+  it = a.erase(a.begin());
+  int expected[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 100, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+  int i = 0;
+  for (const auto& p : a) {
+    EXPECT_EQ(*p, expected[i++]);
+  }
+  EXPECT_EQ(i, 20);
+  // inserting a copy of an element of the list itself
+  s21::unrolled_list<std::string, 2> b{"a", "b"};
+  b.insert(b.begin(), b.back());
+  unrolled_list_eq(b, {"b", "a", "b"});
+}
+
+TEST(UnrolledList, InsertMany) {
+  s21::unrolled_list<int, 3> a{1, 5};
+  auto last = a.insert_many(++a.begin(), 2, 3, 4);
+  EXPECT_EQ(*last, 4);
+  EXPECT_EQ(a.insert_many(last), last);
+  a.insert_many_back(6, 7);
+  a.insert_many_front(-1, 0);
+  unrolled_list_eq(a, {-1, 0, 1, 2, 3, 4, 5, 6, 7});
+}
+
+TEST(UnrolledList, Swap) {
+  s21::unrolled_list<int> a{1, 2};
+  s21::unrolled_list<int> b{3};
+  a.swap(b);
+  unrolled_list_eq(a, {3});
+  unrolled_list_eq(b, {1, 2});
+  s21::unrolled_list<int> c;
+  c.swap(a);
+  EXPECT_TRUE(a.empty());
+  unrolled_list_eq(c, {3});
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../model/s21_vector.hh"
+
+template <typename T, typename Growth>
+void vector_eq(const s21::vector<T, Growth>& a, const std::vector<T>& b) {
+  EXPECT_EQ(a.empty(), b.empty());
+  ASSERT_EQ(a.size(), b.size());
+  for (std::size_t i = 0; i < b.size(); i++) {
+    EXPECT_EQ(a[i], b[i]);
+  }
+}
+
+// moves are counted, but the vector may relocate it with memcpy
+struct relocatable {
+  static int moves;
+
+  relocatable(int v = 0) : value(v) {}
+  relocatable(relocatable&& other) noexcept : value(other.value) { moves++; }
+  relocatable& operator=(relocatable&& other) noexcept {
+    value = other.value;
+    return *this;
+  }
+  ~relocatable() {}
+
+  int value;
+};
+
+int relocatable::moves = 0;
+
+namespace s21 {
+template <>
+struct is_trivially_relocatable<relocatable> : std::true_type {};
+}  // namespace s21
+
+struct alignas(64) over_aligned {
+  int value;
+};
+
+TEST(Vector, DefaultConstructor) {
+  s21::vector<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0U);
+  EXPECT_EQ(a.capacity(), 0U);
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_THROW(a.at(0), std::out_of_range);
+}
+
+TEST(Vector, Constructors) {
+  s21::vector<int> a(5);
+  vector_eq(a, std::vector<int>(5));
+  s21::vector<std::string> b{"one", "two", "three"};
+  vector_eq(b, {"one", "two", "three"});
+  s21::vector<std::string> c(b);
+  vector_eq(c, {"one", "two", "three"});
+  s21::vector<std::string> d(std::move(c));
+  vector_eq(d, {"one", "two", "three"});
+  EXPECT_TRUE(c.empty());
+  c = d;
+  vector_eq(c, {"one", "two", "three"});
+  c = s21::vector<std::string>{"four"};
+  vector_eq(c, {"four"});
+}
+
+TEST(Vector, ElementAccess) {
+  s21::vector<int> a{1, 2, 3};
+  EXPECT_EQ(a.at(1), 2);
+  EXPECT_THROW(a.at(3), std::out_of_range);
+  EXPECT_EQ(a.front(), 1);
+  EXPECT_EQ(a.back(), 3);
+  EXPECT_EQ(a.data(), &a[0]);
+  a[1] = 5;
+  const s21::vector<int>& b = a;
+  EXPECT_EQ(b.at(1), 5);
+  int sum = 0;
+  for (int value : b) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 9);
+}
+
+TEST(Vector, PushPop) {
+  s21::vector<std::string> a;
+  std::vector<std::string> b;
+  for (int i = 0; i < 1000; i++) {
+    a.push_back(std::to_string(i));
+    b.push_back(std::to_string(i));
+  }
+  vector_eq(a, b);
+  for (int i = 0; i < 500; i++) {
+    a.pop_back();
+    b.pop_back();
+  }
+  vector_eq(a, b);
+  EXPECT_EQ(a.emplace_back(3, 'x'), "xxx");
+  b.emplace_back(3, 'x');
+  vector_eq(a, b);
+}
+
+TEST(Vector, PushBackOwnElement) {
+  s21::vector<std::string> a{"first"};
+  a.shrink_to_fit();
+  for (int i = 0; i < 100; i++) {
+    a.push_back(a[0]);
+  }
+  for (const std::string& value : a) {
+    EXPECT_EQ(value, "first");
+  }
+}
+
+TEST(Vector, Capacity) {
+  s21::vector<int> a;
+  a.reserve(100);
+  EXPECT_EQ(a.capacity(), 100U);
+  int* data = a.data();
+  for (int i = 0; i < 100; i++) {
+    a.unchecked_push_back(i);
+  }
+  EXPECT_EQ(a.data(), data);
+  EXPECT_EQ(a.size(), 100U);
+  a.resize(10);
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 10U);
+  EXPECT_EQ(a[9], 9);
+  a.clear();
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 0U);
+  EXPECT_GT(a.max_size(), 0U);
+}
+
+TEST(Vector, GrowthFactor) {
+  s21::vector<int> a;
+  s21::vector<int, std::ratio<3, 2>> b;
+  std::vector<std::size_t> a_capacities;
+  std::vector<std::size_t> b_capacities;
+  for (int i = 0; i < 40; i++) {
+    a.push_back(i);
+    b.push_back(i);
+    if (a_capacities.empty() || a_capacities.back() != a.capacity()) {
+      a_capacities.push_back(a.capacity());
+    }
+    if (b_capacities.empty() || b_capacities.back() != b.capacity()) {
+      b_capacities.push_back(b.capacity());
+    }
+  }
+  EXPECT_EQ(a_capacities, std::vector<std::size_t>({4, 8, 16, 32, 64}));
+  EXPECT_EQ(b_capacities, std::vector<std::size_t>({4, 6, 9, 13, 19, 28, 42}));
+}
+
+TEST(Vector, TriviallyRelocatable) {
+  relocatable::moves = 0;
+  s21::vector<relocatable> a;
+  int growths = 0;
+  for (int i = 0; i < 1000; i++) {
+    growths += a.size() == a.capacity();
+    a.emplace_back(i);
+  }
+  // only the element being added when the vector grows is moved
+  EXPECT_EQ(relocatable::moves, growths);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(a[i].value, i);
+  }
+  s21::vector<over_aligned> b;
+  for (int i = 0; i < 1000; i++) {
+    b.push_back(over_aligned{i});
+  }
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b.data()) % 64, 0U);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(b[i].value, i);
+  }
+  s21::vector<std::unique_ptr<int>> c;
+  for (int i = 0; i < 100; i++) {
+    c.push_back(std::make_unique<int>(i));
+  }
+  EXPECT_EQ(*c[99], 99);
+}
+
+TEST(Vector, InsertErase) {
+  s21::vector<int> a{1, 2, 3};
+  EXPECT_EQ(*a.insert(a.begin() + 1, 5), 5);
+  vector_eq(a, {1, 5, 2, 3});
+  a.insert(a.end(), 7);
+  vector_eq(a, {1, 5, 2, 3, 7});
+  a.erase(a.begin());
+  vector_eq(a, {5, 2, 3, 7});
+  a.erase(a.end() - 1);
+  vector_eq(a, {5, 2, 3});
+}
+
+TEST(Vector, InsertMany) {
+  s21::vector<int> a{1, 2, 3};
+  EXPECT_EQ(*a.insert_many(a.begin() + 1, 7, 8, 9), 7);
+  vector_eq(a, {1, 7, 8, 9, 2, 3});
+  a.insert_many_back(4, 5);
+  vector_eq(a, {1, 7, 8, 9, 2, 3, 4, 5});
+  a.insert_many(a.begin());
+  vector_eq(a, {1, 7, 8, 9, 2, 3, 4, 5});
+}
+
+TEST(Vector, Swap) {
+  s21::vector<int> a{1, 2};
+  s21::vector<int> b{3};
+  a.swap(b);
+  vector_eq(a, {3});
+  vector_eq(b, {1, 2});
+}
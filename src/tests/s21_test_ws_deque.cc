@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../model/s21_ws_deque.hh"
+
+TEST(WsDeque, OwnerIsLifo) {
+  s21::ws_deque<int> a;
+  EXPECT_TRUE(a.empty());
+  for (int i = 0; i < 200; i++) {
+    a.push(i);
+  }
+  EXPECT_EQ(a.size(), 200U);
+  int value = -1;
+  for (int i = 199; i >= 0; i--) {
+    EXPECT_TRUE(a.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(a.pop(value));
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(WsDeque, ThiefIsFifo) {
+  s21::ws_deque<int> a;
+  for (int i = 0; i < 100; i++) {
+    a.push(i);
+  }
+  int value = -1;
+  EXPECT_TRUE(a.steal(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(a.pop(value));
+  EXPECT_EQ(value, 99);
+  EXPECT_TRUE(a.steal(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_EQ(a.size(), 97U);
+}
+
+TEST(WsDeque, ConcurrentSteal) {
+  s21::ws_deque<long> a;
+  const long count = 100000;
+  std::atomic<bool> finished(false);
+  std::atomic<long> stolen_sum(0);
+  std::atomic<long> stolen(0);
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < 3; t++) {
+    thieves.emplace_back([&] {
+      long value;
+      while (!finished.load()) {
+        if (a.steal(value)) {
+          stolen_sum += value;
+          stolen++;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  long owned_sum = 0;
+  long owned = 0;
+  long value;
+  for (long i = 0; i < count; i++) {
+    a.push(i);
+    if (i % 3 == 0 && a.pop(value)) {
+      owned_sum += value;
+      owned++;
+    }
+  }
+  while (a.pop(value)) {
+    owned_sum += value;
+    owned++;
+  }
+  while (owned + stolen.load() < count) {
+    std::this_thread::yield();
+  }
+  finished = true;
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+  EXPECT_EQ(owned + stolen.load(), count);
+  EXPECT_EQ(owned_sum + stolen_sum.load(), count * (count - 1) / 2);
+}